@@ -18,7 +18,8 @@ project "soloud"
 	}
 
 	defines {
-		"WITH_MINIAUDIO"
+		"WITH_MINIAUDIO",
+		"WITH_NULL" -- Headless runs (See AudioEngine)
 	}
 
 	filter "configurations:Debug"
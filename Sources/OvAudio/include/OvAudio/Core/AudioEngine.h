@@ -9,6 +9,7 @@
 #include <optional>
 #include <vector>
 
+#include <OvAudio/Core/VoiceManager.h>
 #include <OvAudio/Data/SoundHandle.h>
 #include <OvAudio/Entities/AudioSource.h>
 #include <OvAudio/Entities/AudioListener.h>
@@ -29,8 +30,9 @@ namespace OvAudio::Core
 	public:
 		/**
 		* Constructor of the AudioEngine
+		* @param p_nullDriver (If true, no audio device is opened and sounds are only mixed on demand, see SoLoud::Soloud::mix. Used for headless runs)
 		*/
-		AudioEngine();
+		AudioEngine(bool p_nullDriver = false);
 
 		/**
 		* Destructor of the AudioEngine
@@ -103,6 +105,11 @@ namespace OvAudio::Core
 		*/
 		SoLoud::Soloud& GetBackend() const;
 
+		/**
+		* Returns the voice manager, deciding which playing sources are mixed
+		*/
+		VoiceManager& GetVoiceManager();
+
 	private:
 		void Consider(Entities::AudioSource& p_audioSource);
 		void Consider(Entities::AudioListener& p_audioListener);
@@ -110,6 +117,8 @@ namespace OvAudio::Core
 		void Unconsider(Entities::AudioSource& p_audioSource);
 		void Unconsider(Entities::AudioListener& p_audioListener);
 
+		void OnSoundDestroyed(Resources::Sound& p_sound);
+
 	private:
 		bool m_suspended = false;
 
@@ -117,6 +126,16 @@ namespace OvAudio::Core
 		std::vector<std::reference_wrapper<Entities::AudioSource>> m_suspendedAudioSources;
 		std::vector<std::reference_wrapper<Entities::AudioListener>> m_audioListeners;
 
+		VoiceManager m_voiceManager;
+		uint32_t m_maxActiveVoiceCount = 0;
+		std::optional<std::pair<OvMaths::FVector3, OvMaths::FVector3>> m_listenerState;
+
+		OvTools::Eventing::ListenerID m_audioSourceCreatedListener = 0;
+		OvTools::Eventing::ListenerID m_audioSourceDestroyedListener = 0;
+		OvTools::Eventing::ListenerID m_audioListenerCreatedListener = 0;
+		OvTools::Eventing::ListenerID m_audioListenerDestroyedListener = 0;
+		OvTools::Eventing::ListenerID m_soundDestroyedListener = 0;
+
 		std::unique_ptr<SoLoud::Soloud> m_backend;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,105 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include <OvMaths/FVector3.h>
+
+namespace OvAudio::Entities { class AudioSource; }
+
+namespace OvAudio::Core
+{
+	class AudioEngine;
+
+	/**
+	* Decides which playing audio sources get a real (Mixed) voice. Sources are ranked by priority, then by audibility,
+	* and only the first ones, up to the real voice limit, are mixed. The others are virtual: they keep track of their
+	* playback position without being mixed, and resume from there once they rank high enough again
+	*/
+	class VoiceManager
+	{
+		friend class AudioEngine;
+
+	public:
+		/**
+		* Counters of the last update
+		*/
+		struct Statistics
+		{
+			uint32_t realVoiceCount = 0;
+			uint32_t virtualVoiceCount = 0;
+			uint32_t promotedVoiceCount = 0;	// Virtual sources that got a real voice
+			uint32_t demotedVoiceCount = 0;		// Real voices released to a higher ranked source, or inaudible
+		};
+
+		/**
+		* Defines the maximum number of sources mixed at the same time (The audio engine caps it to what its backend can mix)
+		* @param p_maxRealVoices
+		*/
+		void SetMaxRealVoices(uint32_t p_maxRealVoices);
+
+		/**
+		* Returns the maximum number of sources mixed at the same time
+		*/
+		uint32_t GetMaxRealVoices() const;
+
+		/**
+		* Defines the volume (After attenuation) under which a source is virtualized, even if a real voice is available
+		* @param p_threshold
+		*/
+		void SetAudibilityThreshold(float p_threshold);
+
+		/**
+		* Returns the volume (After attenuation) under which a source is virtualized
+		*/
+		float GetAudibilityThreshold() const;
+
+		/**
+		* Returns the counters of the last update
+		*/
+		const Statistics& GetStatistics() const;
+
+		/**
+		* Reserve a real voice for a source starting to play, if the limit isn't reached yet.
+		* Sources that couldn't get one start virtual, and are ranked with the others on the next update
+		*/
+		bool ReserveRealVoice();
+
+		/**
+		* Advance the virtual sources, then give the real voices to the highest ranked sources.
+		* Returns true if voices were started (Their spatial parameters have to be applied)
+		* @param p_sources
+		* @param p_listenerPosition
+		*/
+		bool Update(std::span<const std::reference_wrapper<Entities::AudioSource>> p_sources, const OvMaths::FVector3& p_listenerPosition);
+
+	private:
+		void SetRealVoiceCap(uint32_t p_cap);
+		float ComputeAudibility(Entities::AudioSource& p_source, const OvMaths::FVector3& p_listenerPosition) const;
+
+	private:
+		struct Candidate
+		{
+			Entities::AudioSource* source;
+			float audibility;
+		};
+
+		uint32_t m_maxRealVoices = 32;
+		uint32_t m_realVoiceCap = UINT32_MAX;
+		float m_audibilityThreshold = 0.001f;
+		uint32_t m_reservedVoiceCount = 0;
+		Statistics m_statistics;
+
+		std::vector<Candidate> m_candidates;
+		std::chrono::steady_clock::time_point m_lastUpdate = std::chrono::steady_clock::now();
+	};
+}
@@ -79,6 +79,12 @@ namespace OvAudio::Data
 			const OvMaths::FVector3& p_velocity
 		) const;
 
+		/**
+		* Moves the playback of the sound instance to the given position
+		* @param p_position (In seconds)
+		*/
+		void Seek(double p_position);
+
 		/**
 		* Plays the sound instance
 		*/
@@ -109,6 +115,11 @@ namespace OvAudio::Data
 		*/
 		bool IsSpatial() const;
 
+		/**
+		* Returns the playback position of the sound instance, in seconds (Wrapped when looping)
+		*/
+		double GetPlaybackPosition() const;
+
 		/**
 		* Returns the handle of the sound instance
 		*/
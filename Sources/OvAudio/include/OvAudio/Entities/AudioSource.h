@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 
@@ -18,7 +19,7 @@
 #include <OvTools/Utils/OptRef.h>
 #include <OvTools/Utils/ReferenceOrValue.h>
 
-namespace OvAudio::Core { class AudioEngine; }
+namespace OvAudio::Core { class AudioEngine; class VoiceManager; }
 
 namespace OvAudio::Entities
 {
@@ -27,6 +28,9 @@ namespace OvAudio::Entities
 	*/
 	class AudioSource
 	{
+		friend class Core::AudioEngine;
+		friend class Core::VoiceManager;
+
 	public:
 		/**
 		* AudioSource constructor (Internal transform management)
@@ -54,10 +58,15 @@ namespace OvAudio::Entities
 		void ApplySourceSettingsToTrackedSound();
 
 		/**
-		* Returns true if the audio source has a sound instance
+		* Returns true if the audio source is playing a sound (Even paused or virtual)
 		*/
 		bool HasSound() const;
 
+		/**
+		* Returns true if the sound of the audio source is virtual: its playback position is tracked, but it isn't mixed (See VoiceManager)
+		*/
+		bool IsVirtual() const;
+
 		/**
 		* Returns true if the audio source is currently playing
 		*/
@@ -69,7 +78,7 @@ namespace OvAudio::Entities
 		bool IsPaused() const;
 
 		/**
-		* Returns the currently tracked sound if any, or nullptr
+		* Returns the currently tracked sound instance if any, or nullptr (Virtual sounds have no instance)
 		*/
 		std::weak_ptr<Data::SoundInstance> GetSoundInstance() const;
 
@@ -109,6 +118,12 @@ namespace OvAudio::Entities
 		*/
 		void SetAttenuationThreshold(float p_distance);
 
+		/**
+		* Defines the audio source priority. Sources with the highest priority get the real voices first (See VoiceManager)
+		* @param p_priority
+		*/
+		void SetPriority(uint8_t p_priority);
+
 		/**
 		* Returns the audio source volume
 		*/
@@ -139,6 +154,11 @@ namespace OvAudio::Entities
 		*/
 		float GetAttenuationThreshold() const;
 
+		/**
+		* Returns the audio source priority
+		*/
+		uint8_t GetPriority() const;
+
 		/**
 		* Play the given sound
 		* @param p_sound
@@ -161,9 +181,14 @@ namespace OvAudio::Entities
 		void Stop();
 
 		/**
-		* Update the audio source
+		* Update the spatial parameters of the sound instance, if the audio source moved.
+		* Returns true if they changed
 		*/
-		void Update();
+		bool Update();
+
+	private:
+		void StartVoice();
+		void StopVoice();
 
 	public:
 		static OvTools::Eventing::Event<AudioSource&> CreatedEvent;
@@ -174,6 +199,13 @@ namespace OvAudio::Entities
 		OvTools::Utils::ReferenceOrValue<OvMaths::FTransform> m_transform;
 		std::shared_ptr<Data::SoundInstance> m_instance;
 
+		// Playback state, kept while the sound is virtual
+		const Resources::Sound* m_sound = nullptr;
+		bool m_paused = false;
+		double m_playbackPosition = 0.0;
+		std::optional<OvMaths::FVector3> m_spatialPosition;
+		bool m_spatialDirty = false;
+
 		// Sound settings
 		bool m_spatial = false;
 		float m_volume = 1.0f;
@@ -181,5 +213,6 @@ namespace OvAudio::Entities
 		bool m_looped = false;
 		float m_pitch = 1.0f;
 		float m_attenuationThreshold = 1.0f;
+		uint8_t m_priority = 128;
 	};
 }
\ No newline at end of file
@@ -6,18 +6,26 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include "OvAudio/Resources/Sound.h"
+#include "OvAudio/Settings/ESoundLoadMode.h"
 
 namespace OvAudio::Resources::Loaders
 {
 	/**
-	* Handle the Mesh creation and destruction
+	* Handle the Sound creation and destruction
 	*/
 	class SoundLoader
 	{
 	public:
+		/**
+		* Size of the file, in bytes, above which a sound is streamed when using ESoundLoadMode::AUTOMATIC.
+		* Decoded PCM takes about ten times the size of a compressed file
+		*/
+		static constexpr uintmax_t kStreamingThreshold = 1024 * 1024;
+
 		/**
 		* Disabled constructor
 		*/
@@ -26,20 +34,30 @@ namespace OvAudio::Resources::Loaders
 		/**
 		* Create a sound
 		* @param p_filepath
+		* @param p_loadMode
+		*/
+		static Sound* Create(const std::string& p_filepath, Settings::ESoundLoadMode p_loadMode = Settings::ESoundLoadMode::AUTOMATIC);
+
+		/**
+		* Create a sound, its audio data being loaded by a worker of the default thread pool.
+		* The sound is returned right away, and can be played once loaded (See Sound::IsLoaded)
+		* @param p_filepath
+		* @param p_loadMode
 		*/
-		static Sound* Create(const std::string& p_filepath);
+		static Sound* CreateAsync(const std::string& p_filepath, Settings::ESoundLoadMode p_loadMode = Settings::ESoundLoadMode::AUTOMATIC);
 
 		/**
 		* Reload a sound
 		* @param p_sound
 		* @param p_path
+		* @param p_loadMode
 		*/
-		static void Reload(Sound& p_sound, const std::string& p_path);
+		static void Reload(Sound& p_sound, const std::string& p_path, Settings::ESoundLoadMode p_loadMode = Settings::ESoundLoadMode::AUTOMATIC);
 
 		/**
-		* Destroy a sound
+		* Destroy a sound (Waits for its asynchronous loading to finish, if any)
 		* @param p_soundInstance
 		*/
 		static bool Destroy(Sound*& p_soundInstance);
 	};
-}
\ No newline at end of file
+}
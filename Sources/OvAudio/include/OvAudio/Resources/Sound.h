@@ -6,12 +6,16 @@
 
 #pragma once
 
-#include <string>
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <string>
+
+#include <OvTools/Eventing/Event.h>
 
 namespace SoLoud
 {
-	class Wav;
+	class AudioSource;
 }
 
 namespace OvAudio::Resources
@@ -26,11 +30,45 @@ namespace OvAudio::Resources
 		friend class Loaders::SoundLoader;
 
 	private:
-		Sound(const std::string& p_path, std::unique_ptr<SoLoud::Wav>&& p_audioData);
-		virtual ~Sound() = default;
+		Sound(const std::string& p_path, std::unique_ptr<SoLoud::AudioSource>&& p_audioData, bool p_streamed);
+		virtual ~Sound();
+
+	public:
+		/**
+		* Returns true if the sound is decoded while playing, rather than at load time
+		*/
+		bool IsStreamed() const;
+
+		/**
+		* Returns true if the audio data is ready to be played (Sounds loaded asynchronously are not, until their worker is done)
+		*/
+		bool IsLoaded() const;
+
+		/**
+		* Block until the audio data is ready to be played
+		*/
+		void WaitUntilLoaded() const;
+
+		/**
+		* Returns the memory, in bytes, used by the decoded audio data of the sound (Streamed sounds only decode small chunks while playing)
+		*/
+		size_t GetMemoryUsage() const;
+
+		/**
+		* Returns the duration of the sound, in seconds
+		*/
+		double GetLength() const;
 
 	public:
 		const std::string path;
-		std::unique_ptr<SoLoud::Wav> audioData;
+		std::unique_ptr<SoLoud::AudioSource> audioData;
+
+		static OvTools::Eventing::Event<Sound&> DestroyedEvent;
+
+	private:
+		bool m_streamed;
+		size_t m_memoryUsage = 0;
+		double m_length = 0.0;
+		std::atomic<bool> m_loading = false;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,22 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvAudio::Settings
+{
+	/**
+	* Defines how the audio data of a sound is kept in memory
+	*/
+	enum class ESoundLoadMode : uint8_t
+	{
+		AUTOMATIC,		// Streamed if the file is larger than the streaming threshold, decompressed otherwise
+		DECOMPRESSED,	// Fully decoded at load time, cheap to play (Short sound effects)
+		STREAMED		// Decoded while playing, only the file header is read at load time (Music, ambiences)
+	};
+}
@@ -17,6 +17,7 @@ project "OvAudio"
 	includedirs {
 		-- Dependencies
 		dependdir .. "soloud/include",
+		dependdir .. "tracy",
 
 		-- Overload SDK
 		"%{wks.location}/Sources/OvDebug/include",
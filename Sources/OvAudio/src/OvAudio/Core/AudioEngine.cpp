@@ -10,36 +10,59 @@
 
 #include <soloud.h>
 #include <soloud_wav.h>
+#include <tracy/Tracy.hpp>
 
 #include <OvAudio/Core/AudioEngine.h>
 #include <OvDebug/Assertion.h>
 #include <OvDebug/Logger.h>
 
-OvAudio::Core::AudioEngine::AudioEngine()
+namespace
+{
+	// Voices left to the sounds played outside of audio sources, on top of the real voices of the voice manager
+	constexpr uint32_t kUnmanagedVoiceCount = 16;
+
+	// SoLoud maps its resample buffers with 8-bit indices, it can't mix more than 255 voices at once
+	constexpr uint32_t kMaxActiveVoiceCount = 255;
+	constexpr uint32_t kMaxRealVoiceCount = kMaxActiveVoiceCount - kUnmanagedVoiceCount;
+}
+
+OvAudio::Core::AudioEngine::AudioEngine(bool p_nullDriver)
 {
 	m_backend = std::make_unique<SoLoud::Soloud>();
 
 	// If initialization failed
-	if (m_backend->init() != SoLoud::SOLOUD_ERRORS::SO_NO_ERROR)
+	if (m_backend->init(SoLoud::Soloud::CLIP_ROUNDOFF, p_nullDriver ? SoLoud::Soloud::NULLDRIVER : SoLoud::Soloud::AUTO) != SoLoud::SOLOUD_ERRORS::SO_NO_ERROR)
 	{
 		OVLOG_ERROR("Failed to initialize the audio engine. Playback requests will be ignored.");
 		m_backend.reset();
 		return;
 	}
 
+	m_voiceManager.SetRealVoiceCap(kMaxRealVoiceCount);
+	m_maxActiveVoiceCount = m_voiceManager.GetMaxRealVoices() + kUnmanagedVoiceCount;
+	m_backend->setMaxActiveVoiceCount(m_maxActiveVoiceCount);
+
 	using AudioSourceReceiver = void(AudioEngine::*)(OvAudio::Entities::AudioSource&);
 	using AudioListenerReceiver = void(AudioEngine::*)(OvAudio::Entities::AudioListener&);
 
-	Entities::AudioSource::CreatedEvent += std::bind(static_cast<AudioSourceReceiver>(&AudioEngine::Consider), this, std::placeholders::_1);
-	Entities::AudioSource::DestroyedEvent += std::bind(static_cast<AudioSourceReceiver>(&AudioEngine::Unconsider), this, std::placeholders::_1);
-	Entities::AudioListener::CreatedEvent += std::bind(static_cast<AudioListenerReceiver>(&AudioEngine::Consider), this, std::placeholders::_1);
-	Entities::AudioListener::DestroyedEvent += std::bind(static_cast<AudioListenerReceiver>(&AudioEngine::Unconsider), this, std::placeholders::_1);
+	m_audioSourceCreatedListener = Entities::AudioSource::CreatedEvent += std::bind(static_cast<AudioSourceReceiver>(&AudioEngine::Consider), this, std::placeholders::_1);
+	m_audioSourceDestroyedListener = Entities::AudioSource::DestroyedEvent += std::bind(static_cast<AudioSourceReceiver>(&AudioEngine::Unconsider), this, std::placeholders::_1);
+	m_audioListenerCreatedListener = Entities::AudioListener::CreatedEvent += std::bind(static_cast<AudioListenerReceiver>(&AudioEngine::Consider), this, std::placeholders::_1);
+	m_audioListenerDestroyedListener = Entities::AudioListener::DestroyedEvent += std::bind(static_cast<AudioListenerReceiver>(&AudioEngine::Unconsider), this, std::placeholders::_1);
+	m_soundDestroyedListener = Resources::Sound::DestroyedEvent += std::bind(&AudioEngine::OnSoundDestroyed, this, std::placeholders::_1);
 }
 
 OvAudio::Core::AudioEngine::~AudioEngine()
 {
 	if (IsValid())
 	{
+		// The events are static, they would otherwise call into the destroyed engine (e.g. sounds released after it)
+		Entities::AudioSource::CreatedEvent -= m_audioSourceCreatedListener;
+		Entities::AudioSource::DestroyedEvent -= m_audioSourceDestroyedListener;
+		Entities::AudioListener::CreatedEvent -= m_audioListenerCreatedListener;
+		Entities::AudioListener::DestroyedEvent -= m_audioListenerDestroyedListener;
+		Resources::Sound::DestroyedEvent -= m_soundDestroyedListener;
+
 		m_backend->deinit();
 	}
 }
@@ -56,29 +79,52 @@ void OvAudio::Core::AudioEngine::Update()
 		return;
 	}
 
+	ZoneScoped;
+
+	// The backend limit follows the voice manager one, which can't ask for more voices than the backend mixes
+	if (const uint32_t maxActiveVoiceCount = m_voiceManager.GetMaxRealVoices() + kUnmanagedVoiceCount; maxActiveVoiceCount != m_maxActiveVoiceCount)
+	{
+		m_maxActiveVoiceCount = maxActiveVoiceCount;
+		m_backend->setMaxActiveVoiceCount(m_maxActiveVoiceCount);
+	}
+
+	bool spatialChanged = false;
+
 	for (const auto& source : m_audioSources)
 	{
-		source.get().Update();
+		spatialChanged |= source.get().Update();
 	}
 
 	// Defines the listener position using the last listener created (If any)
 	const auto listener = FindMainListener();
 
+	std::pair<OvMaths::FVector3, OvMaths::FVector3> listenerState = {
+		OvMaths::FVector3::Zero,
+		{ 0.0f, 0.0f, -1.0f }
+	};
+
 	if (listener.has_value())
 	{
 		const auto& transform = listener->GetTransform();
-		const auto& pos = transform.GetWorldPosition();
-		const auto at = transform.GetWorldForward() * -1.0f;
+		listenerState = { transform.GetWorldPosition(), transform.GetWorldForward() * -1.0f };
+	}
+
+	if (!m_listenerState || m_listenerState->first != listenerState.first || m_listenerState->second != listenerState.second)
+	{
+		const auto& [pos, at] = listenerState;
 		m_backend->set3dListenerPosition(pos.x, pos.y, pos.z);
 		m_backend->set3dListenerAt(at.x, at.y, at.z);
+		m_listenerState = listenerState;
+		spatialChanged = true;
 	}
-	else
+
+	spatialChanged |= m_voiceManager.Update(m_audioSources, listenerState.first);
+
+	// Updating the spatial audio goes through every voice, it is skipped when nothing moved
+	if (spatialChanged)
 	{
-		m_backend->set3dListenerPosition(0.0f, 0.0f, 0.0f);
-		m_backend->set3dListenerAt(0.0f, 0.0f, -1.0f);
+		m_backend->update3dAudio();
 	}
-
-	m_backend->update3dAudio();
 }
 
 void OvAudio::Core::AudioEngine::Suspend()
@@ -124,6 +170,9 @@ std::shared_ptr<OvAudio::Data::SoundInstance> OvAudio::Core::AudioEngine::Play2D
 		return {};
 	}
 
+	// Sounds still loading asynchronously are waited for, rather than silently skipped
+	p_sound.WaitUntilLoaded();
+
 	const auto handle = m_backend->play(
 		*p_sound.audioData,
 		p_volume.value_or(-1.0f),
@@ -152,6 +201,8 @@ std::shared_ptr<OvAudio::Data::SoundInstance> OvAudio::Core::AudioEngine::Play3D
 		return {};
 	}
 
+	p_sound.WaitUntilLoaded();
+
 	const auto handle = m_backend->play3d(
 		*p_sound.audioData,
 		p_position.x, p_position.y, p_position.z,
@@ -186,6 +237,11 @@ SoLoud::Soloud& OvAudio::Core::AudioEngine::GetBackend() const
 	return *m_backend;
 }
 
+OvAudio::Core::VoiceManager& OvAudio::Core::AudioEngine::GetVoiceManager()
+{
+	return m_voiceManager;
+}
+
 void OvAudio::Core::AudioEngine::Consider(OvAudio::Entities::AudioSource & p_audioSource)
 {
 	m_audioSources.push_back(std::ref(p_audioSource));
@@ -228,3 +284,15 @@ void OvAudio::Core::AudioEngine::Unconsider(OvAudio::Entities::AudioListener & p
 	if (found != m_audioListeners.end())
 		m_audioListeners.erase(found);
 }
+
+void OvAudio::Core::AudioEngine::OnSoundDestroyed(Resources::Sound& p_sound)
+{
+	// Virtual sources don't hold a backend voice, they have to be stopped before their sound goes away
+	for (auto& audioSourceRef : m_audioSources)
+	{
+		if (audioSourceRef.get().m_sound == &p_sound)
+		{
+			audioSourceRef.get().Stop();
+		}
+	}
+}
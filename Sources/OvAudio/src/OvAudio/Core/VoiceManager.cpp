@@ -0,0 +1,196 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include <tracy/Tracy.hpp>
+
+#include <OvAudio/Core/VoiceManager.h>
+#include <OvAudio/Entities/AudioSource.h>
+
+namespace
+{
+	// Real voices rank as if they were slightly louder, so two sources of close audibility don't swap their voices every update
+	constexpr float kRealVoiceBias = 1.1f;
+}
+
+void OvAudio::Core::VoiceManager::SetMaxRealVoices(uint32_t p_maxRealVoices)
+{
+	// Capped right away: sources starting to play before the next update already reserve voices against this limit
+	m_maxRealVoices = std::min(p_maxRealVoices, m_realVoiceCap);
+}
+
+uint32_t OvAudio::Core::VoiceManager::GetMaxRealVoices() const
+{
+	return m_maxRealVoices;
+}
+
+void OvAudio::Core::VoiceManager::SetAudibilityThreshold(float p_threshold)
+{
+	m_audibilityThreshold = p_threshold;
+}
+
+float OvAudio::Core::VoiceManager::GetAudibilityThreshold() const
+{
+	return m_audibilityThreshold;
+}
+
+const OvAudio::Core::VoiceManager::Statistics& OvAudio::Core::VoiceManager::GetStatistics() const
+{
+	return m_statistics;
+}
+
+bool OvAudio::Core::VoiceManager::ReserveRealVoice()
+{
+	if (m_reservedVoiceCount >= m_maxRealVoices)
+	{
+		return false;
+	}
+
+	++m_reservedVoiceCount;
+	return true;
+}
+
+void OvAudio::Core::VoiceManager::SetRealVoiceCap(uint32_t p_cap)
+{
+	m_realVoiceCap = p_cap;
+	m_maxRealVoices = std::min(m_maxRealVoices, m_realVoiceCap);
+}
+
+bool OvAudio::Core::VoiceManager::Update(std::span<const std::reference_wrapper<Entities::AudioSource>> p_sources, const OvMaths::FVector3& p_listenerPosition)
+{
+	ZoneScoped;
+
+	// Virtual playback follows the real time, like the mixed voices
+	const auto now = std::chrono::steady_clock::now();
+	const double elapsedTime = std::chrono::duration<double>(now - m_lastUpdate).count();
+	m_lastUpdate = now;
+
+	m_statistics = {};
+	m_candidates.clear();
+
+	uint32_t pausedRealVoiceCount = 0;
+
+	for (const auto& sourceRef : p_sources)
+	{
+		auto& source = sourceRef.get();
+
+		if (!source.m_sound)
+		{
+			continue;
+		}
+
+		if (source.m_instance)
+		{
+			// Real voices that aren't valid anymore reached their end
+			if (!source.m_instance->IsValid())
+			{
+				source.Stop();
+				continue;
+			}
+		}
+		else if (!source.m_paused)
+		{
+			const double length = source.m_sound->GetLength();
+			source.m_playbackPosition += elapsedTime * source.m_pitch;
+
+			if (source.m_playbackPosition >= length)
+			{
+				if (!source.m_looped || length <= 0.0)
+				{
+					source.Stop();
+					continue;
+				}
+
+				source.m_playbackPosition = std::fmod(source.m_playbackPosition, length);
+			}
+		}
+
+		// Paused sources keep their state, real or virtual, until they are resumed
+		if (source.m_paused)
+		{
+			if (source.m_instance)
+			{
+				++pausedRealVoiceCount;
+			}
+			else
+			{
+				++m_statistics.virtualVoiceCount;
+			}
+
+			continue;
+		}
+
+		const float audibility = ComputeAudibility(source, p_listenerPosition);
+
+		if (audibility < m_audibilityThreshold)
+		{
+			if (source.m_instance)
+			{
+				source.StopVoice();
+				++m_statistics.demotedVoiceCount;
+			}
+
+			++m_statistics.virtualVoiceCount;
+			continue;
+		}
+
+		m_candidates.push_back({ &source, source.m_instance ? audibility * kRealVoiceBias : audibility });
+	}
+
+	std::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& p_a, const Candidate& p_b)
+	{
+		if (p_a.source->m_priority != p_b.source->m_priority)
+			return p_a.source->m_priority > p_b.source->m_priority;
+
+		return p_a.audibility > p_b.audibility;
+	});
+
+	const size_t realVoiceBudget = std::min<size_t>(m_maxRealVoices - std::min(m_maxRealVoices, pausedRealVoiceCount), m_candidates.size());
+
+	// Voices are released before being given to other sources, so the limit is never exceeded
+	for (size_t i = realVoiceBudget; i < m_candidates.size(); ++i)
+	{
+		if (m_candidates[i].source->m_instance)
+		{
+			m_candidates[i].source->StopVoice();
+			++m_statistics.demotedVoiceCount;
+		}
+	}
+
+	for (size_t i = 0; i < realVoiceBudget; ++i)
+	{
+		if (!m_candidates[i].source->m_instance)
+		{
+			m_candidates[i].source->StartVoice();
+			++m_statistics.promotedVoiceCount;
+		}
+	}
+
+	m_statistics.realVoiceCount = pausedRealVoiceCount + static_cast<uint32_t>(realVoiceBudget);
+	m_statistics.virtualVoiceCount += static_cast<uint32_t>(m_candidates.size() - realVoiceBudget);
+	m_reservedVoiceCount = m_statistics.realVoiceCount;
+
+	TracyPlot("Audio Voices (Real)", static_cast<int64_t>(m_statistics.realVoiceCount));
+	TracyPlot("Audio Voices (Virtual)", static_cast<int64_t>(m_statistics.virtualVoiceCount));
+
+	return m_statistics.promotedVoiceCount > 0;
+}
+
+float OvAudio::Core::VoiceManager::ComputeAudibility(Entities::AudioSource& p_source, const OvMaths::FVector3& p_listenerPosition) const
+{
+	if (!p_source.m_spatial)
+	{
+		return p_source.m_volume;
+	}
+
+	// Same attenuation as the backend applies to spatial voices (Exponential distance, rolloff factor of 1)
+	const float distance = OvMaths::FVector3::Distance(p_source.GetTransform().GetWorldPosition(), p_listenerPosition);
+	const float threshold = std::max(p_source.m_attenuationThreshold, 0.0001f);
+
+	return distance <= threshold ? p_source.m_volume : p_source.m_volume * threshold / distance;
+}
@@ -112,6 +112,12 @@ void OvAudio::Data::SoundInstance::SetSpatialParameters(
 	}
 }
 
+void OvAudio::Data::SoundInstance::Seek(double p_position)
+{
+	Validate();
+	m_backend.seek(m_handle, p_position);
+}
+
 void OvAudio::Data::SoundInstance::Play()
 {
 	Validate();
@@ -147,6 +153,12 @@ bool OvAudio::Data::SoundInstance::IsSpatial() const
 	return m_spatial;
 }
 
+double OvAudio::Data::SoundInstance::GetPlaybackPosition() const
+{
+	Validate();
+	return m_backend.getStreamPosition(m_handle);
+}
+
 OvAudio::Data::SoundHandle OvAudio::Data::SoundInstance::GetHandle() const
 {
 	return m_handle;
@@ -43,7 +43,13 @@ void OvAudio::Entities::AudioSource::ApplySourceSettingsToTrackedSound()
 
 bool OvAudio::Entities::AudioSource::HasSound() const
 {
-	return m_instance && m_instance->IsValid();
+	// A real sound that isn't valid anymore reached its end
+	return m_sound && (!m_instance || m_instance->IsValid());
+}
+
+bool OvAudio::Entities::AudioSource::IsVirtual() const
+{
+	return m_sound && !m_instance;
 }
 
 bool OvAudio::Entities::AudioSource::IsPlaying() const
@@ -61,17 +67,23 @@ void OvAudio::Entities::AudioSource::SetAttenuationThreshold(float p_distance)
 {
 	m_attenuationThreshold = p_distance;
 
-	if (HasSound())
+	if (m_instance && m_instance->IsValid())
 	{
 		m_instance->SetAttenuationThreshold(m_attenuationThreshold);
+		m_spatialDirty = true;
 	}
 }
 
+void OvAudio::Entities::AudioSource::SetPriority(uint8_t p_priority)
+{
+	m_priority = p_priority;
+}
+
 void OvAudio::Entities::AudioSource::SetVolume(float p_volume)
 {
 	m_volume = p_volume;
 
-	if (HasSound())
+	if (m_instance && m_instance->IsValid())
 	{
 		m_instance->SetVolume(m_volume);
 	}
@@ -81,7 +93,7 @@ void OvAudio::Entities::AudioSource::SetPan(float p_pan)
 {
 	m_pan = p_pan;
 
-	if (HasSound())
+	if (m_instance && m_instance->IsValid())
 	{
 		m_instance->SetPan(m_pan);
 	}
@@ -91,7 +103,7 @@ void OvAudio::Entities::AudioSource::SetLooped(bool p_looped)
 {
 	m_looped = p_looped;
 
-	if (HasSound())
+	if (m_instance && m_instance->IsValid())
 	{
 		m_instance->SetLooped(p_looped);
 	}
@@ -101,7 +113,7 @@ void OvAudio::Entities::AudioSource::SetPitch(float p_pitch)
 {
 	m_pitch = p_pitch;
 
-	if (HasSound())
+	if (m_instance && m_instance->IsValid())
 	{
 		m_instance->SetPitch(p_pitch);
 	}
@@ -110,7 +122,7 @@ void OvAudio::Entities::AudioSource::SetPitch(float p_pitch)
 bool OvAudio::Entities::AudioSource::IsPaused() const
 {
 	OVASSERT(HasSound(), "Cannot check if the sound is paused if no sound is currently being tracked");
-	return m_instance->IsPaused();
+	return m_paused;
 }
 
 std::weak_ptr<OvAudio::Data::SoundInstance> OvAudio::Entities::AudioSource::GetSoundInstance() const
@@ -128,6 +140,11 @@ float OvAudio::Entities::AudioSource::GetAttenuationThreshold() const
 	return m_attenuationThreshold;
 }
 
+uint8_t OvAudio::Entities::AudioSource::GetPriority() const
+{
+	return m_priority;
+}
+
 float OvAudio::Entities::AudioSource::GetVolume() const
 {
 	return m_volume;
@@ -152,47 +169,40 @@ void OvAudio::Entities::AudioSource::Play(const Resources::Sound& p_sound)
 {
 	Stop();
 
-	if (m_spatial)
+	if (!m_engine.IsValid())
 	{
-		m_instance = m_engine.Play3D(
-			p_sound,
-			m_transform->GetWorldPosition(),
-			OvMaths::FVector3::Zero, // TODO: Add support for non-zero velocity
-			m_volume,
-			true
-		);
+		return;
+	}
 
-		if (m_instance)
-		{
-			m_instance->SetAttenuationThreshold(m_attenuationThreshold);
-			m_instance->SetAttenuationModel(
-				Settings::EAttenuationModel::EXPONENTIAL_DISTANCE // TODO: Expose attenuation model
-			);
+	m_sound = &p_sound;
+	m_paused = false;
+	m_playbackPosition = 0.0;
 
-			// Potentially expensive? But necessary so that the settings set above are applied.
+	// Without a free real voice, the sound starts virtual and competes for one on the next update
+	if (m_engine.GetVoiceManager().ReserveRealVoice())
+	{
+		StartVoice();
+
+		if (m_instance && m_instance->IsSpatial())
+		{
+			// Potentially expensive? But necessary so that the settings set in StartVoice are applied.
 			// Otherwise some spatialized sounds may play without attenuation until the next update.
 			// This isn't ideal, but I couldn't find a better way to do it (no `update3dAudio` for a single sound instance).
 			m_engine.GetBackend().update3dAudio();
 		}
 	}
-	else
-	{
-		m_instance = m_engine.Play2D(p_sound, m_pan, m_volume, true);
-	}
-
-	if (m_instance)
-	{
-		m_instance->SetLooped(m_looped);
-		m_instance->SetPitch(m_pitch);
-		m_instance->Play();
-	}
 }
 
 void OvAudio::Entities::AudioSource::Resume()
 {
 	if (HasSound())
 	{
-		m_instance->Play();
+		m_paused = false;
+
+		if (m_instance)
+		{
+			m_instance->Play();
+		}
 	}
 }
 
@@ -200,25 +210,105 @@ void OvAudio::Entities::AudioSource::Pause()
 {
 	if (HasSound())
 	{
-		m_instance->Pause();
+		m_paused = true;
+
+		if (m_instance)
+		{
+			m_instance->Pause();
+		}
 	}
 }
 
 void OvAudio::Entities::AudioSource::Stop()
 {
-	if (HasSound())
+	if (m_instance && m_instance->IsValid())
 	{
 		m_instance->Stop();
 	}
+
+	m_instance.reset();
+	m_sound = nullptr;
 }
 
-void OvAudio::Entities::AudioSource::Update()
+bool OvAudio::Entities::AudioSource::Update()
 {
-	if (HasSound() && m_instance->IsSpatial())
+	if (!m_instance || !m_instance->IsSpatial() || !m_instance->IsValid())
 	{
-		m_instance->SetSpatialParameters(
+		return false;
+	}
+
+	// Sources that didn't move keep the parameters of their voice
+	auto position = m_transform->GetWorldPosition();
+
+	if (!m_spatialDirty && m_spatialPosition && position == *m_spatialPosition)
+	{
+		return false;
+	}
+
+	m_instance->SetSpatialParameters(
+		position,
+		OvMaths::FVector3::Zero // TODO: Add support for non-zero velocity
+	);
+
+	m_spatialPosition = position;
+	m_spatialDirty = false;
+
+	return true;
+}
+
+void OvAudio::Entities::AudioSource::StartVoice()
+{
+	if (m_spatial)
+	{
+		m_instance = m_engine.Play3D(
+			*m_sound,
 			m_transform->GetWorldPosition(),
-			OvMaths::FVector3::Zero // TODO: Add support for non-zero velocity
+			OvMaths::FVector3::Zero, // TODO: Add support for non-zero velocity
+			m_volume,
+			true
 		);
+
+		if (m_instance)
+		{
+			m_instance->SetAttenuationThreshold(m_attenuationThreshold);
+			m_instance->SetAttenuationModel(
+				Settings::EAttenuationModel::EXPONENTIAL_DISTANCE // TODO: Expose attenuation model
+			);
+
+			m_spatialPosition = m_transform->GetWorldPosition();
+			m_spatialDirty = false;
+		}
+	}
+	else
+	{
+		m_instance = m_engine.Play2D(*m_sound, m_pan, m_volume, true);
+	}
+
+	if (m_instance)
+	{
+		m_instance->SetLooped(m_looped);
+		m_instance->SetPitch(m_pitch);
+
+		// Resumed from where the virtual playback got
+		if (m_playbackPosition > 0.0)
+		{
+			m_instance->Seek(m_playbackPosition);
+		}
+
+		if (!m_paused)
+		{
+			m_instance->Play();
+		}
+	}
+}
+
+void OvAudio::Entities::AudioSource::StopVoice()
+{
+	if (m_instance && m_instance->IsValid())
+	{
+		m_playbackPosition = m_instance->GetPlaybackPosition();
+		m_instance->Stop();
 	}
+
+	m_instance.reset();
 }
@@ -4,27 +4,116 @@
 * @licence: MIT
 */
 
+#include <filesystem>
+#include <format>
+
 #include <soloud_wav.h>
+#include <soloud_wavstream.h>
+
+#include <OvDebug/Logger.h>
+#include <OvTools/Utils/ThreadPool.h>
 
 #include <OvAudio/Resources/Loaders/SoundLoader.h>
 
-OvAudio::Resources::Sound* OvAudio::Resources::Loaders::SoundLoader::Create(const std::string& p_filepath)
+namespace
+{
+	bool IsStreamed(const std::string& p_filepath, OvAudio::Settings::ESoundLoadMode p_loadMode)
+	{
+		if (p_loadMode != OvAudio::Settings::ESoundLoadMode::AUTOMATIC)
+			return p_loadMode == OvAudio::Settings::ESoundLoadMode::STREAMED;
+
+		std::error_code error;
+		const uintmax_t fileSize = std::filesystem::file_size(p_filepath, error);
+		return !error && fileSize > OvAudio::Resources::Loaders::SoundLoader::kStreamingThreshold;
+	}
+
+	std::unique_ptr<SoLoud::AudioSource> CreateAudioData(bool p_streamed)
+	{
+		if (p_streamed)
+			return std::make_unique<SoLoud::WavStream>();
+		else
+			return std::make_unique<SoLoud::Wav>();
+	}
+
+	/**
+	* Load the audio data of the sound, and measure it
+	*/
+	void LoadAudioData(OvAudio::Resources::Sound& p_sound, bool p_streamed, const std::string& p_filepath, size_t& p_memoryUsage, double& p_length)
+	{
+		if (p_streamed)
+		{
+			auto& stream = static_cast<SoLoud::WavStream&>(*p_sound.audioData);
+
+			// Playing instances open their own stream of the file
+			if (stream.load(p_filepath.c_str()) != SoLoud::SO_NO_ERROR)
+				OVLOG_ERROR(std::format("Failed to load sound \"{}\"", p_filepath));
+
+			p_memoryUsage = 0;
+			p_length = stream.getLength();
+			return;
+		}
+
+		auto& wav = static_cast<SoLoud::Wav&>(*p_sound.audioData);
+
+		if (wav.load(p_filepath.c_str()) != SoLoud::SO_NO_ERROR)
+			OVLOG_ERROR(std::format("Failed to load sound \"{}\"", p_filepath));
+
+		p_memoryUsage = static_cast<size_t>(wav.mSampleCount) * wav.mChannels * sizeof(float);
+		p_length = wav.getLength();
+	}
+}
+
+OvAudio::Resources::Sound* OvAudio::Resources::Loaders::SoundLoader::Create(const std::string& p_filepath, Settings::ESoundLoadMode p_loadMode)
 {
-	std::unique_ptr<SoLoud::Wav> wav = std::make_unique<SoLoud::Wav>();
-	wav->load(p_filepath.c_str());
-	return new Sound(p_filepath, std::move(wav));
+	const bool streamed = IsStreamed(p_filepath, p_loadMode);
+
+	Sound* sound = new Sound(p_filepath, CreateAudioData(streamed), streamed);
+	LoadAudioData(*sound, streamed, p_filepath, sound->m_memoryUsage, sound->m_length);
+	return sound;
 }
 
-void OvAudio::Resources::Loaders::SoundLoader::Reload(Sound& p_sound, const std::string& p_path)
+OvAudio::Resources::Sound* OvAudio::Resources::Loaders::SoundLoader::CreateAsync(const std::string& p_filepath, Settings::ESoundLoadMode p_loadMode)
 {
+	const bool streamed = IsStreamed(p_filepath, p_loadMode);
+
+	Sound* sound = new Sound(p_filepath, CreateAudioData(streamed), streamed);
+	sound->m_loading = true;
+
+	// The sound can't be destroyed before the worker is done (See Destroy)
+	OvTools::Utils::ThreadPool::GetDefault().Submit([sound, streamed, p_filepath]
+	{
+		LoadAudioData(*sound, streamed, p_filepath, sound->m_memoryUsage, sound->m_length);
+		sound->m_loading.store(false, std::memory_order_release);
+		sound->m_loading.notify_all();
+	});
+
+	return sound;
+}
+
+void OvAudio::Resources::Loaders::SoundLoader::Reload(Sound& p_sound, const std::string& p_path, Settings::ESoundLoadMode p_loadMode)
+{
+	p_sound.WaitUntilLoaded();
+
 	*const_cast<std::string*>(&p_sound.path) = p_path;
-	p_sound.audioData->load(p_path.c_str());
+
+	const bool streamed = IsStreamed(p_path, p_loadMode);
+
+	// Destroying the previous audio data stops its playing instances
+	if (streamed != p_sound.m_streamed)
+	{
+		p_sound.audioData = CreateAudioData(streamed);
+		p_sound.m_streamed = streamed;
+	}
+
+	LoadAudioData(p_sound, streamed, p_path, p_sound.m_memoryUsage, p_sound.m_length);
 }
 
 bool OvAudio::Resources::Loaders::SoundLoader::Destroy(Sound*& p_soundInstance)
 {
 	if (p_soundInstance)
 	{
+		p_soundInstance->WaitUntilLoaded();
+
 		delete p_soundInstance;
 		p_soundInstance = nullptr;
 
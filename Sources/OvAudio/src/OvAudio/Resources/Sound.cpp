@@ -6,10 +6,43 @@
 
 #include <OvAudio/Resources/Sound.h>
 
-#include <soloud_wav.h>
+#include <soloud.h>
 
-OvAudio::Resources::Sound::Sound(const std::string& p_path, std::unique_ptr<SoLoud::Wav>&& p_audioData) :
+OvTools::Eventing::Event<OvAudio::Resources::Sound&> OvAudio::Resources::Sound::DestroyedEvent;
+
+OvAudio::Resources::Sound::Sound(const std::string& p_path, std::unique_ptr<SoLoud::AudioSource>&& p_audioData, bool p_streamed) :
 	path(p_path),
-	audioData(std::move(p_audioData))
+	audioData(std::move(p_audioData)),
+	m_streamed(p_streamed)
+{
+}
+
+OvAudio::Resources::Sound::~Sound()
+{
+	DestroyedEvent.Invoke(*this);
+}
+
+bool OvAudio::Resources::Sound::IsStreamed() const
+{
+	return m_streamed;
+}
+
+bool OvAudio::Resources::Sound::IsLoaded() const
+{
+	return !m_loading.load(std::memory_order_acquire);
+}
+
+void OvAudio::Resources::Sound::WaitUntilLoaded() const
+{
+	m_loading.wait(true, std::memory_order_acquire);
+}
+
+size_t OvAudio::Resources::Sound::GetMemoryUsage() const
+{
+	return IsLoaded() ? m_memoryUsage : 0;
+}
+
+double OvAudio::Resources::Sound::GetLength() const
 {
+	return IsLoaded() ? m_length : 0.0;
 }
@@ -0,0 +1,87 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvBenchmarks/Core/Report.h"
+
+/**
+* Every benchmark runs headless (No window, no graphics context), and is registered in Main.cpp
+*/
+namespace OvBenchmarks::Benchmarks
+{
+	/**
+	* Simulation of many particle systems through the ParticleSimulator
+	* @param p_report
+	*/
+	void Particles(Core::Report& p_report);
+
+	/**
+	* CPU billboard expansion of the particle instance stream, checked against the particle vertex shader
+	* @param p_report
+	*/
+	void ParticleBillboards(Core::Report& p_report);
+
+	/**
+	* Batched raycasts, sweeps and overlaps against a grid of boxes, on a single thread and on the thread pool
+	* @param p_report
+	*/
+	void PhysicsQueries(Core::Report& p_report);
+
+	/**
+	* Simulation of thousands of resting contacts, and contact pair tracking against the previous std::map version
+	* @param p_report
+	*/
+	void PhysicsContacts(Core::Report& p_report);
+
+	/**
+	* Update dispatch of thousands of Lua behaviours, with the real Lua script engine
+	* @param p_report
+	*/
+	void LuaBehaviours(Core::Report& p_report);
+
+	/**
+	* Destruction of scripted actors among a thousand live ones, against reloading the Lua state
+	* @param p_report
+	*/
+	void LuaDestroy(Core::Report& p_report);
+
+	/**
+	* Event invocation and listener management, against the previous std::unordered_map version
+	* @param p_report
+	*/
+	void Events(Core::Report& p_report);
+
+	/**
+	* Throughput of the AsyncLogger for each overflow and flush policy, against synchronous file writes
+	* @param p_report
+	*/
+	void AsyncLogger(Core::Report& p_report);
+
+	/**
+	* Loading of the same scene saved as XML and as binary, and losslessness of the conversions between both formats
+	* @param p_report
+	*/
+	void SceneLoading(Core::Report& p_report);
+
+	/**
+	* Heap usage of the material slots of thousands of material renderers, against the previous fixed slots
+	* @param p_report
+	*/
+	void MaterialSlots(Core::Report& p_report);
+
+	/**
+	* Synchronous and asynchronous sound loading, in each load mode
+	* @param p_report
+	*/
+	void AudioLoading(Core::Report& p_report);
+
+	/**
+	* Voice management of thousands of moving spatial audio sources, mixed by the null audio driver
+	* @param p_report
+	*/
+	void AudioVoices(Core::Report& p_report);
+}
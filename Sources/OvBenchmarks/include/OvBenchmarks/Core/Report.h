@@ -0,0 +1,62 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace OvBenchmarks::Core
+{
+	/**
+	* Prints the results of the benchmarks to the standard output, and counts the failed checks
+	*/
+	class Report
+	{
+	public:
+		/**
+		* Start the section of a benchmark
+		* @param p_name
+		*/
+		void BeginBenchmark(const std::string& p_name);
+
+		/**
+		* Start a group of results inside of the current benchmark (A scenario, or a set of parameters)
+		* @param p_name
+		*/
+		void BeginGroup(const std::string& p_name);
+
+		/**
+		* Print a measured value
+		* @param p_label
+		* @param p_value
+		* @param p_unit
+		*/
+		void AddValue(const std::string& p_label, double p_value, const std::string& p_unit);
+
+		/**
+		* Print a measured time
+		* @param p_label
+		* @param p_milliseconds
+		*/
+		void AddTiming(const std::string& p_label, double p_milliseconds);
+
+		/**
+		* Print the result of a check, a failed check makes the benchmark run fail. Returns the condition
+		* @param p_condition
+		* @param p_description
+		*/
+		bool Check(bool p_condition, const std::string& p_description);
+
+		/**
+		* Returns the number of failed checks
+		*/
+		uint32_t GetFailureCount() const;
+
+	private:
+		uint32_t m_failureCount = 0;
+	};
+}
@@ -0,0 +1,48 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OvBenchmarks::Utils
+{
+	/**
+	* Counts the heap allocations made through the global operator new (Replaced in AllocationHooks.h)
+	*/
+	class AllocationCounter
+	{
+	public:
+		/**
+		* Record an allocation (Called by the global operator new)
+		* @param p_size
+		*/
+		static void Record(size_t p_size);
+
+		/**
+		* Returns the number of allocations since the start of the program
+		*/
+		static uint64_t GetAllocationCount();
+
+		/**
+		* Returns the number of bytes allocated since the start of the program
+		*/
+		static uint64_t GetAllocatedBytes();
+	};
+
+	/**
+	* Returns the number of heap allocations made by a call to the given callable
+	* @param p_callable
+	*/
+	template<typename Callable>
+	uint64_t CountAllocations(Callable&& p_callable)
+	{
+		const uint64_t start = AllocationCounter::GetAllocationCount();
+		p_callable();
+		return AllocationCounter::GetAllocationCount() - start;
+	}
+}
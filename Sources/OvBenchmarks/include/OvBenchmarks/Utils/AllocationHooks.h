@@ -0,0 +1,111 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+/**
+* Replaces the global operator new and delete to count the allocations (See AllocationCounter).
+* Must be included by a single translation unit of the program
+*/
+
+#include <cstdlib>
+#include <new>
+
+#include "OvBenchmarks/Utils/AllocationCounter.h"
+
+// Platform-specific aligned allocations
+#if defined(_WIN32)
+#include <malloc.h>
+#define BENCHMARK_ALIGNED_ALLOC(alignment, size) _aligned_malloc(size, alignment)
+#define BENCHMARK_ALIGNED_FREE(ptr) _aligned_free(ptr)
+#else
+#define BENCHMARK_ALIGNED_ALLOC(alignment, size) aligned_alloc(alignment, size)
+#define BENCHMARK_ALIGNED_FREE(ptr) free(ptr)
+#endif
+
+void* operator new(std::size_t count)
+{
+	OvBenchmarks::Utils::AllocationCounter::Record(count);
+
+	if (auto ptr = malloc(count))
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+	free(ptr);
+}
+
+void* operator new[](std::size_t count)
+{
+	OvBenchmarks::Utils::AllocationCounter::Record(count);
+
+	if (auto ptr = malloc(count))
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	free(ptr);
+}
+
+void* operator new(std::size_t count, std::align_val_t alignment)
+{
+	OvBenchmarks::Utils::AllocationCounter::Record(count);
+
+	size_t alignedSize = (count + static_cast<size_t>(alignment) - 1) & ~(static_cast<size_t>(alignment) - 1);
+
+	if (auto ptr = BENCHMARK_ALIGNED_ALLOC(static_cast<size_t>(alignment), alignedSize))
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	BENCHMARK_ALIGNED_FREE(ptr);
+}
+
+void* operator new[](std::size_t count, std::align_val_t alignment)
+{
+	OvBenchmarks::Utils::AllocationCounter::Record(count);
+
+	size_t alignedSize = (count + static_cast<size_t>(alignment) - 1) & ~(static_cast<size_t>(alignment) - 1);
+
+	if (auto ptr = BENCHMARK_ALIGNED_ALLOC(static_cast<size_t>(alignment), alignedSize))
+		return ptr;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+	BENCHMARK_ALIGNED_FREE(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	BENCHMARK_ALIGNED_FREE(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	BENCHMARK_ALIGNED_FREE(ptr);
+}
@@ -0,0 +1,42 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace OvBenchmarks::Utils
+{
+	/**
+	* Returns the time taken by a call to the given callable, in milliseconds
+	* @param p_callable
+	*/
+	template<typename Callable>
+	double Measure(Callable&& p_callable)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		p_callable();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	/**
+	* Returns the average time taken by a call to the given callable over the given number of calls, in milliseconds
+	* @param p_iterations
+	* @param p_callable
+	*/
+	template<typename Callable>
+	double MeasureAverage(uint32_t p_iterations, Callable&& p_callable)
+	{
+		const double total = Measure([&]
+		{
+			for (uint32_t i = 0; i < p_iterations; ++i)
+				p_callable();
+		});
+
+		return p_iterations > 0 ? total / p_iterations : 0.0;
+	}
+}
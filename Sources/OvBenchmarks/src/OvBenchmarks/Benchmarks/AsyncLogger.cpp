@@ -0,0 +1,162 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OvDebug/AsyncLogger.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	constexpr uint32_t kLogsPerProducer = 100000;
+	const std::string kHandlerId = "benchmark";
+	const std::string kMessage = "Loaded resource \"Models/Environment/Rock_03.fbx\" (14 meshes, 2 materials)";
+
+	struct FlushPolicy
+	{
+		std::string name;
+		std::chrono::milliseconds flushInterval;
+		OvDebug::ELogLevel flushLevel;
+	};
+
+	const FlushPolicy kFlushPolicies[] = {
+		{ "flush every 100 ms", std::chrono::milliseconds{ 100 }, OvDebug::ELogLevel::LOG_ERROR },
+		{ "flush every batch", std::chrono::milliseconds{ 100 }, OvDebug::ELogLevel::LOG_INFO }
+	};
+
+	/**
+	* Log file written by the benchmark, removed once done
+	*/
+	class LogFile
+	{
+	public:
+		LogFile() : m_path(std::filesystem::temp_directory_path() / "OvBenchmarks.log"), stream(m_path, std::ios::trunc)
+		{
+		}
+
+		~LogFile()
+		{
+			stream.close();
+
+			std::error_code error;
+			std::filesystem::remove(m_path, error);
+		}
+
+	private:
+		const std::filesystem::path m_path;
+
+	public:
+		std::ofstream stream;
+	};
+
+	template<typename Push>
+	double RunProducers(uint32_t p_producerCount, Push p_push)
+	{
+		return OvBenchmarks::Utils::Measure([&]
+		{
+			std::vector<std::thread> producers;
+
+			for (uint32_t producer = 0; producer < p_producerCount; ++producer)
+			{
+				producers.emplace_back([&p_push]
+				{
+					for (uint32_t i = 0; i < kLogsPerProducer; ++i)
+						p_push();
+				});
+			}
+
+			for (auto& producer : producers)
+				producer.join();
+		});
+	}
+
+	void RunAsync(OvBenchmarks::Core::Report& p_report, OvDebug::ELogOverflowPolicy p_overflowPolicy, const FlushPolicy& p_flushPolicy, uint32_t p_producerCount)
+	{
+		LogFile file;
+		uint64_t written = 0;
+		uint64_t flushes = 0;
+
+		OvDebug::AsyncLoggerSettings settings;
+		settings.overflowPolicy = p_overflowPolicy;
+		settings.flushInterval = p_flushPolicy.flushInterval;
+		settings.flushLevel = p_flushPolicy.flushLevel;
+
+		OvDebug::AsyncLogger logger(settings,
+			[&file, &written](const OvDebug::LogRecord& p_record)
+			{
+				file.stream << "[INFO] " << p_record.message << '\n';
+
+				if (p_record.handlerId == kHandlerId)
+					++written;
+			},
+			[&file, &flushes]
+			{
+				file.stream.flush();
+				++flushes;
+			}
+		);
+
+		const double pushTime = RunProducers(p_producerCount, [&logger]
+		{
+			logger.Push(kMessage, OvDebug::ELogLevel::LOG_INFO, OvDebug::ELogMode::FILE, kHandlerId);
+		});
+
+		const double flushTime = OvBenchmarks::Utils::Measure([&logger] { logger.Flush(); });
+
+		const uint64_t pushed = static_cast<uint64_t>(kLogsPerProducer) * p_producerCount;
+
+		p_report.BeginGroup(std::format("{}, {}, {} producer(s)", p_overflowPolicy == OvDebug::ELogOverflowPolicy::DROP ? "DROP" : "BLOCK", p_flushPolicy.name, p_producerCount));
+		p_report.AddValue("Push throughput", pushed / pushTime / 1000.0, "Mlogs/s");
+		p_report.AddValue("Push latency", pushTime * 1e6 / kLogsPerProducer, "ns");
+		p_report.AddTiming("Remaining flush", flushTime);
+		p_report.AddValue("Dropped", static_cast<double>(logger.GetDroppedCount()), "logs");
+		p_report.AddValue("Flushes", static_cast<double>(flushes), "");
+		p_report.Check(written + logger.GetDroppedCount() == pushed, "Every log is written or reported as dropped");
+
+		if (p_overflowPolicy == OvDebug::ELogOverflowPolicy::BLOCK)
+			p_report.Check(logger.GetDroppedCount() == 0, "BLOCK doesn't drop logs");
+	}
+
+	void RunSynchronous(OvBenchmarks::Core::Report& p_report, uint32_t p_producerCount)
+	{
+		LogFile file;
+		std::mutex mutex;
+
+		const double pushTime = RunProducers(p_producerCount, [&file, &mutex]
+		{
+			std::lock_guard lock(mutex);
+			file.stream << "[INFO] " << kMessage << std::endl;
+		});
+
+		const uint64_t pushed = static_cast<uint64_t>(kLogsPerProducer) * p_producerCount;
+
+		p_report.BeginGroup(std::format("Synchronous write, flush per log (Baseline), {} producer(s)", p_producerCount));
+		p_report.AddValue("Push throughput", pushed / pushTime / 1000.0, "Mlogs/s");
+		p_report.AddValue("Push latency", pushTime * 1e6 / kLogsPerProducer, "ns");
+	}
+}
+
+void OvBenchmarks::Benchmarks::AsyncLogger(Core::Report& p_report)
+{
+	for (const uint32_t producerCount : { 1u, 4u })
+	{
+		RunSynchronous(p_report, producerCount);
+
+		for (const auto overflowPolicy : { OvDebug::ELogOverflowPolicy::DROP, OvDebug::ELogOverflowPolicy::BLOCK })
+		{
+			for (const auto& flushPolicy : kFlushPolicies)
+				RunAsync(p_report, overflowPolicy, flushPolicy, producerCount);
+		}
+	}
+}
@@ -0,0 +1,269 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <soloud.h>
+
+#include <OvAudio/Core/AudioEngine.h>
+#include <OvAudio/Entities/AudioSource.h>
+#include <OvAudio/Resources/Loaders/SoundLoader.h>
+#include <OvCore/ResourceManagement/SoundManager.h>
+#include <OvMaths/FTransform.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	constexpr uint32_t kSampleRate = 44100;
+	constexpr uint32_t kFrameSampleCount = kSampleRate / 60;
+
+	/**
+	* Writes a 16 bits mono sine wave to a temporary WAV file, removed on destruction
+	*/
+	class SoundFile
+	{
+	public:
+		SoundFile(const std::string& p_name, double p_duration) :
+			m_folder(std::filesystem::temp_directory_path() / "OvBenchmarks" / "Sounds"),
+			path((m_folder / p_name).string())
+		{
+			std::filesystem::create_directories(m_folder);
+
+			const uint32_t sampleCount = static_cast<uint32_t>(p_duration * kSampleRate);
+			const uint32_t dataSize = sampleCount * sizeof(int16_t);
+
+			std::ofstream file(path, std::ios::binary);
+
+			const auto write = [&file](auto p_value)
+			{
+				file.write(reinterpret_cast<const char*>(&p_value), sizeof(p_value));
+			};
+
+			file.write("RIFF", 4);
+			write(uint32_t{ 36 + dataSize });
+			file.write("WAVEfmt ", 8);
+			write(uint32_t{ 16 });
+			write(uint16_t{ 1 });	// PCM
+			write(uint16_t{ 1 });	// Mono
+			write(kSampleRate);
+			write(uint32_t{ kSampleRate * sizeof(int16_t) });
+			write(uint16_t{ sizeof(int16_t) });
+			write(uint16_t{ 16 });
+			file.write("data", 4);
+			write(dataSize);
+
+			for (uint32_t i = 0; i < sampleCount; ++i)
+				write(static_cast<int16_t>(8000.0 * std::sin(2.0 * std::numbers::pi * 440.0 * i / kSampleRate)));
+		}
+
+		~SoundFile()
+		{
+			std::error_code error;
+			std::filesystem::remove(path, error);
+		}
+
+	private:
+		const std::filesystem::path m_folder;
+
+	public:
+		const std::string path;
+	};
+
+	/**
+	* Decoded size of a sound written by SoundFile
+	*/
+	size_t GetDecodedSize(double p_duration)
+	{
+		return static_cast<size_t>(p_duration * kSampleRate) * sizeof(float);
+	}
+
+	void RunLoading(OvBenchmarks::Core::Report& p_report, const std::string& p_path, double p_duration, OvAudio::Settings::ESoundLoadMode p_loadMode, bool p_expectStreamed)
+	{
+		using namespace OvAudio::Resources;
+
+		Sound* sound = nullptr;
+
+		const double createTime = OvBenchmarks::Utils::Measure([&]
+		{
+			sound = Loaders::SoundLoader::Create(p_path, p_loadMode);
+		});
+
+		Loaders::SoundLoader::Destroy(sound);
+
+		const double createAsyncTime = OvBenchmarks::Utils::Measure([&]
+		{
+			sound = Loaders::SoundLoader::CreateAsync(p_path, p_loadMode);
+		});
+
+		const double waitTime = OvBenchmarks::Utils::Measure([&]
+		{
+			sound->WaitUntilLoaded();
+		});
+
+		const bool loaded = sound->IsLoaded();
+		const bool streamed = sound->IsStreamed();
+		const size_t memoryUsage = sound->GetMemoryUsage();
+		const double length = sound->GetLength();
+		const bool destroyed = Loaders::SoundLoader::Destroy(sound);
+
+		// Destroying a sound still loading has to wait for its worker
+		sound = Loaders::SoundLoader::CreateAsync(p_path, p_loadMode);
+		const bool destroyedWhileLoading = Loaders::SoundLoader::Destroy(sound) && !sound;
+
+		p_report.BeginGroup(std::format("{} s sound, {} load mode", p_duration,
+			p_loadMode == OvAudio::Settings::ESoundLoadMode::DECOMPRESSED ? "decompressed" :
+			p_loadMode == OvAudio::Settings::ESoundLoadMode::STREAMED ? "streamed" : "automatic"));
+		p_report.AddTiming("SoundLoader::Create", createTime);
+		p_report.AddTiming("SoundLoader::CreateAsync (Returning)", createAsyncTime);
+		p_report.AddTiming("Sound::WaitUntilLoaded", waitTime);
+		p_report.AddValue("Memory usage", static_cast<double>(memoryUsage) / 1024.0, "KiB");
+		p_report.Check(loaded, "The sound is loaded once waited for");
+		p_report.Check(streamed == p_expectStreamed, p_expectStreamed ? "The sound is streamed" : "The sound is decompressed");
+		p_report.Check(memoryUsage == (p_expectStreamed ? 0 : GetDecodedSize(p_duration)), "The memory usage is the decoded audio data");
+		p_report.Check(std::abs(length - p_duration) < 0.01, "The length is the duration of the file");
+		p_report.Check(destroyed && !sound, "SoundLoader::Destroy releases the sound");
+		p_report.Check(destroyedWhileLoading, "SoundLoader::Destroy releases a sound still loading");
+	}
+
+	void RunVoices(OvBenchmarks::Core::Report& p_report, const std::string& p_soundPath, uint32_t p_sourceCount, bool p_allReal)
+	{
+		constexpr uint32_t kFrameCount = 120;
+		constexpr float kSceneSize = 120.0f;
+
+		OvAudio::Core::AudioEngine engine(true);
+
+		if (!engine.IsValid())
+		{
+			p_report.Check(false, "The audio engine starts on the null driver");
+			return;
+		}
+
+		// The backend data of a sound refers to the engine that played it, the sound can't outlive it
+		auto sound = OvAudio::Resources::Loaders::SoundLoader::Create(p_soundPath, OvAudio::Settings::ESoundLoadMode::DECOMPRESSED);
+		auto& voiceManager = engine.GetVoiceManager();
+
+		if (p_allReal)
+			voiceManager.SetMaxRealVoices(p_sourceCount);
+
+		// Sources keep a reference to their transform, the storage never grows once they are created
+		std::vector<OvMaths::FTransform> transforms(p_sourceCount);
+		std::vector<std::unique_ptr<OvAudio::Entities::AudioSource>> sources;
+		sources.reserve(p_sourceCount);
+
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> distribution(-kSceneSize * 0.5f, kSceneSize * 0.5f);
+
+		for (auto& transform : transforms)
+		{
+			transform.SetLocalPosition({ distribution(generator), 0.0f, distribution(generator) });
+
+			auto& source = *sources.emplace_back(std::make_unique<OvAudio::Entities::AudioSource>(engine, transform));
+			source.SetLooped(true);
+			source.SetSpatial(true);
+			source.Play(*sound);
+		}
+
+		std::vector<float> mixBuffer(kFrameSampleCount * engine.GetBackend().getBackendChannels());
+		double mixTime = 0.0;
+
+		const double frameTime = OvBenchmarks::Utils::MeasureAverage(kFrameCount, [&]
+		{
+			// Every source moves, so their audibility (And rank) changes each frame
+			for (auto& transform : transforms)
+				transform.SetLocalPosition(transform.GetLocalPosition() + OvMaths::FVector3{ 0.05f, 0.0f, 0.0f });
+
+			engine.Update();
+			mixTime += OvBenchmarks::Utils::Measure([&]
+			{
+				engine.GetBackend().mix(mixBuffer.data(), kFrameSampleCount);
+			});
+		});
+
+		const double mixTimePerFrame = mixTime / kFrameCount;
+
+		const auto& statistics = voiceManager.GetStatistics();
+		const uint32_t maxRealVoices = voiceManager.GetMaxRealVoices();
+
+		p_report.BeginGroup(std::format("{} sources, {}", p_sourceCount, p_allReal ? "as many real voices as possible" : "default real voice limit"));
+		p_report.AddValue("Real voice limit", maxRealVoices, "");
+		p_report.AddValue("Real voices", statistics.realVoiceCount, "");
+		p_report.AddValue("Virtual voices", statistics.virtualVoiceCount, "");
+		p_report.AddValue("Promoted on the last frame", statistics.promotedVoiceCount, "");
+		p_report.AddValue("Demoted on the last frame", statistics.demotedVoiceCount, "");
+		p_report.AddTiming("AudioEngine::Update() per frame", frameTime - mixTimePerFrame);
+		p_report.AddTiming("Mix per frame", mixTimePerFrame);
+		p_report.AddValue("Active backend voices", engine.GetBackend().getActiveVoiceCount(), "");
+		p_report.Check(statistics.realVoiceCount <= maxRealVoices, "The real voice limit is respected");
+		p_report.Check(statistics.realVoiceCount == std::min(maxRealVoices, p_sourceCount), "Every available real voice is used");
+		p_report.Check(statistics.realVoiceCount + statistics.virtualVoiceCount == p_sourceCount, "Every source is either real or virtual");
+		p_report.Check(engine.GetBackend().getActiveVoiceCount() <= statistics.realVoiceCount, "The backend mixes the real voices only");
+
+		// Sources are destroyed before the engine they unregister from
+		sources.clear();
+		OvAudio::Resources::Loaders::SoundLoader::Destroy(sound);
+	}
+}
+
+void OvBenchmarks::Benchmarks::AudioLoading(Core::Report& p_report)
+{
+	using OvAudio::Settings::ESoundLoadMode;
+
+	// Long enough to be streamed by the automatic load mode (See SoundLoader::kStreamingThreshold)
+	constexpr double kShortDuration = 2.0;
+	constexpr double kLongDuration = 15.0;
+
+	SoundFile shortFile("Short.wav", kShortDuration);
+	SoundFile longFile("Long.wav", kLongDuration);
+
+	RunLoading(p_report, shortFile.path, kShortDuration, ESoundLoadMode::DECOMPRESSED, false);
+	RunLoading(p_report, shortFile.path, kShortDuration, ESoundLoadMode::STREAMED, true);
+	RunLoading(p_report, shortFile.path, kShortDuration, ESoundLoadMode::AUTOMATIC, false);
+	RunLoading(p_report, longFile.path, kLongDuration, ESoundLoadMode::DECOMPRESSED, false);
+	RunLoading(p_report, longFile.path, kLongDuration, ESoundLoadMode::AUTOMATIC, true);
+
+	// The sounds have no meta file, the sound manager loads them with the automatic load mode
+	const auto folder = std::filesystem::path(shortFile.path).parent_path();
+	OvCore::ResourceManagement::SoundManager::ProvideAssetPaths(folder, folder);
+
+	OvCore::ResourceManagement::SoundManager manager;
+	auto shortSound = manager.LoadResourceAsync("Short.wav");
+	auto longSound = manager.LoadResourceAsync("Long.wav");
+	const bool shared = manager.LoadResourceAsync("Short.wav") == shortSound;
+
+	shortSound->WaitUntilLoaded();
+	longSound->WaitUntilLoaded();
+
+	p_report.BeginGroup("SoundManager::LoadResourceAsync");
+	p_report.AddValue("Memory usage", static_cast<double>(manager.GetMemoryUsage()) / 1024.0, "KiB");
+	p_report.Check(shared, "A registered sound is loaded once");
+	p_report.Check(manager.IsResourceRegistered("Short.wav") && manager.IsResourceRegistered("Long.wav"), "The sounds are registered right away");
+	p_report.Check(!shortSound->IsStreamed() && longSound->IsStreamed(), "Large sounds are streamed");
+	p_report.Check(manager.GetMemoryUsage() == GetDecodedSize(kShortDuration), "The memory usage is the one of the decompressed sound");
+
+	manager.UnloadResources();
+}
+
+void OvBenchmarks::Benchmarks::AudioVoices(Core::Report& p_report)
+{
+	SoundFile file("Voices.wav", 2.0);
+
+	for (const uint32_t sourceCount : { 64u, 239u, 512u, 2048u })
+	{
+		RunVoices(p_report, file.path, sourceCount, false);
+		RunVoices(p_report, file.path, sourceCount, true);
+	}
+}
@@ -0,0 +1,141 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <format>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <OvTools/Eventing/Event.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/AllocationCounter.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	/**
+	* Event implementation before the delegates (Kept as the baseline): listeners are std::function,
+	* stored in a hash map keyed by their ID
+	*/
+	template<class... ArgTypes>
+	class LegacyEvent
+	{
+	public:
+		using Callback = std::function<void(ArgTypes...)>;
+
+		OvTools::Eventing::ListenerID AddListener(Callback p_callback)
+		{
+			OvTools::Eventing::ListenerID listenerID = m_availableListenerID++;
+			m_callbacks.emplace(listenerID, p_callback);
+			return listenerID;
+		}
+
+		bool RemoveListener(OvTools::Eventing::ListenerID p_listenerID)
+		{
+			return m_callbacks.erase(p_listenerID) != 0;
+		}
+
+		void Invoke(ArgTypes... p_args)
+		{
+			for (auto const& [key, value] : m_callbacks)
+				value(p_args...);
+		}
+
+	private:
+		std::unordered_map<OvTools::Eventing::ListenerID, Callback> m_callbacks;
+		OvTools::Eventing::ListenerID m_availableListenerID = 0;
+	};
+
+	struct Receiver
+	{
+		void OnEvent(int p_value)
+		{
+			sum += p_value;
+		}
+
+		uint64_t sum = 0;
+	};
+
+	struct Results
+	{
+		double invokeTime = 0.0;	// Nanoseconds per listener call
+		double addAllocations = 0.0;	// Per added listener
+		uint64_t invokeAllocations = 0;
+		double addRemoveTime = 0.0;	// Nanoseconds per lambda listener added then removed
+		uint64_t sum = 0;
+	};
+
+	/**
+	* Half of the listeners are member functions bound to an instance, the other half are lambdas
+	*/
+	template<typename EventType>
+	Results Run(uint32_t p_listenerCount)
+	{
+		constexpr uint32_t kCallCount = 1 << 21;
+		constexpr uint32_t kAddRemoveCount = 1 << 16;
+
+		Results results;
+		Receiver receiver;
+		uint64_t lambdaSum = 0;
+		EventType event;
+
+		const uint64_t addAllocations = OvBenchmarks::Utils::CountAllocations([&]
+		{
+			for (uint32_t i = 0; i < p_listenerCount; ++i)
+			{
+				if (i % 2 == 0)
+					event.AddListener(std::bind(&Receiver::OnEvent, &receiver, std::placeholders::_1));
+				else
+					event.AddListener([&lambdaSum](int p_value) { lambdaSum += p_value; });
+			}
+		});
+
+		const uint32_t invokeCount = kCallCount / p_listenerCount;
+		double invokeTime = 0.0;
+
+		results.invokeAllocations = OvBenchmarks::Utils::CountAllocations([&]
+		{
+			invokeTime = OvBenchmarks::Utils::Measure([&]
+			{
+				for (uint32_t i = 0; i < invokeCount; ++i)
+					event.Invoke(1);
+			});
+		});
+
+		const double addRemoveTime = OvBenchmarks::Utils::Measure([&]
+		{
+			for (uint32_t i = 0; i < kAddRemoveCount; ++i)
+				event.RemoveListener(event.AddListener([&lambdaSum](int p_value) { lambdaSum += p_value; }));
+		});
+
+		results.invokeTime = invokeTime * 1e6 / (static_cast<double>(invokeCount) * p_listenerCount);
+		results.addAllocations = static_cast<double>(addAllocations) / p_listenerCount;
+		results.addRemoveTime = addRemoveTime * 1e6 / kAddRemoveCount;
+		results.sum = receiver.sum + lambdaSum;
+
+		return results;
+	}
+}
+
+void OvBenchmarks::Benchmarks::Events(Core::Report& p_report)
+{
+	for (const uint32_t listenerCount : { 1u, 16u, 64u, 256u })
+	{
+		const Results legacy = Run<LegacyEvent<int>>(listenerCount);
+		const Results current = Run<OvTools::Eventing::Event<int>>(listenerCount);
+
+		p_report.BeginGroup(std::format("{} listener(s)", listenerCount));
+		p_report.AddValue("Invoke, std::unordered_map (Baseline)", legacy.invokeTime, "ns/call");
+		p_report.AddValue("Invoke, Event", current.invokeTime, "ns/call");
+		p_report.AddValue("Allocations per listener, std::unordered_map", legacy.addAllocations, "");
+		p_report.AddValue("Allocations per listener, Event", current.addAllocations, "");
+		p_report.AddValue("Add and remove, std::unordered_map", legacy.addRemoveTime, "ns");
+		p_report.AddValue("Add and remove, Event", current.addRemoveTime, "ns");
+		p_report.Check(legacy.sum == current.sum, "Both call every listener");
+		p_report.Check(current.invokeAllocations == 0, "Event::Invoke doesn't allocate");
+	}
+}
@@ -0,0 +1,185 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <OvCore/ECS/Actor.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/SceneSystem/Scene.h>
+#include <OvCore/Scripting/Lua/LuaProfiler.h>
+#include <OvCore/Scripting/ScriptEngine.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+
+	const std::vector<std::pair<std::string, std::string>> kScripts = {
+		{ "UpdateOnly",
+			"local UpdateOnly = { elapsed = 0 }\n"
+			"function UpdateOnly:OnUpdate(deltaTime)\n"
+			"	self.elapsed = self.elapsed + deltaTime\n"
+			"end\n"
+			"return UpdateOnly\n"
+		},
+		{ "StartOnly",
+			"local StartOnly = { started = false }\n"
+			"function StartOnly:OnStart()\n"
+			"	self.started = true\n"
+			"end\n"
+			"return StartOnly\n"
+		}
+	};
+
+	/**
+	* Writes the benchmark scripts to a temporary folder, and provides a Lua script engine loading them
+	*/
+	class ScriptingContext
+	{
+	public:
+		ScriptingContext() : m_folder(std::filesystem::temp_directory_path() / "OvBenchmarks" / "Scripts")
+		{
+			std::filesystem::create_directories(m_folder);
+
+			for (const auto& [name, source] : kScripts)
+				std::ofstream(m_folder / (name + ".lua")) << source;
+
+			scriptEngine.SetScriptRootFolder(m_folder);
+			OvCore::Global::ServiceLocator::Provide<OvCore::Scripting::ScriptEngine>(scriptEngine);
+		}
+
+		~ScriptingContext()
+		{
+			std::error_code error;
+			std::filesystem::remove_all(m_folder, error);
+		}
+
+	private:
+		const std::filesystem::path m_folder;
+
+	public:
+		OvCore::Scripting::ScriptEngine scriptEngine;
+	};
+
+	uint64_t GetHookCallCount(OvCore::Scripting::LuaProfiler& p_profiler, const std::string& p_script, OvCore::Scripting::ELuaHook p_hook)
+	{
+		const auto& statistics = p_profiler.GetScriptStatistics();
+		const auto found = statistics.find(p_script);
+		return found != statistics.end() ? found->second[static_cast<size_t>(p_hook)].callCount : 0;
+	}
+
+	void RunUpdate(OvBenchmarks::Core::Report& p_report, uint32_t p_updatingCount, uint32_t p_idleCount)
+	{
+		constexpr uint32_t kFrameCount = 200;
+
+		ScriptingContext context;
+
+		// The scene is destroyed before the script engine, as its behaviours unregister from it
+		{
+			OvCore::SceneSystem::Scene scene;
+
+			for (uint32_t i = 0; i < p_updatingCount; ++i)
+				scene.CreateActor().AddBehaviour("UpdateOnly");
+
+			for (uint32_t i = 0; i < p_idleCount; ++i)
+				scene.CreateActor().AddBehaviour("StartOnly");
+
+			scene.Play();
+
+			const double frameTime = OvBenchmarks::Utils::MeasureAverage(kFrameCount, [&scene, &context]
+			{
+				scene.Update(kDeltaTime);
+				context.scriptEngine.Update(kDeltaTime);
+			});
+
+			// A profiled frame counts the hooks actually called
+			auto& profiler = context.scriptEngine.GetProfiler();
+			profiler.ResetStatistics();
+			profiler.SetEnabled(true);
+			scene.Update(kDeltaTime);
+			profiler.SetEnabled(false);
+
+			p_report.BeginGroup(std::format("{} behaviours implementing OnUpdate, {} without update hooks", p_updatingCount, p_idleCount));
+			p_report.AddTiming("Scene::Update() per frame", frameTime);
+			p_report.AddValue("Time per updated behaviour", p_updatingCount > 0 ? frameTime * 1e6 / p_updatingCount : 0.0, "ns");
+			p_report.Check(context.scriptEngine.IsOk(), "Every script registered");
+			p_report.Check(GetHookCallCount(profiler, "UpdateOnly", OvCore::Scripting::ELuaHook::UPDATE) == p_updatingCount, "OnUpdate called once per behaviour");
+			p_report.Check(GetHookCallCount(profiler, "StartOnly", OvCore::Scripting::ELuaHook::UPDATE) == 0, "Behaviours without OnUpdate are skipped");
+		}
+	}
+
+	void RunDestroy(OvBenchmarks::Core::Report& p_report, uint32_t p_actorCount)
+	{
+		constexpr uint32_t kDestroyCount = 50;
+		constexpr uint32_t kReloadCount = 10;
+
+		ScriptingContext context;
+
+		{
+			OvCore::SceneSystem::Scene scene;
+
+			std::vector<OvCore::ECS::Actor*> actors;
+			actors.reserve(p_actorCount);
+
+			for (uint32_t i = 0; i < p_actorCount; ++i)
+			{
+				auto& actor = scene.CreateActor();
+				actor.AddBehaviour("UpdateOnly");
+				actors.push_back(&actor);
+			}
+
+			scene.Play();
+			scene.Update(kDeltaTime);
+
+			// Removing a behaviour used to reload the whole Lua state, kept as the baseline
+			const double reloadTime = OvBenchmarks::Utils::MeasureAverage(kReloadCount, [&context]
+			{
+				context.scriptEngine.Reload();
+			});
+
+			double destroyTime = 0.0;
+
+			for (uint32_t i = 0; i < kDestroyCount; ++i)
+			{
+				destroyTime += OvBenchmarks::Utils::Measure([&scene, actor = actors[i]]
+				{
+					scene.DestroyActor(*actor);
+				});
+			}
+
+			auto& profiler = context.scriptEngine.GetProfiler();
+			profiler.ResetStatistics();
+			profiler.SetEnabled(true);
+			scene.Update(kDeltaTime);
+			profiler.SetEnabled(false);
+
+			p_report.BeginGroup(std::format("Destroy {} of {} live scripted actors", kDestroyCount, p_actorCount));
+			p_report.AddTiming("Reload per destroy (Baseline)", reloadTime);
+			p_report.AddTiming("Destroy", destroyTime / kDestroyCount);
+			p_report.AddValue("Speedup", destroyTime > 0.0 ? reloadTime * kDestroyCount / destroyTime : 0.0, "x");
+			p_report.Check(context.scriptEngine.IsOk(), "Every script is still registered");
+			p_report.Check(GetHookCallCount(profiler, "UpdateOnly", OvCore::Scripting::ELuaHook::UPDATE) == p_actorCount - kDestroyCount, "The remaining behaviours keep updating");
+		}
+	}
+}
+
+void OvBenchmarks::Benchmarks::LuaBehaviours(Core::Report& p_report)
+{
+	RunUpdate(p_report, 5000, 0);
+	RunUpdate(p_report, 5000, 5000);
+}
+
+void OvBenchmarks::Benchmarks::LuaDestroy(Core::Report& p_report)
+{
+	RunDestroy(p_report, 1000);
+}
@@ -0,0 +1,116 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <OvCore/ECS/Actor.h>
+#include <OvCore/ECS/Components/CMaterialRenderer.h>
+#include <OvCore/Resources/Material.h>
+#include <OvCore/SceneSystem/Scene.h>
+#include <OvUI/Widgets/AWidget.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/AllocationCounter.h"
+
+namespace
+{
+	/**
+	* Slot storage of the CMaterialRenderer before the slots were sized to the model (Kept as the baseline):
+	* every component held the materials, inspector widgets and names of kMaxMaterialCount slots
+	*/
+	struct LegacyMaterialSlots
+	{
+		std::array<OvCore::Resources::Material*, kMaxMaterialCount> materials;
+		std::array<std::array<OvUI::Widgets::AWidget*, 3>, kMaxMaterialCount> materialFields;
+		std::array<std::string, kMaxMaterialCount> materialNames;
+	};
+
+	struct HeapUsage
+	{
+		uint64_t allocations = 0;
+		uint64_t bytes = 0;
+	};
+
+	template<typename Callable>
+	HeapUsage MeasureHeapUsage(Callable&& p_callable)
+	{
+		using OvBenchmarks::Utils::AllocationCounter;
+
+		const uint64_t allocations = AllocationCounter::GetAllocationCount();
+		const uint64_t bytes = AllocationCounter::GetAllocatedBytes();
+		p_callable();
+		return { AllocationCounter::GetAllocationCount() - allocations, AllocationCounter::GetAllocatedBytes() - bytes };
+	}
+
+	void RunSlots(OvBenchmarks::Core::Report& p_report, uint32_t p_actorCount, uint32_t p_slotCount)
+	{
+		OvCore::SceneSystem::Scene scene;
+		OvCore::Resources::Material material;
+
+		std::vector<OvCore::ECS::Actor*> actors;
+		actors.reserve(p_actorCount);
+
+		for (uint32_t i = 0; i < p_actorCount; ++i)
+			actors.push_back(&scene.CreateActor());
+
+		// Slots are assigned one by one, as when the model isn't known yet (Deserialization, default actors)
+		const HeapUsage current = MeasureHeapUsage([&]
+		{
+			for (auto actor : actors)
+			{
+				auto& materialRenderer = actor->AddComponent<OvCore::ECS::Components::CMaterialRenderer>();
+
+				for (uint32_t i = 0; i < p_slotCount; ++i)
+					materialRenderer.SetMaterialAtIndex(static_cast<uint8_t>(i), material);
+			}
+		});
+
+		std::vector<std::unique_ptr<LegacyMaterialSlots>> legacySlots;
+		legacySlots.reserve(p_actorCount);
+
+		const HeapUsage legacy = MeasureHeapUsage([&]
+		{
+			for (uint32_t i = 0; i < p_actorCount; ++i)
+			{
+				auto& slots = *legacySlots.emplace_back(std::make_unique<LegacyMaterialSlots>());
+				slots.materials.fill(nullptr);
+
+				for (uint32_t j = 0; j < p_slotCount; ++j)
+					slots.materials[j] = &material;
+			}
+		});
+
+		bool slotsAssigned = true;
+
+		for (auto actor : actors)
+		{
+			const auto& materials = actor->GetComponent<OvCore::ECS::Components::CMaterialRenderer>()->GetMaterials();
+			slotsAssigned &= materials.size() == p_slotCount && std::ranges::all_of(materials, [&material](auto p_material) { return p_material == &material; });
+		}
+
+		p_report.BeginGroup(std::format("{} actors, {} material slot(s)", p_actorCount, p_slotCount));
+		p_report.AddValue("sizeof(CMaterialRenderer)", sizeof(OvCore::ECS::Components::CMaterialRenderer), "bytes");
+		p_report.AddValue("Heap per actor, CMaterialRenderer", static_cast<double>(current.bytes) / p_actorCount, "bytes");
+		p_report.AddValue("Allocations per actor, CMaterialRenderer", static_cast<double>(current.allocations) / p_actorCount, "");
+		p_report.AddValue("Heap per actor, fixed slots (Baseline, storage only)", static_cast<double>(legacy.bytes) / p_actorCount, "bytes");
+		p_report.Check(slotsAssigned, "Every slot holds its material");
+		p_report.Check(current.bytes < legacy.bytes, "Sized slots use less memory than the fixed ones");
+	}
+}
+
+void OvBenchmarks::Benchmarks::MaterialSlots(Core::Report& p_report)
+{
+	for (const uint32_t actorCount : { 1000u, 10000u })
+	{
+		for (const uint32_t slotCount : { 1u, 4u, 16u })
+			RunSlots(p_report, actorCount, slotCount);
+	}
+}
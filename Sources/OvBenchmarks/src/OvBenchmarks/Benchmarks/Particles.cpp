@@ -0,0 +1,232 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <OvCore/ECS/Actor.h>
+#include <OvCore/ParticleSystem/CParticleSystem.h>
+#include <OvCore/ParticleSystem/ParticleMesh.h>
+#include <OvCore/SceneSystem/Scene.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+	constexpr uint32_t kWarmUpFrames = 180; // Longer than the particle lifetime, so the pools reach their steady size
+	constexpr uint32_t kMeasuredFrames = 300;
+
+	void CreateSystems(OvCore::SceneSystem::Scene& p_scene, uint32_t p_count)
+	{
+		for (uint32_t i = 0; i < p_count; ++i)
+		{
+			auto& actor = p_scene.CreateActor(std::format("Particle System {}", i));
+			actor.transform.SetLocalPosition({ static_cast<float>(i % 32) * 4.0f, 0.0f, static_cast<float>(i / 32) * 4.0f });
+
+			auto& system = actor.AddComponent<OvCore::ECS::Components::CParticleSystem>();
+			system.SetEmitter(std::make_unique<OvCore::ParticleSystem::PointParticleEmitter>(500.0f, 2.0f, 2.0f, 0.1f, 0.5f));
+			system.AddAffector(std::make_unique<OvCore::ParticleSystem::GravityAffector>());
+			system.AddAffector(std::make_unique<OvCore::ParticleSystem::ColorGradientAffector>());
+		}
+	}
+
+	void Run(OvBenchmarks::Core::Report& p_report, uint32_t p_systemCount, bool p_throttled)
+	{
+		OvCore::SceneSystem::Scene scene;
+		CreateSystems(scene, p_systemCount);
+
+		// No camera reports the systems as viewed in a headless run, so they are all seen as hidden.
+		// Without throttling, every system is simulated every frame (The worst case of the renderer-driven path)
+		auto& simulator = scene.GetParticleSimulator();
+
+		if (!p_throttled)
+		{
+			simulator.settings.particleBudget = 0;
+			simulator.settings.hiddenInterval = 1;
+		}
+
+		const auto& systems = scene.GetFastAccessComponents().particleSystems;
+
+		for (uint32_t frame = 0; frame < kWarmUpFrames; ++frame)
+			simulator.Simulate(systems, kDeltaTime);
+
+		uint64_t simulatedParticles = 0;
+		uint32_t liveParticles = 0;
+
+		const double frameTime = OvBenchmarks::Utils::MeasureAverage(kMeasuredFrames, [&]
+		{
+			simulator.Simulate(systems, kDeltaTime);
+			simulatedParticles += simulator.GetStatistics().simulatedParticleCount;
+			liveParticles = simulator.GetStatistics().liveParticleCount;
+		});
+
+		const double particlesPerFrame = static_cast<double>(simulatedParticles) / kMeasuredFrames;
+
+		p_report.BeginGroup(std::format("{} systems, {}", p_systemCount, p_throttled ? "default throttling" : "no throttling"));
+		p_report.AddValue("Live particles", liveParticles, "");
+		p_report.AddValue("Simulated particles per frame", particlesPerFrame, "");
+		p_report.AddTiming("Simulate() per frame", frameTime);
+		p_report.AddValue("Time per simulated particle", particlesPerFrame > 0.0 ? frameTime * 1e6 / particlesPerFrame : 0.0, "ns");
+		p_report.Check(liveParticles > 0, "Particles are emitted");
+	}
+
+	/**
+	* Outputs of the particle vertex shader (Particle.ovfx) for a vertex, before the model and view-projection transforms
+	*/
+	struct ShaderVertex
+	{
+		OvMaths::FVector3 position;
+		float texCoords[2];
+		float color[4];
+	};
+
+	/**
+	* C++ transcription of the particle vertex shader, pulling the instance of the vertex from its ID like gl_VertexID
+	*/
+	ShaderVertex RunParticleVertexShader(std::span<const OvCore::ParticleSystem::ParticleInstance> p_instances, uint32_t p_vertexID, const OvMaths::FVector3& p_cameraRight, const OvMaths::FVector3& p_cameraUp)
+	{
+		const auto unpackUnorm = [](uint32_t p_value, uint32_t p_shift, uint32_t p_mask)
+		{
+			return static_cast<float>((p_value >> p_shift) & p_mask) / static_cast<float>(p_mask);
+		};
+
+		const auto& particle = p_instances[p_vertexID / 4];
+		const uint32_t corner = p_vertexID % 4;
+		const float cornerOffset[2] = { corner == 1 || corner == 2 ? 0.5f : -0.5f, corner >= 2 ? 0.5f : -0.5f };
+
+		const OvMaths::FVector3 center{ particle.position[0], particle.position[1], particle.position[2] };
+		const float uvMin[2] = { unpackUnorm(particle.uvMin, 0, 0xFFFF), unpackUnorm(particle.uvMin, 16, 0xFFFF) };
+		const float uvMax[2] = { unpackUnorm(particle.uvMax, 0, 0xFFFF), unpackUnorm(particle.uvMax, 16, 0xFFFF) };
+
+		ShaderVertex vertex;
+		vertex.position = center + (p_cameraRight * cornerOffset[0] + p_cameraUp * cornerOffset[1]) * particle.size;
+
+		for (uint32_t i = 0; i < 2; ++i)
+		{
+			const float t = cornerOffset[i] + 0.5f;
+			vertex.texCoords[i] = uvMin[i] * (1.0f - t) + uvMax[i] * t; // GLSL mix
+		}
+
+		for (uint32_t channel = 0; channel < 4; ++channel)
+			vertex.color[channel] = unpackUnorm(particle.color, channel * 8, 0xFF);
+
+		return vertex;
+	}
+
+	/**
+	* Same indices as the index buffer of the particle mesh (Two triangles per quad)
+	*/
+	uint32_t GetQuadIndex(uint32_t p_index)
+	{
+		constexpr uint32_t kQuadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+		return (p_index / 6) * 4 + kQuadIndices[p_index % 6];
+	}
+}
+
+void OvBenchmarks::Benchmarks::Particles(Core::Report& p_report)
+{
+	for (const uint32_t systemCount : { 16u, 256u, 1024u })
+		Run(p_report, systemCount, false);
+
+	Run(p_report, 1024, true);
+}
+
+void OvBenchmarks::Benchmarks::ParticleBillboards(Core::Report& p_report)
+{
+	constexpr uint32_t kParticleCount = 100000;
+	constexpr uint32_t kExpandCount = 20;
+	constexpr float kTolerance = 1e-4f;
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	OvCore::ParticleSystem::ParticlePool pool(kParticleCount);
+
+	for (uint32_t i = 0; i < kParticleCount; ++i)
+	{
+		const float uvLeft = unit(generator) * 0.5f;
+		const float uvBottom = unit(generator) * 0.5f;
+
+		OvCore::ParticleSystem::ParticleSystemParticle particle{};
+		particle.position = { position(generator), position(generator), position(generator) };
+		particle.color = { unit(generator), unit(generator), unit(generator), unit(generator) };
+		particle.lb_uv = { uvLeft, uvBottom };
+		particle.rt_uv = { uvLeft + 0.5f, uvBottom + 0.5f };
+		particle.size = 0.1f + unit(generator) * 2.0f;
+		particle.timeToLive = particle.totalTimeToLive = 1.0f;
+		pool.Spawn(particle);
+	}
+
+	OvCore::ParticleSystem::ParticleMesh mesh;
+	mesh.Pack(pool, { 10.0f, 0.0f, -5.0f });
+	const auto instances = mesh.GetInstances();
+
+	// Camera yawed and pitched, so no billboard axis is aligned with the world axes
+	const OvMaths::FVector3 forward = OvMaths::FVector3::Normalize({ 0.4f, -0.3f, -1.0f });
+	const OvMaths::FVector3 cameraRight = OvMaths::FVector3::Normalize(OvMaths::FVector3::Cross(forward, OvMaths::FVector3::Up));
+	const OvMaths::FVector3 cameraUp = OvMaths::FVector3::Cross(cameraRight, forward);
+
+	std::vector<OvRendering::Geometry::Vertex> vertices;
+	std::vector<uint32_t> indices;
+
+	const double expandTime = OvBenchmarks::Utils::MeasureAverage(kExpandCount, [&]
+	{
+		OvCore::ParticleSystem::ParticleMesh::ExpandBillboards(instances, cameraRight, cameraUp, vertices, indices);
+	});
+
+	float maxError = 0.0f;
+
+	for (uint32_t vertexID = 0; vertexID < vertices.size(); ++vertexID)
+	{
+		const auto& vertex = vertices[vertexID];
+		const ShaderVertex expected = RunParticleVertexShader(instances, vertexID, cameraRight, cameraUp);
+
+		maxError = std::max({
+			maxError,
+			std::abs(vertex.position[0] - expected.position.x),
+			std::abs(vertex.position[1] - expected.position.y),
+			std::abs(vertex.position[2] - expected.position.z),
+			std::abs(vertex.texCoords[0] - expected.texCoords[0]),
+			std::abs(vertex.texCoords[1] - expected.texCoords[1])
+		});
+
+		for (uint32_t channel = 0; channel < 4; ++channel)
+			maxError = std::max(maxError, std::abs(vertex.color[channel] - expected.color[channel]));
+	}
+
+	bool indicesMatch = indices.size() == mesh.GetIndexCount();
+
+	for (uint32_t i = 0; indicesMatch && i < indices.size(); ++i)
+		indicesMatch = indices[i] == GetQuadIndex(i);
+
+	// Counter-clockwise triangles, seen from the camera
+	const auto triangleNormal = [&vertices, &indices](uint32_t p_triangle)
+	{
+		const auto get = [&](uint32_t p_corner)
+		{
+			const auto& position = vertices[indices[p_triangle * 3 + p_corner]].position;
+			return OvMaths::FVector3{ position[0], position[1], position[2] };
+		};
+
+		return OvMaths::FVector3::Cross(get(1) - get(0), get(2) - get(0));
+	};
+
+	p_report.BeginGroup(std::format("{} particles, billboard expansion", kParticleCount));
+	p_report.AddTiming("ExpandBillboards()", expandTime);
+	p_report.AddValue("Largest difference with the vertex shader", maxError, "");
+	p_report.Check(instances.size() == kParticleCount, "Every particle is packed");
+	p_report.Check(vertices.size() == mesh.GetVertexCount(), "4 vertices per particle");
+	p_report.Check(maxError <= kTolerance, "Vertices match the particle vertex shader");
+	p_report.Check(indicesMatch, "Indices match the particle mesh index buffer");
+	p_report.Check(!indices.empty() && OvMaths::FVector3::Dot(triangleNormal(0), forward) < 0.0f && OvMaths::FVector3::Dot(triangleNormal(1), forward) < 0.0f, "Billboards face the camera");
+}
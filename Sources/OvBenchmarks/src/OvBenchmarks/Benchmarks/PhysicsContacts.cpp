@@ -0,0 +1,208 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <format>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <OvPhysics/Core/ContactPairSet.h>
+#include <OvPhysics/Core/PhysicsEngine.h>
+#include <OvPhysics/Entities/PhysicalBox.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	constexpr uint32_t kGridSize = 40;		// Boxes per side of each layer
+	constexpr uint32_t kLayerCount = 2;
+	constexpr uint32_t kStepCount = 240;
+	constexpr float kStep = 1.0f / 60.0f;
+
+	struct EventCounters
+	{
+		uint64_t start = 0;
+		uint64_t stay = 0;
+		uint64_t stop = 0;
+	};
+
+	struct DiffResult
+	{
+		uint64_t started = 0;
+		uint64_t stopped = 0;
+	};
+
+	/**
+	* Contact tracking of the PhysicsEngine before the ContactPairSet (Kept as the baseline): pairs are stored
+	* in an ordered map, flagged when found again, and the unflagged ones are the pairs that stopped
+	*/
+	class MapContactTracker
+	{
+	public:
+		void Step(const std::vector<std::pair<uint32_t, uint32_t>>& p_pairs, DiffResult& p_result)
+		{
+			for (auto& [pair, found] : m_pairs)
+				found = false;
+
+			for (const auto& pair : p_pairs)
+			{
+				const auto key = std::minmax(pair.first, pair.second);
+
+				if (auto [it, inserted] = m_pairs.emplace(key, true); inserted)
+					++p_result.started;
+				else
+					it->second = true;
+			}
+
+			for (auto it = m_pairs.begin(); it != m_pairs.end();)
+			{
+				if (!it->second)
+				{
+					++p_result.stopped;
+					it = m_pairs.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+	private:
+		std::map<std::pair<uint32_t, uint32_t>, bool> m_pairs;
+	};
+
+	/**
+	* Same diff as PhysicsEngine::GatherContacts and DispatchCollisionEvents
+	*/
+	class PairSetContactTracker
+	{
+	public:
+		void Step(const std::vector<std::pair<uint32_t, uint32_t>>& p_pairs, DiffResult& p_result)
+		{
+			std::swap(m_contacts, m_previousContacts);
+			m_contacts.Clear();
+
+			for (const auto& pair : p_pairs)
+				m_contacts.Insert(pair.first, pair.second);
+
+			for (const uint64_t key : m_contacts.GetKeys())
+			{
+				if (!m_previousContacts.Contains(key))
+					++p_result.started;
+			}
+
+			for (const uint64_t key : m_previousContacts.GetKeys())
+			{
+				if (!m_contacts.Contains(key))
+					++p_result.stopped;
+			}
+		}
+
+	private:
+		OvPhysics::Core::ContactPairSet m_contacts;
+		OvPhysics::Core::ContactPairSet m_previousContacts;
+	};
+
+	void RunScene(OvBenchmarks::Core::Report& p_report)
+	{
+		OvPhysics::Core::PhysicsEngine physicsEngine({});
+
+		OvPhysics::Entities::PhysicalBox ground({ kGridSize * 2.0f, 1.0f, kGridSize * 2.0f });
+		ground.SetKinematic(true);
+		ground.GetTransform().SetLocalPosition({ kGridSize * 0.5f, -1.0f, kGridSize * 0.5f });
+
+		EventCounters counters;
+
+		// Touching layers of boxes, dropped from slightly above the ground so every contact starts during the run
+		std::vector<std::unique_ptr<OvPhysics::Entities::PhysicalBox>> boxes;
+		boxes.reserve(kGridSize * kGridSize * kLayerCount);
+
+		for (uint32_t layer = 0; layer < kLayerCount; ++layer)
+		{
+			for (uint32_t x = 0; x < kGridSize; ++x)
+			{
+				for (uint32_t z = 0; z < kGridSize; ++z)
+				{
+					auto& box = *boxes.emplace_back(std::make_unique<OvPhysics::Entities::PhysicalBox>(OvMaths::FVector3{ 0.5f, 0.5f, 0.5f }));
+					box.GetTransform().SetLocalPosition({ static_cast<float>(x), 0.55f + layer * 1.05f, static_cast<float>(z) });
+					box.CollisionStartEvent += [&counters](auto&) { ++counters.start; };
+					box.CollisionStayEvent += [&counters](auto&) { ++counters.stay; };
+					box.CollisionStopEvent += [&counters](auto&) { ++counters.stop; };
+				}
+			}
+		}
+
+		uint32_t steps = 0;
+		const double time = OvBenchmarks::Utils::Measure([&]
+		{
+			for (uint32_t i = 0; i < kStepCount; ++i)
+				steps += physicsEngine.Update(kStep);
+		});
+
+		p_report.BeginGroup(std::format("{} boxes resting on each other, {} steps", boxes.size(), steps));
+		p_report.AddTiming("Update() per step", steps > 0 ? time / steps : 0.0);
+		p_report.AddValue("Collision start events", static_cast<double>(counters.start), "");
+		p_report.AddValue("Collision stay events per step", steps > 0 ? static_cast<double>(counters.stay) / steps : 0.0, "");
+		p_report.AddValue("Collision stop events", static_cast<double>(counters.stop), "");
+		p_report.Check(steps == kStepCount, "One step per update");
+		p_report.Check(counters.start >= boxes.size(), "Every box reports a contact");
+	}
+
+	template<typename Tracker>
+	double RunTracker(const std::vector<std::vector<std::pair<uint32_t, uint32_t>>>& p_steps, DiffResult& p_result)
+	{
+		Tracker tracker;
+
+		return OvBenchmarks::Utils::Measure([&]
+		{
+			for (const auto& pairs : p_steps)
+				tracker.Step(pairs, p_result);
+		});
+	}
+
+	void RunPairSet(OvBenchmarks::Core::Report& p_report)
+	{
+		constexpr uint32_t kObjectCount = 10000;
+		constexpr uint32_t kPairCount = 20000;
+		constexpr uint32_t kTrackedSteps = 200;
+
+		// Most pairs persist from a step to the next, a few of them change every step
+		std::vector<std::vector<std::pair<uint32_t, uint32_t>>> steps(kTrackedSteps);
+
+		for (uint32_t step = 0; step < kTrackedSteps; ++step)
+		{
+			steps[step].reserve(kPairCount);
+
+			for (uint32_t pair = 0; pair < kPairCount; ++pair)
+			{
+				const uint32_t variant = pair % 50 == 0 ? step : 0;
+				const uint32_t first = (pair * 7 + variant) % kObjectCount;
+				const uint32_t second = (first + 1 + pair % 13) % kObjectCount;
+				steps[step].emplace_back(first, second);
+			}
+		}
+
+		DiffResult mapResult;
+		DiffResult pairSetResult;
+		const double mapTime = RunTracker<MapContactTracker>(steps, mapResult);
+		const double pairSetTime = RunTracker<PairSetContactTracker>(steps, pairSetResult);
+
+		p_report.BeginGroup(std::format("Contact diff, {} pairs, {} steps", kPairCount, kTrackedSteps));
+		p_report.AddTiming("std::map per step (Baseline)", mapTime / kTrackedSteps);
+		p_report.AddTiming("ContactPairSet per step", pairSetTime / kTrackedSteps);
+		p_report.AddValue("Speedup", pairSetTime > 0.0 ? mapTime / pairSetTime : 0.0, "x");
+		p_report.Check(mapResult.started == pairSetResult.started && mapResult.stopped == pairSetResult.stopped, "Both report the same started and stopped pairs");
+	}
+}
+
+void OvBenchmarks::Benchmarks::PhysicsContacts(Core::Report& p_report)
+{
+	RunScene(p_report);
+	RunPairSet(p_report);
+}
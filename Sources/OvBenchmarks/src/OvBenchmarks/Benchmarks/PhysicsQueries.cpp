@@ -0,0 +1,182 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <format>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <OvPhysics/Core/PhysicsEngine.h>
+#include <OvPhysics/Entities/PhysicalBox.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	constexpr uint32_t kGridSize = 64;		// Boxes per side of the grid
+	constexpr float kSpacing = 2.0f;
+	constexpr uint32_t kQueryCount = 8192;
+	constexpr uint32_t kIterations = 20;
+
+	constexpr OvPhysics::Core::EQueryMode kModes[] = {
+		OvPhysics::Core::EQueryMode::CLOSEST,
+		OvPhysics::Core::EQueryMode::ANY,
+		OvPhysics::Core::EQueryMode::ALL
+	};
+
+	std::string GetModeName(OvPhysics::Core::EQueryMode p_mode)
+	{
+		switch (p_mode)
+		{
+		case OvPhysics::Core::EQueryMode::CLOSEST: return "CLOSEST";
+		case OvPhysics::Core::EQueryMode::ANY: return "ANY";
+		case OvPhysics::Core::EQueryMode::ALL: return "ALL";
+		}
+
+		return {};
+	}
+
+	// Offset in [-0.4, 0.4] varying with the query index, so queries don't all follow the same line
+	float GetOffset(uint32_t p_index)
+	{
+		return static_cast<float>((p_index * 37) % 100) / 100.0f * 0.8f - 0.4f;
+	}
+
+	// Rays and sweeps go through a whole row of the grid, so ALL reports many hits per query
+	OvMaths::FVector3 GetRowStart(uint32_t p_index)
+	{
+		return { -kSpacing * 2.0f, GetOffset(p_index), static_cast<float>(p_index % kGridSize) * kSpacing + GetOffset(p_index + 1) };
+	}
+
+	constexpr float kRowLength = kGridSize * kSpacing + kSpacing * 4.0f;
+
+	uint32_t CountHits(const OvPhysics::Core::QueryResults& p_results)
+	{
+		uint32_t count = 0;
+
+		for (size_t i = 0; i < p_results.GetQueryCount(); ++i)
+			count += static_cast<uint32_t>(p_results.GetHits(i).size());
+
+		return count;
+	}
+
+	bool HaveSameHits(const OvPhysics::Core::QueryResults& p_first, const OvPhysics::Core::QueryResults& p_second)
+	{
+		if (p_first.GetQueryCount() != p_second.GetQueryCount())
+			return false;
+
+		for (size_t i = 0; i < p_first.GetQueryCount(); ++i)
+		{
+			const auto first = p_first.GetHits(i);
+			const auto second = p_second.GetHits(i);
+
+			if (first.size() != second.size())
+				return false;
+
+			for (size_t hit = 0; hit < first.size(); ++hit)
+			{
+				if (first[hit].object != second[hit].object)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	* Run a batch of queries on a single thread then on the thread pool, for every query mode
+	*/
+	template<typename Query, typename Run>
+	void RunBatches(OvBenchmarks::Core::Report& p_report, const std::string& p_name, std::vector<Query>& p_queries, Run p_run)
+	{
+		OvPhysics::Core::QueryResults serialResults;
+		OvPhysics::Core::QueryResults parallelResults;
+
+		for (const auto mode : kModes)
+		{
+			for (auto& query : p_queries)
+				query.mode = mode;
+
+			// First runs size the result buffers, so the measured ones reuse their memory
+			p_run(p_queries, serialResults, false);
+			p_run(p_queries, parallelResults, true);
+
+			const double serialTime = OvBenchmarks::Utils::MeasureAverage(kIterations, [&] { p_run(p_queries, serialResults, false); });
+			const double parallelTime = OvBenchmarks::Utils::MeasureAverage(kIterations, [&] { p_run(p_queries, parallelResults, true); });
+
+			p_report.BeginGroup(std::format("{} x{}, {}", p_name, p_queries.size(), GetModeName(mode)));
+			p_report.AddValue("Hits", CountHits(serialResults), "");
+			p_report.AddTiming("Single thread", serialTime);
+			p_report.AddTiming("Thread pool", parallelTime);
+			p_report.AddValue("Speedup", parallelTime > 0.0 ? serialTime / parallelTime : 0.0, "x");
+			p_report.Check(CountHits(serialResults) > 0, "Queries hit the grid");
+			p_report.Check(HaveSameHits(serialResults, parallelResults), "Thread pool results match");
+		}
+	}
+}
+
+void OvBenchmarks::Benchmarks::PhysicsQueries(Core::Report& p_report)
+{
+	OvPhysics::Core::PhysicsEngine physicsEngine({});
+
+	std::vector<std::unique_ptr<OvPhysics::Entities::PhysicalBox>> boxes;
+	boxes.reserve(kGridSize * kGridSize);
+
+	for (uint32_t x = 0; x < kGridSize; ++x)
+	{
+		for (uint32_t z = 0; z < kGridSize; ++z)
+		{
+			auto& box = *boxes.emplace_back(std::make_unique<OvPhysics::Entities::PhysicalBox>(OvMaths::FVector3{ 0.5f, 0.5f, 0.5f }));
+			box.SetKinematic(true);
+			box.GetTransform().SetLocalPosition({ x * kSpacing, 0.0f, z * kSpacing });
+		}
+	}
+
+	// A step moves the bodies to their transforms, queries read the state of the last step
+	physicsEngine.Update(1.0f / 60.0f);
+
+	std::vector<OvPhysics::Core::RaycastQuery> raycasts(kQueryCount);
+	std::vector<OvPhysics::Core::SweepQuery> sweeps(kQueryCount);
+	std::vector<OvPhysics::Core::OverlapQuery> overlaps(kQueryCount);
+
+	for (uint32_t i = 0; i < kQueryCount; ++i)
+	{
+		raycasts[i].origin = GetRowStart(i);
+		raycasts[i].direction = { 1.0f, 0.0f, 0.0f };
+		raycasts[i].distance = kRowLength;
+
+		sweeps[i].shape.type = static_cast<OvPhysics::Core::EQueryShape>(i % 3);
+		sweeps[i].shape.radius = 0.25f;
+		sweeps[i].shape.height = 0.5f;
+		sweeps[i].shape.halfExtents = { 0.25f, 0.25f, 0.25f };
+		sweeps[i].origin = GetRowStart(i);
+		sweeps[i].direction = { 1.0f, 0.0f, 0.0f };
+		sweeps[i].distance = kRowLength;
+
+		// Overlaps cover a few boxes each
+		overlaps[i].shape.type = static_cast<OvPhysics::Core::EQueryShape>(i % 3);
+		overlaps[i].shape.radius = kSpacing * 1.5f;
+		overlaps[i].shape.height = kSpacing;
+		overlaps[i].shape.halfExtents = { kSpacing * 1.5f, kSpacing * 1.5f, kSpacing * 1.5f };
+		overlaps[i].position = { static_cast<float>((i * 7) % kGridSize) * kSpacing + 1.0f, 0.0f, static_cast<float>(i % kGridSize) * kSpacing + 1.0f };
+	}
+
+	RunBatches(p_report, "Raycast", raycasts, [&physicsEngine](auto& p_queries, auto& p_results, bool p_parallel)
+	{
+		physicsEngine.Raycast(p_queries, p_results, p_parallel);
+	});
+
+	RunBatches(p_report, "Sweep", sweeps, [&physicsEngine](auto& p_queries, auto& p_results, bool p_parallel)
+	{
+		physicsEngine.Sweep(p_queries, p_results, p_parallel);
+	});
+
+	RunBatches(p_report, "Overlap", overlaps, [&physicsEngine](auto& p_queries, auto& p_results, bool p_parallel)
+	{
+		physicsEngine.Overlap(p_queries, p_results, p_parallel);
+	});
+}
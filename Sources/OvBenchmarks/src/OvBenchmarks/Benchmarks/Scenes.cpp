@@ -0,0 +1,244 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <tinyxml2.h>
+
+#include <OvCore/ECS/Actor.h>
+#include <OvCore/ECS/Components/CPhysicalBox.h>
+#include <OvCore/ECS/Components/CPhysicalSphere.h>
+#include <OvCore/ECS/Components/CPointLight.h>
+#include <OvCore/ECS/Components/CSpotLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
+#include <OvCore/SceneSystem/Scene.h>
+#include <OvPhysics/Core/PhysicsEngine.h>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/Timer.h"
+
+namespace
+{
+	constexpr uint32_t kActorCount = 10000;
+	constexpr uint32_t kChildrenPerParent = 9;
+	constexpr uint32_t kLoadCount = 5;
+
+	/**
+	* Actors only hold components that don't reference resources, so the scene loads without any resource manager
+	*/
+	void PopulateScene(OvCore::SceneSystem::Scene& p_scene)
+	{
+		using namespace OvCore::ECS::Components;
+
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+		OvCore::ECS::Actor* parent = nullptr;
+
+		for (uint32_t i = 0; i < kActorCount; ++i)
+		{
+			auto& actor = p_scene.CreateActor(std::format("Actor {}", i), i % 2 == 0 ? "Even" : "");
+			actor.transform.SetLocalPosition({ position(generator), position(generator), position(generator) });
+			actor.transform.SetLocalRotation(OvMaths::FQuaternion({ unit(generator) * 360.0f, unit(generator) * 360.0f, 0.0f }));
+
+			if (i % (kChildrenPerParent + 1) == 0)
+				parent = &actor;
+			else
+				actor.SetParent(*parent);
+
+			switch (i % 4)
+			{
+			case 0:
+			{
+				auto& light = actor.AddComponent<CPointLight>();
+				light.SetColor({ unit(generator), unit(generator), unit(generator) });
+				light.SetIntensity(unit(generator) * 10.0f);
+				break;
+			}
+			case 1:
+			{
+				auto& light = actor.AddComponent<CSpotLight>();
+				light.SetCutoff(unit(generator) * 45.0f);
+				light.SetOuterCutoff(unit(generator) * 45.0f + 45.0f);
+				break;
+			}
+			case 2:
+			{
+				auto& box = actor.AddComponent<CPhysicalBox>();
+				box.SetSize({ unit(generator), unit(generator), unit(generator) });
+				box.SetMass(unit(generator) * 100.0f);
+				break;
+			}
+			case 3:
+			{
+				auto& sphere = actor.AddComponent<CPhysicalSphere>();
+				sphere.SetRadius(unit(generator) * 2.0f);
+				sphere.SetKinematic(true);
+				break;
+			}
+			}
+		}
+	}
+
+	std::string Print(const tinyxml2::XMLDocument& p_doc)
+	{
+		tinyxml2::XMLPrinter printer;
+		p_doc.Print(&printer);
+		return printer.CStr();
+	}
+
+	/**
+	* Same document as the editor saves (See EditorActions::SaveSceneToDisk)
+	*/
+	void SerializeScene(OvCore::SceneSystem::Scene& p_scene, tinyxml2::XMLDocument& p_doc)
+	{
+		tinyxml2::XMLNode* node = p_doc.NewElement("root");
+		p_doc.InsertFirstChild(node);
+		p_scene.OnSerialize(p_doc, node);
+	}
+
+	std::string SerializeScene(OvCore::SceneSystem::Scene& p_scene)
+	{
+		tinyxml2::XMLDocument doc;
+		SerializeScene(p_scene, doc);
+		return Print(doc);
+	}
+
+	/**
+	* Returns true if the binary serialization of every component decodes to its XML serialization
+	*/
+	bool CompareComponentSerializations(OvCore::SceneSystem::Scene& p_scene)
+	{
+		for (auto actor : p_scene.GetActors())
+		{
+			for (auto& component : actor->GetComponents())
+			{
+				tinyxml2::XMLDocument xmlDoc;
+				tinyxml2::XMLNode* node = xmlDoc.NewElement("data");
+				xmlDoc.InsertFirstChild(node);
+				component->OnSerialize(xmlDoc, node);
+
+				OvCore::Helpers::BinaryWriter writer;
+				writer.BeginElement("data");
+				component->OnSerialize(writer);
+				writer.EndElement();
+				const auto data = writer.Finalize();
+
+				OvCore::Helpers::BinaryDocument binaryDoc;
+				tinyxml2::XMLDocument decodedDoc;
+
+				if (!binaryDoc.Load(data) || !binaryDoc.ToXML(decodedDoc) || Print(decodedDoc) != Print(xmlDoc))
+					return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+void OvBenchmarks::Benchmarks::SceneLoading(Core::Report& p_report)
+{
+	const auto folder = std::filesystem::temp_directory_path() / "OvBenchmarks" / "Scenes";
+	const std::string xmlPath = (folder / "Scene.ovscene").string();
+	const std::string binaryPath = (folder / "Scene.Binary.ovscene").string();
+	std::filesystem::create_directories(folder);
+
+	// Physical objects register their body to the physics engine
+	OvPhysics::Core::PhysicsEngine physicsEngine({});
+
+	std::string sourceXML;
+	bool componentsMatch = false;
+
+	{
+		OvCore::SceneSystem::Scene scene;
+		PopulateScene(scene);
+		componentsMatch = CompareComponentSerializations(scene);
+
+		tinyxml2::XMLDocument doc;
+		SerializeScene(scene, doc);
+		sourceXML = Print(doc);
+		doc.SaveFile(xmlPath.c_str());
+		OvCore::Helpers::BinaryDocument::SaveFile(doc, binaryPath);
+	}
+
+	// XML -> binary -> XML, without going through a scene. Compared with the parsed file rather than the saved
+	// document: tinyxml2 doesn't keep the empty texts when parsing (<tag></tag> becomes <tag/>)
+	std::string parsedXML;
+	std::string convertedXML;
+
+	{
+		tinyxml2::XMLDocument xmlDoc;
+		xmlDoc.LoadFile(xmlPath.c_str());
+		parsedXML = Print(xmlDoc);
+
+		const auto data = OvCore::Helpers::BinaryDocument::FromXML(xmlDoc);
+		OvCore::Helpers::BinaryDocument binaryDoc;
+		tinyxml2::XMLDocument decodedDoc;
+
+		if (binaryDoc.Load(data) && binaryDoc.ToXML(decodedDoc))
+			convertedXML = Print(decodedDoc);
+	}
+
+	double xmlParseTime = 0.0;
+	double xmlDeserializeTime = 0.0;
+	double binaryParseTime = 0.0;
+	double binaryDeserializeTime = 0.0;
+	std::string xmlLoadedXML;
+	std::string binaryLoadedXML;
+
+	for (uint32_t i = 0; i < kLoadCount; ++i)
+	{
+		// Scenes are destroyed out of the measures
+		auto scene = std::make_unique<OvCore::SceneSystem::Scene>();
+		tinyxml2::XMLDocument doc;
+
+		xmlParseTime += OvBenchmarks::Utils::Measure([&] { doc.LoadFile(xmlPath.c_str()); });
+		xmlDeserializeTime += OvBenchmarks::Utils::Measure([&]
+		{
+			scene->OnDeserialize(doc, doc.FirstChild()->FirstChildElement("scene"));
+		});
+
+		if (i == 0)
+			xmlLoadedXML = SerializeScene(*scene);
+	}
+
+	for (uint32_t i = 0; i < kLoadCount; ++i)
+	{
+		auto scene = std::make_unique<OvCore::SceneSystem::Scene>();
+		OvCore::Helpers::BinaryDocument doc;
+
+		binaryParseTime += OvBenchmarks::Utils::Measure([&] { doc.LoadFile(binaryPath); });
+		binaryDeserializeTime += OvBenchmarks::Utils::Measure([&]
+		{
+			scene->OnDeserialize(doc.FirstChildElement().FirstChildElement("scene"));
+		});
+
+		if (i == 0)
+			binaryLoadedXML = SerializeScene(*scene);
+	}
+
+	p_report.BeginGroup(std::format("{} actors (Lights and physical objects)", kActorCount));
+	p_report.AddValue("XML file size", static_cast<double>(std::filesystem::file_size(xmlPath)) / 1024.0, "KiB");
+	p_report.AddValue("Binary file size", static_cast<double>(std::filesystem::file_size(binaryPath)) / 1024.0, "KiB");
+	p_report.AddTiming("XML, parsing", xmlParseTime / kLoadCount);
+	p_report.AddTiming("XML, deserialization", xmlDeserializeTime / kLoadCount);
+	p_report.AddTiming("XML, total", (xmlParseTime + xmlDeserializeTime) / kLoadCount);
+	p_report.AddTiming("Binary, mapping", binaryParseTime / kLoadCount);
+	p_report.AddTiming("Binary, deserialization", binaryDeserializeTime / kLoadCount);
+	p_report.AddTiming("Binary, total", (binaryParseTime + binaryDeserializeTime) / kLoadCount);
+	p_report.Check(componentsMatch, "Binary component serialization decodes to the XML one");
+	p_report.Check(!convertedXML.empty() && convertedXML == parsedXML, "XML -> binary -> XML gives the same document");
+	p_report.Check(xmlLoadedXML == sourceXML, "The scene loaded from XML saves back to the same document");
+	p_report.Check(binaryLoadedXML == sourceXML, "The scene loaded from binary saves back to the same document");
+
+	std::error_code error;
+	std::filesystem::remove_all(folder, error);
+}
@@ -0,0 +1,45 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <format>
+#include <iostream>
+
+#include "OvBenchmarks/Core/Report.h"
+
+void OvBenchmarks::Core::Report::BeginBenchmark(const std::string& p_name)
+{
+	std::cout << std::format("\n=== {} ===\n", p_name);
+}
+
+void OvBenchmarks::Core::Report::BeginGroup(const std::string& p_name)
+{
+	std::cout << std::format("  [{}]\n", p_name);
+}
+
+void OvBenchmarks::Core::Report::AddValue(const std::string& p_label, double p_value, const std::string& p_unit)
+{
+	std::cout << std::format("    {:<48} {:>14.3f} {}\n", p_label, p_value, p_unit);
+}
+
+void OvBenchmarks::Core::Report::AddTiming(const std::string& p_label, double p_milliseconds)
+{
+	AddValue(p_label, p_milliseconds, "ms");
+}
+
+bool OvBenchmarks::Core::Report::Check(bool p_condition, const std::string& p_description)
+{
+	if (!p_condition)
+		++m_failureCount;
+
+	std::cout << std::format("    {:<48} {:>14}\n", p_description, p_condition ? "OK" : "FAILED");
+
+	return p_condition;
+}
+
+uint32_t OvBenchmarks::Core::Report::GetFailureCount() const
+{
+	return m_failureCount;
+}
@@ -0,0 +1,84 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "OvBenchmarks/Benchmarks/Benchmarks.h"
+#include "OvBenchmarks/Utils/AllocationHooks.h"
+
+namespace
+{
+	struct Benchmark
+	{
+		std::string name;
+		void(*run)(OvBenchmarks::Core::Report&);
+	};
+
+	const std::vector<Benchmark> kBenchmarks = {
+		{ "particles", &OvBenchmarks::Benchmarks::Particles },
+		{ "particle-billboards", &OvBenchmarks::Benchmarks::ParticleBillboards },
+		{ "physics-queries", &OvBenchmarks::Benchmarks::PhysicsQueries },
+		{ "physics-contacts", &OvBenchmarks::Benchmarks::PhysicsContacts },
+		{ "lua-behaviours", &OvBenchmarks::Benchmarks::LuaBehaviours },
+		{ "lua-destroy", &OvBenchmarks::Benchmarks::LuaDestroy },
+		{ "events", &OvBenchmarks::Benchmarks::Events },
+		{ "async-logger", &OvBenchmarks::Benchmarks::AsyncLogger },
+		{ "scene-loading", &OvBenchmarks::Benchmarks::SceneLoading },
+		{ "material-slots", &OvBenchmarks::Benchmarks::MaterialSlots },
+		{ "audio-loading", &OvBenchmarks::Benchmarks::AudioLoading },
+		{ "audio-voices", &OvBenchmarks::Benchmarks::AudioVoices },
+	};
+}
+
+/**
+* Usage: OvBenchmarks [--list] [benchmark names...]
+* Runs every benchmark if no name is given. Returns a failure if a benchmark check failed
+*/
+int main(int p_argc, char** p_argv)
+{
+	const std::vector<std::string> arguments(p_argv + 1, p_argv + p_argc);
+
+	if (std::find(arguments.begin(), arguments.end(), "--list") != arguments.end())
+	{
+		for (const auto& benchmark : kBenchmarks)
+			std::cout << benchmark.name << '\n';
+
+		return EXIT_SUCCESS;
+	}
+
+	for (const auto& argument : arguments)
+	{
+		if (std::none_of(kBenchmarks.begin(), kBenchmarks.end(), [&argument](auto& p_benchmark) { return p_benchmark.name == argument; }))
+		{
+			std::cerr << std::format("Unknown benchmark \"{}\" (Use --list to print the available ones)\n", argument);
+			return EXIT_FAILURE;
+		}
+	}
+
+	OvBenchmarks::Core::Report report;
+
+	for (const auto& benchmark : kBenchmarks)
+	{
+		if (arguments.empty() || std::find(arguments.begin(), arguments.end(), benchmark.name) != arguments.end())
+		{
+			report.BeginBenchmark(benchmark.name);
+			benchmark.run(report);
+		}
+	}
+
+	if (report.GetFailureCount() > 0)
+	{
+		std::cerr << std::format("\n{} check(s) failed\n", report.GetFailureCount());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
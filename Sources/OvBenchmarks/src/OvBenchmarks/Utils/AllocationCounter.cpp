@@ -0,0 +1,31 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <atomic>
+
+#include "OvBenchmarks/Utils/AllocationCounter.h"
+
+namespace
+{
+	std::atomic<uint64_t> allocationCount = 0;
+	std::atomic<uint64_t> allocatedBytes = 0;
+}
+
+void OvBenchmarks::Utils::AllocationCounter::Record(size_t p_size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	allocatedBytes.fetch_add(p_size, std::memory_order_relaxed);
+}
+
+uint64_t OvBenchmarks::Utils::AllocationCounter::GetAllocationCount()
+{
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+uint64_t OvBenchmarks::Utils::AllocationCounter::GetAllocatedBytes()
+{
+	return allocatedBytes.load(std::memory_order_relaxed);
+}
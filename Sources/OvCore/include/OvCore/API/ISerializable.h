@@ -29,6 +29,13 @@ namespace OvCore::API
 		*/
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) = 0;
 
+		/**
+		* Called when the serialization into a binary document is asked.
+		* By default, the XML serialization is used and its result is converted to binary
+		* @param p_writer
+		*/
+		virtual void OnSerialize(OvCore::Helpers::BinaryWriter& p_writer);
+
 		/**
 		* Called when the deserialization is asked
 		* @param p_doc
@@ -36,6 +43,13 @@ namespace OvCore::API
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) = 0;
 
+		/**
+		* Called when the deserialization from a binary document is asked.
+		* By default, the node is converted back to XML and forwarded to the XML deserialization
+		* @param p_node
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_node);
+
 		/**
 		* Default polymorphic destructor
 		*/
@@ -31,8 +31,9 @@ namespace OvCore::ECS
 		* @param p_name
 		* @param p_tag
 		* @param p_playing
+		* @param p_template (Template actors are only used as a source to clone from: they don't trigger the static actor events)
 		*/
-		Actor(int64_t p_actorID, const std::string& p_name, const std::string& p_tag, bool& p_playing);
+		Actor(int64_t p_actorID, const std::string& p_name, const std::string& p_tag, bool& p_playing, bool p_template = false);
 
 		/**
 		* Destructor of the actor instance. Force invoke ComponentRemovedEvent and BehaviourRemovedEvent
@@ -74,7 +75,8 @@ namespace OvCore::ECS
 		bool IsSelfActive() const;
 
 		/**
-		* Returns true if the actor is and his recursive parents (if any) are active
+		* Returns true if the actor is and his recursive parents (if any) are active.
+		* The hierarchical state is cached, and refreshed on SetActive and when the actor gets re-parented
 		*/
 		bool IsActive() const;
 
@@ -126,6 +128,11 @@ namespace OvCore::ECS
 		*/
 		std::vector<Actor*>& GetChildren();
 
+		/**
+		* Returns true if the actor is a template (Not part of any scene, only used as a source to clone from)
+		*/
+		bool IsTemplate() const;
+
 		/**
 		* Mark the Actor as "Destroyed". A "Destroyed" actor will be removed from the scene by the scene itself
 		*/
@@ -143,6 +150,12 @@ namespace OvCore::ECS
 		*/
 		void SetSleeping(bool p_sleeping);
 
+		/**
+		* Put the actor back to sleep. If it was awake, it reacts to OnDisable and OnDestroy as if it was destroyed,
+		* and will go through OnAwake and OnStart again the next time it wakes up
+		*/
+		void Sleep();
+
 		/**
 		* Called when the scene start or when the actor gets enabled for the first time during play mode
 		* This method will always be called in an ordered triple:
@@ -271,6 +284,12 @@ namespace OvCore::ECS
 		*/
 		std::vector<std::shared_ptr<Components::AComponent>>& GetComponents();
 
+		/**
+		* Add the component matching the given serialized type name (Returns nullptr if the type is unknown)
+		* @param p_typeName
+		*/
+		Components::AComponent* AddComponentFromTypeName(std::string_view p_typeName);
+
 		/**
 		* Add a behaviour to the actor
 		* @param p_name
@@ -310,6 +329,11 @@ namespace OvCore::ECS
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_actorsRoot) override;
 
+		/**
+		* Deserialize all the components from a binary document
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_actorsRoot) override;
+
 	private:
 		/**
 		 * @brief Deleted copy constructor
@@ -319,6 +343,7 @@ namespace OvCore::ECS
 
 		void RecursiveActiveUpdate();
 		void RecursiveWasActiveUpdate();
+		void RecursiveHierarchyActiveUpdate();
 
 	public:
 		/* Some events that are triggered when an action occur on the actor instance */
@@ -326,6 +351,7 @@ namespace OvCore::ECS
 		OvTools::Eventing::Event<Components::AComponent&>	ComponentRemovedEvent;
 		OvTools::Eventing::Event<Components::Behaviour&>	BehaviourAddedEvent;
 		OvTools::Eventing::Event<Components::Behaviour&>	BehaviourRemovedEvent;
+		OvTools::Eventing::Event<Components::Behaviour&, Components::EUpdateCallbacks>	BehaviourUpdateCallbacksChangedEvent; // Previous callbacks
 
 		/* Some events that are triggered when an action occur on any actor */
 		static OvTools::Eventing::Event<Actor&>				DestroyedEvent;
@@ -342,11 +368,13 @@ namespace OvCore::ECS
 
 		/* Internal settings */
 		int64_t	m_actorID;
+		bool	m_template;
 		bool	m_destroyed = false;
 		bool	m_sleeping = true;
 		bool	m_awaked = false;
 		bool	m_started = false;
 		bool	m_wasActive = false;
+		bool	m_hierarchyActive = true;
 
 		/* Parenting system stuff */
 		int64_t					m_parentID = 0;
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "OvCore/API/IInspectorItem.h"
+#include "OvCore/ECS/Components/EUpdateCallbacks.h"
 
 namespace OvCore::ECS { class Actor; }
 
@@ -77,6 +78,13 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnLateUpdate(float p_deltaTime) {}
 
+		/**
+		* Returns the per-frame callbacks (OnUpdate, OnFixedUpdate, OnLateUpdate) implemented by this component.
+		* Only the declared callbacks are dispatched by the scene, so any override of these callbacks must be declared here.
+		* The value is read when the component gets added to (And removed from) an actor, and must not change in between
+		*/
+		virtual EUpdateCallbacks GetUpdateCallbacks() const { return EUpdateCallbacks::NONE; }
+
 		/**
 		* Called when the owner of this component enter in collision with another physical object
 		* @param p_otherObject
@@ -113,6 +121,14 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnTriggerExit(Components::CPhysicalObject& p_otherObject) {}
 
+		/**
+		* Copy the state of the given component (Of the same type) into this component.
+		* By default, the state is transferred through a transient serialization, components
+		* that are frequently cloned should override this method to copy their fields directly
+		* @param p_source
+		*/
+		virtual void CopyFrom(const AComponent& p_source);
+
 		/**
 		* Returns the name of the component
 		*/
@@ -58,6 +58,13 @@ namespace OvCore::ECS::Components
 		*/
 		void RemoveScript();
 
+		/**
+		* Defines the per-frame callbacks implemented by the script (Set by the script engine).
+		* Changing them once the behaviour has been added to its actor must be notified through BehaviourUpdateCallbacksChangedEvent
+		* @param p_callbacks
+		*/
+		void SetUpdateCallbacks(EUpdateCallbacks p_callbacks);
+
 		/**
 		* Called when the scene start right before OnStart
 		* It allows you to apply prioritized game logic on scene start
@@ -103,6 +110,11 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnLateUpdate(float p_deltaTime) override;
 
+		/**
+		* Returns the per-frame callbacks implemented by the script of this behaviour
+		*/
+		virtual EUpdateCallbacks GetUpdateCallbacks() const override;
+
 		/**
 		* Called when the owner of this component enter in collision with another physical object
 		* @param p_otherObject
@@ -146,6 +158,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node) override;
 
+		/**
+		* Serialize the behaviour into a binary document
+		* @param p_writer
+		*/
+		virtual void OnSerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
 		/**
 		* Deserialize the behaviour
 		* @param p_doc
@@ -153,6 +171,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node) override;
 
+		/**
+		* Deserialize the component from a binary document
+		* @param p_node
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_node) override;
+
 		/**
 		* Defines how the behaviour should be drawn in the inspector
 		* @param p_root
@@ -164,6 +188,7 @@ namespace OvCore::ECS::Components
 
 	private:
 		std::unique_ptr<Scripting::Script> m_script;
+		EUpdateCallbacks m_updateCallbacks = EUpdateCallbacks::NONE;
 	};
 
 	template<>
@@ -52,6 +52,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component into a binary document
+		* @param p_writer
+		*/
+		virtual void OnSerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
 		/**
 		* Deserialize the component
 		* @param p_doc
@@ -59,6 +65,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary document
+		* @param p_node
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_node) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
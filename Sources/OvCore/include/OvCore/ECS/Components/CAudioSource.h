@@ -84,6 +84,13 @@ namespace OvCore::ECS::Components
 		*/
 		void SetAttenuationThreshold(float p_distance);
 
+		/**
+		* Defines the audio source priority. When more sources play than the audio engine can mix,
+		* the ones with the lowest priority are virtualized first (0 = lowest, 255 = highest)
+		* @param p_priority
+		*/
+		void SetPriority(uint8_t p_priority);
+
 		/**
 		* Returns the sound attached to the audio source
 		*/
@@ -129,6 +136,11 @@ namespace OvCore::ECS::Components
 		*/
 		float GetAttenuationThreshold() const;
 
+		/**
+		* Returns the audio source priority
+		*/
+		uint8_t GetPriority() const;
+
 		/**
 		* Play the audio source attached sound
 		*/
@@ -156,6 +168,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component into a binary document
+		* @param p_writer
+		*/
+		virtual void OnSerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
 		/**
 		* Deserialize the component
 		* @param p_doc
@@ -163,6 +181,18 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary document
+		* @param p_node
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_node) override;
+
+		/**
+		* Copy the state of the given component into this component
+		* @param p_source
+		*/
+		virtual void CopyFrom(const AComponent& p_source) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
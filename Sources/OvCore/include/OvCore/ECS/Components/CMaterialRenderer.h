@@ -6,13 +6,12 @@
 
 #pragma once
 
-#include <array>
+#include <vector>
 
 #include <OvCore/ECS/Components/AComponent.h>
 #include <OvCore/Rendering/EVisibilityFlags.h>
 #include <OvCore/Resources/Material.h>
 #include <OvRendering/Resources/Mesh.h>
-#include <OvUI/Widgets/Layout/Columns.h>
 
 constexpr uint8_t kMaxMaterialCount = 0xFF;
 
@@ -21,13 +20,13 @@ namespace OvCore::ECS { class Actor; }
 namespace OvCore::ECS::Components
 {
 	/**
-	* A component that handle a material list, necessary for model rendering
+	* A component that handle a material list, necessary for model rendering.
+	* The list holds one slot per material of the model (Up to kMaxMaterialCount)
 	*/
 	class CMaterialRenderer : public AComponent
 	{
 	public:
-		using MaterialList = std::array<OvCore::Resources::Material*, kMaxMaterialCount>;
-		using MaterialField = std::array<std::array<OvUI::Widgets::AWidget*, 3>, kMaxMaterialCount>;
+		using MaterialList = std::vector<OvCore::Resources::Material*>;
 
 		/**
 		* Constructor
@@ -52,17 +51,17 @@ namespace OvCore::ECS::Components
 		void FillWithMaterial(OvCore::Resources::Material& p_material);
 
 		/**
-		* Defines the material to use for the given index
+		* Defines the material to use for the given index (Adds the missing slots if needed)
 		* @param p_index
 		* @param p_material
 		*/
 		void SetMaterialAtIndex(uint8_t p_index, OvCore::Resources::Material& p_material);
 
 		/**
-		* Returns the material to use at index
+		* Returns the material to use at index (Or nullptr if the slot is empty or doesn't exist)
 		* @param p_index
 		*/
-		OvCore::Resources::Material* GetMaterialAtIndex(uint8_t p_index);
+		OvCore::Resources::Material* GetMaterialAtIndex(uint8_t p_index) const;
 
 		/**
 		* Remove the material at index
@@ -82,7 +81,7 @@ namespace OvCore::ECS::Components
 		void RemoveAllMaterials();
 
 		/**
-		* Update the material list by fetching model information
+		* Resize the material list to fit the material count of the model (If any)
 		*/
 		void UpdateMaterialList();
 
@@ -135,6 +134,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component into a binary document
+		* @param p_writer
+		*/
+		virtual void OnSerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
 		/**
 		* Deserialize the component
 		* @param p_doc
@@ -142,6 +147,18 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary document
+		* @param p_node
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_node) override;
+
+		/**
+		* Copy the state of the given component into this component
+		* @param p_source
+		*/
+		virtual void CopyFrom(const AComponent& p_source) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
@@ -150,8 +167,6 @@ namespace OvCore::ECS::Components
 
 	private:
 		MaterialList m_materials;
-		MaterialField m_materialFields;
-		std::array<std::string, kMaxMaterialCount> m_materialNames;
 		OvMaths::FMatrix4 m_userMatrix;
 		Rendering::EVisibilityFlags m_visibilityFlags = Rendering::EVisibilityFlags::ALL;
 	};
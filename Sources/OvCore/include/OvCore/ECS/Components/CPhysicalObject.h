@@ -93,6 +93,11 @@ namespace OvCore::ECS::Components
 		*/
 		bool IsKinematic() const;
 
+		/**
+		* Returns the collision layer of the physical object
+		*/
+		uint32_t GetLayer() const;
+
 		/**
 		* Returns the current activation state
 		*/
@@ -158,6 +163,12 @@ namespace OvCore::ECS::Components
 		*/
 		void SetKinematic(bool p_kinematic);
 
+		/**
+		* Defines the collision layer of the physical object
+		* @param p_layer
+		*/
+		void SetLayer(uint32_t p_layer);
+
 		/**
 		* Defines the new activation state for the physical object
 		* @param p_activationState
@@ -171,6 +182,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Serialize the component into a binary document
+		* @param p_writer
+		*/
+		virtual void OnSerialize(OvCore::Helpers::BinaryWriter& p_writer) override;
+
 		/**
 		* Deserialize the component
 		* @param p_doc
@@ -178,6 +195,18 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary document
+		* @param p_node
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_node) override;
+
+		/**
+		* Copy the state of the given component into this component
+		* @param p_source
+		*/
+		virtual void CopyFrom(const AComponent& p_source) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
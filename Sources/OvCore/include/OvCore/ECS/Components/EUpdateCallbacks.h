@@ -0,0 +1,32 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OvCore::ECS::Components
+{
+	/**
+	* Per-frame callbacks a component can implement.
+	* The scene only dispatches a callback to the components declaring it
+	*/
+	enum class EUpdateCallbacks : uint8_t
+	{
+		NONE = 0,
+		UPDATE = 1 << 0,
+		FIXED_UPDATE = 1 << 1,
+		LATE_UPDATE = 1 << 2,
+		ALL = UPDATE | FIXED_UPDATE | LATE_UPDATE
+	};
+
+	inline EUpdateCallbacks operator~ (EUpdateCallbacks a) { return (EUpdateCallbacks)~(int)a; }
+	inline EUpdateCallbacks operator| (EUpdateCallbacks a, EUpdateCallbacks b) { return (EUpdateCallbacks)((int)a | (int)b); }
+	inline EUpdateCallbacks operator& (EUpdateCallbacks a, EUpdateCallbacks b) { return (EUpdateCallbacks)((int)a & (int)b); }
+	inline EUpdateCallbacks& operator|= (EUpdateCallbacks& a, EUpdateCallbacks b) { return a = a | b; }
+	inline EUpdateCallbacks& operator&= (EUpdateCallbacks& a, EUpdateCallbacks b) { return a = a & b; }
+	inline bool IsFlagSet(EUpdateCallbacks p_flag, EUpdateCallbacks p_mask) { return (int)p_flag & (int)p_mask; }
+}
@@ -37,5 +37,19 @@ namespace OvCore::ECS
 		 * @param p_end
 		 */
 		static std::optional<RaycastHit> Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance);
+
+		/* Sweeps a sphere against all Physical Object in the Scene and returns information on what was hit
+		 * @param p_origin
+		 * @param p_radius
+		 * @param p_direction
+		 * @param p_distance
+		 */
+		static std::optional<RaycastHit> SphereCast(OvMaths::FVector3 p_origin, float p_radius, OvMaths::FVector3 p_direction, float p_distance);
+
+		/* Returns every Physical Object in the Scene overlapping the given sphere
+		 * @param p_center
+		 * @param p_radius
+		 */
+		static std::vector<Components::CPhysicalObject*> OverlapSphere(OvMaths::FVector3 p_center, float p_radius);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,272 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace tinyxml2
+{
+	class XMLDocument;
+	class XMLNode;
+}
+
+namespace OvTools::Filesystem
+{
+	class MappedFile;
+}
+
+namespace OvCore::Helpers
+{
+	class BinaryDocument;
+
+	/**
+	* Read-only view over an element of a BinaryDocument.
+	* Mirrors the subset of the tinyxml2 element API used by deserialization, without building any DOM
+	*/
+	class BinaryNode
+	{
+	public:
+		/**
+		* Creates an invalid node
+		*/
+		BinaryNode() = default;
+
+		/**
+		* Returns true if the node points to an existing element
+		*/
+		explicit operator bool() const;
+
+		/**
+		* Returns the name of the element
+		*/
+		std::string_view Name() const;
+
+		/**
+		* Returns the first child element (With the given name, if any)
+		* @param p_name
+		*/
+		BinaryNode FirstChildElement(std::string_view p_name = {}) const;
+
+		/**
+		* Returns the next sibling element (With the given name, if any)
+		* @param p_name
+		*/
+		BinaryNode NextSiblingElement(std::string_view p_name = {}) const;
+
+		/**
+		* Returns the value of the given attribute, or nullptr if the attribute doesn't exist
+		* @param p_name
+		*/
+		const char* Attribute(std::string_view p_name) const;
+
+		/**
+		* Query the element text. Leaves the output unchanged on failure
+		* @param p_out
+		*/
+		bool QueryStringText(std::string& p_out) const;
+		bool QueryBoolText(bool& p_out) const;
+		bool QueryIntText(int& p_out) const;
+		bool QueryUnsignedText(uint32_t& p_out) const;
+		bool QueryInt64Text(int64_t& p_out) const;
+		bool QueryFloatText(float& p_out) const;
+		bool QueryDoubleText(double& p_out) const;
+
+	private:
+		friend class BinaryDocument;
+
+		BinaryNode(const BinaryDocument* p_document, const uint8_t* p_node, const uint8_t* p_end);
+
+		const uint8_t* GetTextNode() const;
+		bool FormatText(char* p_buffer, int p_bufferSize) const;
+
+	private:
+		const BinaryDocument* m_document = nullptr;
+		const uint8_t* m_node = nullptr;
+		const uint8_t* m_end = nullptr;
+	};
+
+	/**
+	* Writes a BinaryDocument element by element, without building any DOM.
+	* Mirrors the subset of the tinyxml2 element API used by serialization
+	*/
+	class BinaryWriter
+	{
+	public:
+		/**
+		* Open a new element, inside the currently opened one (If any)
+		* @param p_name
+		*/
+		void BeginElement(std::string_view p_name);
+
+		/**
+		* Close the currently opened element
+		*/
+		void EndElement();
+
+		/**
+		* Write the text of the currently opened element.
+		* The untyped version stores the text as a typed value when it converts back to the exact same string
+		* @param p_value
+		*/
+		void WriteText(const char* p_value);
+		void WriteBoolText(bool p_value);
+		void WriteInt64Text(int64_t p_value);
+		void WriteFloatText(float p_value);
+		void WriteDoubleText(double p_value);
+
+		/**
+		* Write the given XML node (And its children) inside the currently opened element
+		* @param p_node
+		*/
+		void WriteNode(const tinyxml2::XMLNode& p_node);
+
+		/**
+		* Returns the encoded document. Every opened element must be closed
+		*/
+		std::vector<uint8_t> Finalize() const;
+
+	private:
+		uint32_t Intern(std::string_view p_string);
+		void WriteChildren(const tinyxml2::XMLNode& p_node);
+
+	private:
+		std::vector<uint8_t> m_nodes;
+		std::vector<std::string> m_strings;
+		std::unordered_map<std::string, uint32_t> m_indices;
+		std::vector<size_t> m_openedElements; // Offset of the children size of every opened element, patched when it gets closed
+	};
+
+	/**
+	* Compact, versioned and little-endian binary equivalent of an XML document.
+	* The file is made of a header, a string table (Element names, attributes and string values)
+	* and a pre-order stream of nodes where every element stores the byte size of its children,
+	* so any subtree (Ex: a component) is a contiguous blob that can be skipped without decoding it.
+	* Numerical and boolean texts are stored as typed values, only when converting them back to
+	* text gives the exact same string, which makes XML <-> binary conversions lossless
+	*/
+	class BinaryDocument
+	{
+	public:
+		static constexpr char kMagic[4] = { 'O', 'V', 'B', 'X' };
+		static constexpr uint32_t kVersion = 1;
+
+		enum class ENodeType : uint8_t
+		{
+			ELEMENT,
+			TEXT,
+			COMMENT,
+			DECLARATION,
+			UNKNOWN
+		};
+
+		enum class ETextType : uint8_t
+		{
+			STRING,
+			BOOLEAN,
+			INT64,
+			FLOAT,
+			DOUBLE
+		};
+
+		/**
+		* Creates an empty document
+		*/
+		BinaryDocument();
+
+		/**
+		* Destructor
+		*/
+		~BinaryDocument();
+
+		BinaryDocument(const BinaryDocument&) = delete;
+		BinaryDocument& operator=(const BinaryDocument&) = delete;
+
+		/**
+		* Memory-map the given file and read it. Returns true on success
+		* @param p_filePath
+		*/
+		bool LoadFile(const std::string& p_filePath);
+
+		/**
+		* Read the given buffer. The buffer must outlive the document. Returns true on success
+		* @param p_data
+		*/
+		bool Load(std::span<const uint8_t> p_data);
+
+		/**
+		* Returns true if the document failed to load
+		*/
+		bool Error() const;
+
+		/**
+		* Returns the first top-level element (With the given name, if any)
+		* @param p_name
+		*/
+		BinaryNode FirstChildElement(std::string_view p_name = {}) const;
+
+		/**
+		* Rebuild the whole document as XML. Returns true on success
+		* @param p_out
+		*/
+		bool ToXML(tinyxml2::XMLDocument& p_out) const;
+
+		/**
+		* Rebuild the given element (And its children) as XML, inserted at the end of the given parent.
+		* Returns the created XML element
+		* @param p_node
+		* @param p_doc
+		* @param p_parent
+		*/
+		static tinyxml2::XMLNode* ToXML(const BinaryNode& p_node, tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent);
+
+		/**
+		* Encode the given XML document into its binary form
+		* @param p_doc
+		*/
+		static std::vector<uint8_t> FromXML(const tinyxml2::XMLDocument& p_doc);
+
+		/**
+		* Encode the given XML document and write it to the given path. Returns true on success
+		* @param p_doc
+		* @param p_filePath
+		*/
+		static bool SaveFile(const tinyxml2::XMLDocument& p_doc, const std::string& p_filePath);
+
+		/**
+		* Returns true if the given buffer starts with a binary document header
+		* @param p_data
+		*/
+		static bool IsBinary(std::span<const uint8_t> p_data);
+
+		/**
+		* Returns true if the given file starts with a binary document header
+		* @param p_filePath
+		*/
+		static bool IsBinaryFile(const std::string& p_filePath);
+
+	private:
+		friend class BinaryNode;
+
+		const char* GetString(uint32_t p_index) const;
+		bool FindString(std::string_view p_string, uint32_t& p_index) const;
+		bool FormatText(const uint8_t* p_textNode, char* p_buffer, int p_bufferSize) const;
+		void InsertNode(const uint8_t* p_node, tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent) const;
+
+	private:
+		std::unique_ptr<OvTools::Filesystem::MappedFile> m_file;
+		std::span<const uint8_t> m_nodes;
+		std::vector<const char*> m_strings;
+		std::unordered_map<std::string_view, uint32_t> m_stringIndices;
+		bool m_error = true;
+	};
+}
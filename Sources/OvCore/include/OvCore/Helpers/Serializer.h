@@ -39,6 +39,12 @@ namespace tinyxml2
 	class XMLNode;
 }
 
+namespace OvCore::Helpers
+{
+	class BinaryNode;
+	class BinaryWriter;
+}
+
 namespace OvCore::Helpers
 {
 	class Serializer
@@ -65,6 +71,27 @@ namespace OvCore::Helpers
 		static void SerializeSound(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node, const std::string& p_name, OvAudio::Resources::Sound* p_value);
 		#pragma endregion
 
+		#pragma region BINARY_SERIALIZATION_HELPERS
+		static void SerializeBoolean(BinaryWriter& p_writer, const std::string& p_name, bool p_value);
+		static void SerializeString(BinaryWriter& p_writer, const std::string& p_name, const std::string& p_value);
+		static void SerializeFloat(BinaryWriter& p_writer, const std::string& p_name, float p_value);
+		static void SerializeDouble(BinaryWriter& p_writer, const std::string& p_name, double p_value);
+		static void SerializeInt(BinaryWriter& p_writer, const std::string& p_name, int p_value);
+		static void SerializeUint32(BinaryWriter& p_writer, const std::string& p_name, uint32_t p_value);
+		static void SerializeInt64(BinaryWriter& p_writer, const std::string& p_name, int64_t p_value);
+		static void SerializeVec2(BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FVector2& p_value);
+		static void SerializeVec3(BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FVector3& p_value);
+		static void SerializeVec4(BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FVector4& p_value);
+		static void SerializeMat4(BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FMatrix4& p_value);
+		static void SerializeQuat(BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FQuaternion& p_value);
+		static void SerializeColor(BinaryWriter& p_writer, const std::string& p_name, const OvUI::Types::Color& p_value);
+		static void SerializeModel(BinaryWriter& p_writer, const std::string& p_name, OvRendering::Resources::Model* p_value);
+		static void SerializeTexture(BinaryWriter& p_writer, const std::string& p_name, OvRendering::Resources::Texture* p_value);
+		static void SerializeShader(BinaryWriter& p_writer, const std::string& p_name, OvRendering::Resources::Shader* p_value);
+		static void SerializeMaterial(BinaryWriter& p_writer, const std::string& p_name, OvCore::Resources::Material* p_value);
+		static void SerializeSound(BinaryWriter& p_writer, const std::string& p_name, OvAudio::Resources::Sound* p_value);
+		#pragma endregion
+
 		#pragma region DESERIALIZATION_HELPERS
 		static void DeserializeBoolean(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node, const std::string& p_name, bool& p_out);
 		static void DeserializeString(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node, const std::string& p_name, std::string& p_out);
@@ -104,5 +131,45 @@ namespace OvCore::Helpers
 		static OvCore::Resources::Material* DeserializeMaterial(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node, const std::string& p_name);
 		static OvAudio::Resources::Sound* DeserializeSound(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node, const std::string& p_name);
 		#pragma endregion
+
+		#pragma region BINARY_DESERIALIZATION_HELPERS
+		static void DeserializeBoolean(const BinaryNode& p_node, const std::string& p_name, bool& p_out);
+		static void DeserializeString(const BinaryNode& p_node, const std::string& p_name, std::string& p_out);
+		static void DeserializeFloat(const BinaryNode& p_node, const std::string& p_name, float& p_out);
+		static void DeserializeDouble(const BinaryNode& p_node, const std::string& p_name, double& p_out);
+		static void DeserializeInt(const BinaryNode& p_node, const std::string& p_name, int& p_out);
+		static void DeserializeUint32(const BinaryNode& p_node, const std::string& p_name, uint32_t& p_out);
+		static void DeserializeInt64(const BinaryNode& p_node, const std::string& p_name, int64_t& p_out);
+		static void DeserializeVec2(const BinaryNode& p_node, const std::string& p_name, OvMaths::FVector2& p_out);
+		static void DeserializeVec3(const BinaryNode& p_node, const std::string& p_name, OvMaths::FVector3& p_out);
+		static void DeserializeVec4(const BinaryNode& p_node, const std::string& p_name, OvMaths::FVector4& p_out);
+		static void DeserializeMat4(const BinaryNode& p_node, const std::string& p_name, OvMaths::FMatrix4& p_out);
+		static void DeserializeQuat(const BinaryNode& p_node, const std::string& p_name, OvMaths::FQuaternion& p_out);
+		static void DeserializeColor(const BinaryNode& p_node, const std::string& p_name, OvUI::Types::Color& p_out);
+		static void DeserializeModel(const BinaryNode& p_node, const std::string& p_name, OvRendering::Resources::Model*& p_out);
+		static void DeserializeTexture(const BinaryNode& p_node, const std::string& p_name, OvRendering::Resources::Texture*& p_out);
+		static void DeserializeShader(const BinaryNode& p_node, const std::string& p_name, OvRendering::Resources::Shader*& p_out);
+		static void DeserializeMaterial(const BinaryNode& p_node, const std::string& p_name, OvCore::Resources::Material*& p_out);
+		static void DeserializeSound(const BinaryNode& p_node, const std::string& p_name, OvAudio::Resources::Sound*& p_out);
+
+		static bool DeserializeBoolean(const BinaryNode& p_node, const std::string& p_name);
+		static std::string DeserializeString(const BinaryNode& p_node, const std::string& p_name);
+		static float DeserializeFloat(const BinaryNode& p_node, const std::string& p_name);
+		static double DeserializeDouble(const BinaryNode& p_node, const std::string& p_name);
+		static int DeserializeInt(const BinaryNode& p_node, const std::string& p_name);
+		static uint32_t DeserializeUint32(const BinaryNode& p_node, const std::string& p_name);
+		static int64_t DeserializeInt64(const BinaryNode& p_node, const std::string& p_name);
+		static OvMaths::FVector2 DeserializeVec2(const BinaryNode& p_node, const std::string& p_name);
+		static OvMaths::FVector3 DeserializeVec3(const BinaryNode& p_node, const std::string& p_name);
+		static OvMaths::FVector4 DeserializeVec4(const BinaryNode& p_node, const std::string& p_name);
+		static OvMaths::FMatrix4 DeserializeMat4(const BinaryNode& p_node, const std::string& p_name);
+		static OvMaths::FQuaternion DeserializeQuat(const BinaryNode& p_node, const std::string& p_name);
+		static OvUI::Types::Color DeserializeColor(const BinaryNode& p_node, const std::string& p_name);
+		static OvRendering::Resources::Model* DeserializeModel(const BinaryNode& p_node, const std::string& p_name);
+		static OvRendering::Resources::Texture* DeserializeTexture(const BinaryNode& p_node, const std::string& p_name);
+		static OvRendering::Resources::Shader* DeserializeShader(const BinaryNode& p_node, const std::string& p_name);
+		static OvCore::Resources::Material* DeserializeMaterial(const BinaryNode& p_node, const std::string& p_name);
+		static OvAudio::Resources::Sound* DeserializeSound(const BinaryNode& p_node, const std::string& p_name);
+		#pragma endregion
 	};
 }
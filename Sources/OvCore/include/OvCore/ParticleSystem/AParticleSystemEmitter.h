@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <OvMaths/FVector3.h>
 
 #include "OvCore/ParticleSystem/ParticleSystemParticle.h"
@@ -20,6 +22,11 @@ namespace OvCore::ParticleSystem
 	class AParticleEmitter
 	{
 	public:
+		/**
+		* Give the emitter its own random sequence, so emitters can be simulated concurrently
+		*/
+		AParticleEmitter();
+
 		virtual ~AParticleEmitter() = default;
 
 		/**
@@ -29,11 +36,25 @@ namespace OvCore::ParticleSystem
 		virtual void InitParticle(ParticleSystemParticle& p_particle) = 0;
 
 		/**
-		* Accumulate emission time and acquire slots from the pool for newly spawned particles.
-		* @param p_pool       Particle pool to acquire slots from
+		* Accumulate emission time and spawn newly emitted particles in the pool.
+		* @param p_pool       Particle pool to spawn particles in
 		* @param p_deltaTime  Frame delta time in seconds
 		*/
 		virtual void Emit(ParticlePool& p_pool, float p_deltaTime) = 0;
+
+		/**
+		* Forget the accumulated emission time, so the emission starts over.
+		*/
+		virtual void Restart() = 0;
+
+	protected:
+		/**
+		* Returns the next value of the emitter random sequence, in [-1, 1]
+		*/
+		float RandF();
+
+	private:
+		uint32_t m_seed;
 	};
 
 	/**
@@ -59,6 +80,7 @@ namespace OvCore::ParticleSystem
 
 		virtual void InitParticle(ParticleSystemParticle& p_particle) override;
 		virtual void Emit(ParticlePool& p_pool, float p_deltaTime) override;
+		virtual void Restart() override;
 
 	public:
 		float emissionRate;
@@ -98,6 +120,7 @@ namespace OvCore::ParticleSystem
 
 		virtual void InitParticle(ParticleSystemParticle& p_particle) override;
 		virtual void Emit(ParticlePool& p_pool, float p_deltaTime) override;
+		virtual void Restart() override;
 
 	public:
 		float emissionRate;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -20,12 +21,14 @@
 #include "OvCore/Resources/Material.h"
 
 namespace OvCore::ECS { class Actor; }
+namespace OvCore::ParticleSystem { class ParticleSimulator; }
 
 namespace OvCore::ECS::Components
 {
 	/**
 	* Component that manages a CPU-simulated billboard particle system.
 	* Attach an emitter and optional affectors, then assign a material.
+	* The particle systems of a scene are simulated as a batch by its ParticleSimulator.
 	*/
 	class CParticleSystem : public AComponent
 	{
@@ -36,7 +39,6 @@ namespace OvCore::ECS::Components
 		virtual std::string GetTypeName() override;
 
 		virtual void OnAwake() override;
-		virtual void OnUpdate(float p_deltaTime) override;
 
 		virtual void OnSerialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
@@ -57,21 +59,41 @@ namespace OvCore::ECS::Components
 		*/
 		void Reset();
 
+		/**
+		* Kill every live particle and restart the emission, as if the system was just created.
+		* The settings (Emitter, affectors and material) are kept.
+		*/
+		void Restart();
+
 		/**
 		* Material used to render the particle quads.
 		*/
 		OvCore::Resources::Material* material = nullptr;
 
 		/**
-		* Rebuild the billboard mesh using the given camera right/up vectors.
+		* Emit, update and release particles, then pack the live ones in the mesh instance stream.
+		* Only touches this system (And reads the owner world position), so different systems can be simulated concurrently.
+		* @param p_deltaTime
+		*/
+		void Simulate(float p_deltaTime);
+
+		/**
+		* Report that a camera rendered the scene containing this system since the last simulation.
+		* Used to throttle the simulation of the systems that are off-screen or far from every camera.
 		* Called by the SceneRenderer during ParseScene.
-		* @param p_cameraRight  Camera's right vector in world space
-		* @param p_cameraUp     Camera's up vector in world space
+		* @param p_inFrustum  True if the system bounds intersect the camera frustum
+		* @param p_distance   Distance from the camera to the system bounds
 		*/
-		void RebuildMesh(
-			const OvMaths::FVector3& p_cameraRight,
-			const OvMaths::FVector3& p_cameraUp
-		);
+		void NotifyViewed(bool p_inFrustum, float p_distance);
+
+		/**
+		* Upload the live particles to the mesh instance stream, if they (Or the owner position) changed since the last upload.
+		* Billboards are expanded on the GPU, so the same mesh is valid for every camera rendering the frame, unless
+		* the material is blendable: particles are then sorted back-to-front relative to the camera being rendered.
+		* Called by the SceneRenderer during ParseScene.
+		* @param p_viewPosition
+		*/
+		void RebuildMesh(const OvMaths::FVector3& p_viewPosition);
 
 		/**
 		* Returns the dynamic mesh (may be empty if no live particles).
@@ -105,11 +127,26 @@ namespace OvCore::ECS::Components
 		*/
 		static OvTools::Eventing::Event<CParticleSystem&> OpenInEditorRequestEvent;
 
+	private:
+		friend class ParticleSystem::ParticleSimulator;
+
+		void UpdateAffectorCapabilities();
+
 	private:
 		std::unique_ptr<ParticleSystem::AParticleEmitter>              m_emitter;
 		std::vector<std::unique_ptr<ParticleSystem::AParticleAffector>> m_affectors;
+		ParticleSystem::EAffectorCapabilities                           m_affectorCapabilities = ParticleSystem::EAffectorCapabilities::NONE;
 		ParticleSystem::ParticlePool                                    m_pool;
 		ParticleSystem::ParticleMesh                                    m_mesh;
+		OvMaths::FVector3                                               m_meshOrigin;
+		bool                                                            m_meshDirty = false;
+		OvMaths::FVector3                                               m_sortViewPosition;
+
+		// Simulation scheduling, driven by the ParticleSimulator
+		float                                                           m_pendingTime = 0.0f;
+		uint32_t                                                        m_skippedFrames = 0;
+		bool                                                            m_inFrustum = false;
+		float                                                           m_viewDistance = std::numeric_limits<float>::infinity();
 	};
 
 	template<>
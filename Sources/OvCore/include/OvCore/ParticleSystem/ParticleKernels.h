@@ -0,0 +1,78 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace OvCore::ParticleSystem::Kernels
+{
+	/**
+	* Whole-array operations used to update particle attribute streams.
+	* Vectorized with SSE when available (Any x64 target), with a scalar path for the remaining elements.
+	* Arrays don't need any specific alignment
+	*/
+
+	/**
+	* p_dst[i] += p_value
+	* @param p_dst
+	* @param p_value
+	* @param p_count
+	*/
+	void Add(float* p_dst, float p_value, uint32_t p_count);
+
+	/**
+	* p_dst[i] += p_src[i] * p_scale
+	* @param p_dst
+	* @param p_src
+	* @param p_scale
+	* @param p_count
+	*/
+	void MultiplyAdd(float* p_dst, const float* p_src, float p_scale, uint32_t p_count);
+
+	/**
+	* p_dst[i] = p_numerator[i] / p_denominator[i]
+	* @param p_dst
+	* @param p_numerator
+	* @param p_denominator
+	* @param p_count
+	*/
+	void Divide(float* p_dst, const float* p_numerator, const float* p_denominator, uint32_t p_count);
+
+	/**
+	* Evaluate a three-key gradient (start -> mid -> end) at the normalized age of each particle
+	* (1 - timeToLive / totalTimeToLive) and write the result to p_dst
+	* @param p_dst
+	* @param p_timeToLive
+	* @param p_totalTimeToLive
+	* @param p_start
+	* @param p_mid
+	* @param p_end
+	* @param p_midTime (Normalized age at which p_mid is reached)
+	* @param p_count
+	*/
+	void Gradient(float* p_dst, const float* p_timeToLive, const float* p_totalTimeToLive, float p_start, float p_mid, float p_end, float p_midTime, uint32_t p_count);
+
+	/**
+	* Sort key of a particle, along with the index of the particle it was computed for
+	*/
+	struct SortEntry
+	{
+		uint32_t key;
+		uint32_t index;
+	};
+
+	/**
+	* Sort entries by ascending key, starting from their current order.
+	* Uses an insertion sort, which is linear when the entries are almost sorted already (Ex: in the order of the previous frame),
+	* and falls back to a radix sort (3 passes of 11 bits) when too many entries are out of order, or had to be moved.
+	* Returns true if the order changed
+	* @param p_entries
+	* @param p_scratch (Resized as needed, only used by the radix sort)
+	*/
+	bool SortIncremental(std::vector<SortEntry>& p_entries, std::vector<SortEntry>& p_scratch);
+}
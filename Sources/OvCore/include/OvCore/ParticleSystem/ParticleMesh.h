@@ -6,53 +6,137 @@
 
 #pragma once
 
+#include <memory>
 #include <span>
 #include <vector>
 
+#include <OvMaths/FVector3.h>
 #include <OvRendering/Geometry/Vertex.h>
 #include <OvRendering/Geometry/BoundingSphere.h>
 #include <OvRendering/HAL/VertexArray.h>
 #include <OvRendering/HAL/VertexBuffer.h>
 #include <OvRendering/HAL/IndexBuffer.h>
+#include <OvRendering/HAL/ShaderStorageBuffer.h>
 #include <OvRendering/Resources/IMesh.h>
 
+#include "OvCore/ParticleSystem/ParticleKernels.h"
+#include "OvCore/ParticleSystem/ParticlePool.h"
+
 namespace OvCore::ParticleSystem
 {
+	/**
+	* Compact per-particle data read by the particle vertex shader (std430 layout of ParticleSSBO).
+	* The billboard of each particle is expanded on the GPU, facing the camera being rendered
+	*/
+	struct ParticleInstance
+	{
+		float    position[3]; // World space
+		float    size;
+		uint32_t color;       // RGBA, 8 bits unorm per channel
+		uint32_t uvMin;       // Left-bottom UV, 16 bits unorm per component
+		uint32_t uvMax;       // Right-top UV, 16 bits unorm per component
+		uint32_t padding;
+	};
+
+	static_assert(sizeof(ParticleInstance) == 32, "ParticleInstance must match the std430 layout of ParticleSSBO");
+
 	/**
 	* A dynamic mesh that can be re-uploaded every frame.
-	* Used to render billboard quads for each live particle.
+	* Live particles are uploaded as a stream of ParticleInstance (Bound as a shader storage buffer), and the
+	* vertex shader pulls the instance of each vertex from gl_VertexID (4 vertices and 6 indices per particle).
+	* The same stream is valid for every camera and reflection face rendered during the frame.
+	* GPU resources are only created by the first Upload(), so particles can be simulated and packed without a graphics context.
 	*/
 	class ParticleMesh : public OvRendering::Resources::IMesh
 	{
 	public:
+		/**
+		* Binding point of the instance stream (ParticleSSBO in the particle shader)
+		*/
+		static constexpr uint32_t kInstanceBufferBinding = 1;
+
 		ParticleMesh();
+		~ParticleMesh();
+
+		/**
+		* Pack the live particles of the pool into the instance stream, and fit the bounding sphere around them.
+		* Only touches CPU memory, so meshes can be packed from worker threads.
+		* @param p_pool    Particles to pack
+		* @param p_origin  World position added to every particle
+		*/
+		void Pack(const ParticlePool& p_pool, const OvMaths::FVector3& p_origin);
+
+		/**
+		* Reorder the instance stream back-to-front relative to the given view position, for alpha blending.
+		* The sort starts from the order of the previous one (Kept across Pack() calls), so it stays cheap while
+		* the particles and the view move smoothly. Returns true if the order changed
+		* @param p_viewPosition
+		*/
+		bool Sort(const OvMaths::FVector3& p_viewPosition);
 
 		/**
-		* Re-upload vertex and index data to the GPU.
+		* Upload the instance stream of the last Pack() (Or Sort()) to the GPU.
 		* Call this once per frame before submitting the drawable.
 		*/
-		void Update(
-			std::span<const OvRendering::Geometry::Vertex> p_vertices,
-			std::span<const uint32_t> p_indices
+		void Upload();
+
+		/**
+		* Returns the instance stream of the last update
+		*/
+		std::span<const ParticleInstance> GetInstances() const;
+
+		/**
+		* CPU reference of the billboard expansion done by the particle vertex shader.
+		* Used where the instance stream can't be drawn (None backend), and to validate the GPU output.
+		* @param p_instances    Instance stream to expand
+		* @param p_cameraRight  Camera's right vector in world space
+		* @param p_cameraUp     Camera's up vector in world space
+		* @param p_vertices     Output vertices (4 per particle)
+		* @param p_indices      Output indices (6 per particle)
+		*/
+		static void ExpandBillboards(
+			std::span<const ParticleInstance> p_instances,
+			const OvMaths::FVector3& p_cameraRight,
+			const OvMaths::FVector3& p_cameraUp,
+			std::vector<OvRendering::Geometry::Vertex>& p_vertices,
+			std::vector<uint32_t>& p_indices
 		);
 
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 		virtual uint32_t GetVertexCount() const override;
 		virtual uint32_t GetIndexCount() const override;
+
+		/**
+		* Returns the sphere enclosing the particle quads, in world space
+		*/
 		virtual const OvRendering::Geometry::BoundingSphere& GetBoundingSphere() const override;
 
 	private:
-		void SetupLayout();
+		void ReserveQuads(uint32_t p_quadCount);
+		void UpdateOrder(uint32_t p_count);
 
 	private:
-		OvRendering::HAL::VertexArray  m_vertexArray;
-		OvRendering::HAL::VertexBuffer m_vertexBuffer;
-		OvRendering::HAL::IndexBuffer  m_indexBuffer;
+		struct GPUResources
+		{
+			OvRendering::HAL::VertexArray         vertexArray;
+			OvRendering::HAL::VertexBuffer        vertexBuffer; // Never filled, vertices are pulled from the instance stream
+			OvRendering::HAL::IndexBuffer         indexBuffer;
+			OvRendering::HAL::ShaderStorageBuffer instanceBuffer;
+		};
+
+		std::unique_ptr<GPUResources>         m_gpu;
 		OvRendering::Geometry::BoundingSphere m_boundingSphere{};
 
-		uint32_t m_vertexCount = 0;
-		uint32_t m_indexCount  = 0;
-		bool     m_layoutReady = false;
+		std::vector<ParticleInstance> m_instances;
+
+		// Pool index of the particle packed in each instance slot, in the order of the last sort (Empty until sorted once)
+		std::vector<uint32_t> m_order;
+		std::vector<Kernels::SortEntry> m_sortEntries;
+		std::vector<Kernels::SortEntry> m_sortScratch;
+		std::vector<ParticleInstance> m_sortedInstances;
+		std::vector<uint32_t> m_sortedOrder;
+
+		uint32_t m_quadCapacity = 0;
 	};
 }
@@ -14,35 +14,65 @@
 namespace OvCore::ParticleSystem
 {
 	/**
-	* Fixed-capacity object pool for ParticleSystemParticle.
-	* Uses a free-list for O(1) acquire and release with no heap allocation after construction.
+	* Fixed-capacity particle storage, laid out as structure-of-arrays (One float stream per attribute).
+	* Live particles are packed in [0, GetActiveCount()): spawning appends to the live range and killing
+	* a particle moves the last live one into its slot, so updates only touch live particles and each
+	* attribute can be processed as a whole contiguous array. No heap allocation after construction.
 	*/
 	class ParticlePool
 	{
 	public:
 		static constexpr uint32_t kDefaultCapacity = 1000;
 
+		/**
+		* Attribute streams of the pool
+		*/
+		enum class EStream : uint8_t
+		{
+			POSITION_X,
+			POSITION_Y,
+			POSITION_Z,
+			VELOCITY_X,
+			VELOCITY_Y,
+			VELOCITY_Z,
+			COLOR_R,
+			COLOR_G,
+			COLOR_B,
+			COLOR_A,
+			UV_LEFT,
+			UV_BOTTOM,
+			UV_RIGHT,
+			UV_TOP,
+			SIZE,
+			TIME_TO_LIVE,
+			TOTAL_TIME_TO_LIVE,
+			COUNT
+		};
+
 		explicit ParticlePool(uint32_t p_capacity = kDefaultCapacity);
 
 		/**
-		* Acquire a free slot from the pool.
-		* @return Pointer to an inactive particle slot, or nullptr if the pool is full.
+		* Append a particle at the end of the live range.
+		* @param p_particle  Attributes of the new particle
+		* @return false if the pool is full.
 		*/
-		ParticleSystemParticle* Acquire();
+		bool Spawn(const ParticleSystemParticle& p_particle);
 
 		/**
-		* Return a particle back to the pool and mark it inactive.
-		* @param p_particle  Must be a reference to a slot owned by this pool.
+		* Kill a live particle by moving the last live particle into its slot.
+		* The order of the live particles isn't preserved.
+		* @param p_index  Index of a live particle (< GetActiveCount())
 		*/
-		void Release(ParticleSystemParticle& p_particle);
+		void Kill(uint32_t p_index);
 
 		/**
-		* Access all slots (both active and inactive).
-		* Callers should check the `active` flag before processing each slot.
+		* Access the given attribute stream. Only the first GetActiveCount() values are live.
+		* @param p_stream
 		*/
-		std::vector<ParticleSystemParticle>& GetSlots();
-		const std::vector<ParticleSystemParticle>& GetSlots() const;
+		float* GetStream(EStream p_stream);
+		const float* GetStream(EStream p_stream) const;
 
+		bool IsFull() const;
 		uint32_t GetActiveCount() const;
 		uint32_t GetCapacity() const;
 
@@ -52,13 +82,13 @@ namespace OvCore::ParticleSystem
 		void Resize(uint32_t p_capacity);
 
 		/**
-		* Mark all slots inactive and rebuild the free-list.
+		* Kill every particle.
 		*/
 		void Clear();
 
 	private:
-		std::vector<ParticleSystemParticle> m_slots;
-		std::vector<uint32_t>               m_freeList;
-		uint32_t                            m_activeCount = 0;
+		std::vector<float> m_data;
+		uint32_t           m_capacity    = 0;
+		uint32_t           m_activeCount = 0;
 	};
 }
@@ -0,0 +1,73 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace OvCore::ECS::Components { class CParticleSystem; }
+
+namespace OvCore::ParticleSystem
+{
+	/**
+	* Simulates the particle systems of a scene as a batch, spread over the default thread pool.
+	* Systems that are off-screen or far from every camera are simulated less often (With the accumulated time),
+	* and the systems exceeding the per-frame particle budget are deferred to the next frames
+	*/
+	class ParticleSimulator
+	{
+	public:
+		struct Settings
+		{
+			uint32_t particleBudget = 250000;   // Particles simulated per frame (0 for unlimited), the most urgent systems go first
+			float    throttleDistance = 50.0f;  // Distance from the closest camera above which a system is considered far
+			uint32_t farInterval = 2;           // Frames between two simulations of a far system
+			uint32_t hiddenInterval = 4;        // Frames between two simulations of a system outside of every camera frustum
+			float    maxStep = 0.25f;           // Longest time simulated at once, older pending time is dropped
+		};
+
+		struct Statistics
+		{
+			uint32_t systemCount = 0;
+			uint32_t simulatedSystemCount = 0;
+			uint32_t throttledSystemCount = 0;
+			uint32_t deferredSystemCount = 0;
+			uint32_t liveParticleCount = 0;
+			uint32_t simulatedParticleCount = 0;
+			double   simulationTime = 0.0;      // Milliseconds
+		};
+
+		/**
+		* Simulate the given particle systems for this frame
+		* @param p_systems
+		* @param p_deltaTime
+		*/
+		void Simulate(std::span<ECS::Components::CParticleSystem* const> p_systems, float p_deltaTime);
+
+		/**
+		* Returns the statistics of the last simulated frame
+		*/
+		const Statistics& GetStatistics() const;
+
+	public:
+		Settings settings;
+
+	private:
+		struct Job
+		{
+			ECS::Components::CParticleSystem* system;
+			float deltaTime;
+			bool inFrustum;
+			float viewDistance;
+		};
+
+		std::vector<Job> m_candidates;
+		std::vector<Job> m_jobs;
+		Statistics m_statistics;
+	};
+}
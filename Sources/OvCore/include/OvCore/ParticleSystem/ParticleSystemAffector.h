@@ -6,12 +6,29 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <OvMaths/FVector4.h>
 
-#include "OvCore/ParticleSystem/ParticleSystemParticle.h"
+#include "OvCore/ParticleSystem/ParticlePool.h"
 
 namespace OvCore::ParticleSystem
 {
+	/**
+	* Particle attributes written by an affector
+	*/
+	enum class EAffectorCapabilities : uint8_t
+	{
+		NONE = 0,
+		VELOCITY = 1 << 0,
+		COLOR = 1 << 1
+	};
+
+	inline EAffectorCapabilities operator| (EAffectorCapabilities a, EAffectorCapabilities b) { return (EAffectorCapabilities)((int)a | (int)b); }
+	inline EAffectorCapabilities operator& (EAffectorCapabilities a, EAffectorCapabilities b) { return (EAffectorCapabilities)((int)a & (int)b); }
+	inline EAffectorCapabilities& operator|= (EAffectorCapabilities& a, EAffectorCapabilities b) { return a = a | b; }
+	inline bool IsFlagSet(EAffectorCapabilities p_flag, EAffectorCapabilities p_mask) { return (int)p_flag & (int)p_mask; }
+
 	/**
 	* Abstract base for particle affectors.
 	* Affectors modify existing particles each frame (e.g. gravity, drag).
@@ -22,11 +39,17 @@ namespace OvCore::ParticleSystem
 		virtual ~AParticleAffector() = default;
 
 		/**
-		* Apply the affector to a single particle.
-		* @param p_particle   Particle to modify
+		* Returns the particle attributes written by this affector.
+		* Resolved by the particle system when its affectors change, not every frame.
+		*/
+		virtual EAffectorCapabilities GetCapabilities() const = 0;
+
+		/**
+		* Apply the affector to every live particle of the pool, one attribute stream at a time.
+		* @param p_pool       Pool holding the particles to modify
 		* @param p_deltaTime  Frame delta time in seconds
 		*/
-		virtual void Apply(ParticleSystemParticle& p_particle, float p_deltaTime) = 0;
+		virtual void Apply(ParticlePool& p_pool, float p_deltaTime) = 0;
 	};
 
 	/**
@@ -36,7 +59,8 @@ namespace OvCore::ParticleSystem
 	{
 	public:
 		explicit GravityAffector(float p_gravity = 9.8f);
-		virtual void Apply(ParticleSystemParticle& p_particle, float p_deltaTime) override;
+		virtual EAffectorCapabilities GetCapabilities() const override;
+		virtual void Apply(ParticlePool& p_pool, float p_deltaTime) override;
 
 	public:
 		float gravity;
@@ -56,7 +80,8 @@ namespace OvCore::ParticleSystem
 			float p_midTime                       = 0.5f
 		);
 
-		virtual void Apply(ParticleSystemParticle& p_particle, float p_deltaTime) override;
+		virtual EAffectorCapabilities GetCapabilities() const override;
+		virtual void Apply(ParticlePool& p_pool, float p_deltaTime) override;
 
 	public:
 		OvMaths::FVector4 startColor;
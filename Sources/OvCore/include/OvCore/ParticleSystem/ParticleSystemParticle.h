@@ -12,6 +12,10 @@
 
 namespace OvCore::ParticleSystem
 {
+	/**
+	* Attributes of a single particle, used to initialize a particle before it gets
+	* spawned in a ParticlePool (Which stores its particles as one array per attribute)
+	*/
 	struct ParticleSystemParticle
 	{
 		OvMaths::FVector3 position;
@@ -22,6 +26,5 @@ namespace OvCore::ParticleSystem
 		float size;
 		float timeToLive;
 		float totalTimeToLive;
-		bool  active = false;
 	};
 }
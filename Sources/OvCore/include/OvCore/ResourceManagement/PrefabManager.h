@@ -0,0 +1,39 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/Resources/Loaders/PrefabLoader.h"
+#include "OvCore/ResourceManagement/AResourceManager.h"
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* ResourceManager of prefabs
+	*/
+	class PrefabManager : public AResourceManager<OvCore::Resources::Prefab>
+	{
+	public:
+		/**
+		* Create the resource identified by the given path
+		* @param p_path
+		*/
+		virtual OvCore::Resources::Prefab* CreateResource(const std::filesystem::path & p_path) override;
+
+		/**
+		* Destroy the given resource
+		* @param p_resource
+		*/
+		virtual void DestroyResource(OvCore::Resources::Prefab* p_resource) override;
+
+		/**
+		* Reload the given resource
+		* @param p_resource
+		* @param p_path
+		*/
+		virtual void ReloadResource(OvCore::Resources::Prefab* p_resource, const std::filesystem::path& p_path) override;
+	};
+}
\ No newline at end of file
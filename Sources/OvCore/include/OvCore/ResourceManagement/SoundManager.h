@@ -18,6 +18,18 @@ namespace OvCore::ResourceManagement
 	class SoundManager : public AResourceManager<OvAudio::Resources::Sound>
 	{
 	public:
+		/**
+		* Register the sound identified by the given path, its audio data being loaded by a worker thread.
+		* Returns the registered sound right away (See OvAudio::Resources::Sound::IsLoaded)
+		* @param p_path
+		*/
+		OvAudio::Resources::Sound* LoadResourceAsync(const std::filesystem::path& p_path);
+
+		/**
+		* Returns the memory, in bytes, used by the decoded audio data of every registered sound
+		*/
+		size_t GetMemoryUsage();
+
 		/**
 		* Create the resource identified by the given path
 		* @param p_path
@@ -37,4 +49,4 @@ namespace OvCore::ResourceManagement
 		*/
 		virtual void ReloadResource(OvAudio::Resources::Sound* p_resource, const std::filesystem::path& p_path) override;
 	};
-}
\ No newline at end of file
+}
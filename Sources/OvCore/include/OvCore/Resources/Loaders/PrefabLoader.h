@@ -0,0 +1,50 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/Resources/Prefab.h"
+
+namespace OvCore::Resources::Loaders
+{
+	/**
+	* Handle the creation of prefabs
+	*/
+	class PrefabLoader
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		PrefabLoader() = delete;
+
+		/**
+		* Instantiate a prefab from a file (Binary or XML)
+		* @param p_path
+		*/
+		static Prefab* Create(const std::string& p_path);
+
+		/**
+		* Reload the prefab using the given file path
+		* @param p_prefab
+		* @param p_path
+		*/
+		static void Reload(Prefab& p_prefab, const std::string& p_path);
+
+		/**
+		* Save the prefab to the given path
+		* @param p_prefab
+		* @param p_path
+		*/
+		static void Save(const Prefab& p_prefab, const std::string& p_path);
+
+		/**
+		* Destroy the given prefab
+		* @param p_prefab
+		*/
+		static bool Destroy(Prefab*& p_prefab);
+	};
+}
@@ -0,0 +1,75 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OvCore::ECS { class Actor; }
+
+namespace OvCore::Resources
+{
+	/**
+	* Reusable actor hierarchy. The blueprint is decoded once, when the prefab is loaded, into an inert
+	* template hierarchy: template actors are never awakened and don't belong to any scene, so they keep
+	* the state of the blueprint, with their resources already resolved. Instances are cloned from it
+	*/
+	class Prefab
+	{
+	public:
+		/**
+		* Creates an empty prefab
+		*/
+		Prefab();
+
+		/**
+		* Destructor
+		*/
+		~Prefab();
+
+		Prefab(const Prefab&) = delete;
+		Prefab& operator=(const Prefab&) = delete;
+
+		/**
+		* Replace the blueprint with the given actor and its descendants
+		* @param p_root
+		*/
+		void Capture(ECS::Actor& p_root);
+
+		/**
+		* Replace the blueprint with the given binary document, and decode it into the template hierarchy.
+		* Returns true on success
+		* @param p_data
+		*/
+		bool Load(std::vector<uint8_t> p_data);
+
+		/**
+		* Returns true if the prefab doesn't contain any actor
+		*/
+		bool IsEmpty() const;
+
+		/**
+		* Returns the encoded blueprint
+		*/
+		const std::vector<uint8_t>& GetData() const;
+
+		/**
+		* Returns the root of the template hierarchy (Or nullptr if the prefab is empty)
+		*/
+		ECS::Actor* GetRoot() const;
+
+	public:
+		const std::string path;
+
+	private:
+		std::vector<uint8_t> m_data;
+		bool m_playing = false; // Template actors never play
+		std::vector<std::unique_ptr<ECS::Actor>> m_template; // Pre-order, the root comes first
+	};
+}
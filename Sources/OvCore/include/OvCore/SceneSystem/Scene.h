@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <span>
 
 #include <OvCore/API/ISerializable.h>
 #include <OvCore/ECS/Actor.h>
@@ -15,6 +16,9 @@
 #include <OvCore/ECS/Components/CPostProcessStack.h>
 #include <OvCore/ECS/Components/CReflectionProbe.h>
 #include <OvCore/ParticleSystem/CParticleSystem.h>
+#include <OvCore/ParticleSystem/ParticleSimulator.h>
+
+namespace OvCore::Resources { class Prefab; }
 
 namespace OvCore::SceneSystem
 {
@@ -83,25 +87,30 @@ namespace OvCore::SceneSystem
 		*/
 		void Play();
 
+		/**
+		* Stop playing the scene. Actors react to OnDisable and OnDestroy as if the scene was destroyed, then go back to sleep
+		*/
+		void Stop();
+
 		/**
 		* Returns true if the scene is playing
 		*/
 		bool IsPlaying() const;
 
 		/**
-		* Update every actors
+		* Call OnUpdate on every active component declaring it, then simulate the particle systems
 		* @param p_deltaTime
 		*/
 		void Update(float p_deltaTime);
 
 		/**
-		* Update every actors 60 frames per seconds
+		* Call OnFixedUpdate on every active component declaring it
 		* @param p_deltaTime
 		*/
 		void FixedUpdate(float p_deltaTime);
 
 		/**
-		* Update every actors lately
+		* Call OnLateUpdate on every active component declaring it
 		* @param p_deltaTime
 		*/
 		void LateUpdate(float p_deltaTime);
@@ -124,6 +133,31 @@ namespace OvCore::SceneSystem
 		*/
 		bool DestroyActor(ECS::Actor& p_target);
 
+		/**
+		* Create a copy of the given actor (And its descendants) and return a reference to it.
+		* Components are copied through their typed CopyFrom hook, without going through serialization
+		* @param p_source
+		* @param p_parent (The parent of the copy, or nullptr to use the parent of the source)
+		*/
+		ECS::Actor& CloneActor(ECS::Actor& p_source, ECS::Actor* p_parent = nullptr);
+
+		/**
+		* Create an instance of the given prefab and return its root actor (Returns nullptr if the prefab is empty).
+		* The instance is cloned from the template hierarchy of the prefab (See CloneActor)
+		* @param p_prefab
+		* @param p_position
+		* @param p_rotation
+		*/
+		ECS::Actor* Instantiate(const Resources::Prefab& p_prefab, const OvMaths::FVector3& p_position, const OvMaths::FQuaternion& p_rotation = OvMaths::FQuaternion::Identity);
+
+		/**
+		* Create one instance of the given prefab per given position and return their root actors
+		* @param p_prefab
+		* @param p_positions
+		* @param p_rotation
+		*/
+		std::vector<ECS::Actor*> Instantiate(const Resources::Prefab& p_prefab, std::span<const OvMaths::FVector3> p_positions, const OvMaths::FQuaternion& p_rotation = OvMaths::FQuaternion::Identity);
+
 		/**
 		* Collect garbages by removing Destroyed-marked actors
 		*/
@@ -186,6 +220,11 @@ namespace OvCore::SceneSystem
 		*/
 		const FastAccessComponents& GetFastAccessComponents() const;
 
+		/**
+		* Return the simulator of the scene particle systems (Settings and statistics)
+		*/
+		ParticleSystem::ParticleSimulator& GetParticleSimulator();
+
 		/**
 		* Serialize the scene
 		* @param p_doc
@@ -200,11 +239,42 @@ namespace OvCore::SceneSystem
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_root) override;
 
+		/**
+		* Deserialize the scene from a binary document
+		* @param p_root
+		*/
+		virtual void OnDeserialize(const OvCore::Helpers::BinaryNode& p_root) override;
+
+	private:
+		/**
+		* Dense list of the components (And behaviours) declaring a given update callback.
+		* Components removed while the list is dispatched are nulled, and the list gets compacted once the dispatch is over
+		*/
+		struct UpdateList
+		{
+			std::vector<ECS::Components::AComponent*> components;
+			bool dispatching = false;
+			bool dirty = false;
+		};
+
+		void RecreateHierarchy();
+		void RegisterUpdateCallbacks(ECS::Components::AComponent& p_component);
+		void UnregisterUpdateCallbacks(ECS::Components::AComponent& p_component);
+		void UnregisterUpdateCallbacks(ECS::Components::AComponent& p_component, ECS::Components::EUpdateCallbacks p_callbacks);
+		void OnBehaviourUpdateCallbacksChanged(ECS::Components::Behaviour& p_behaviour, ECS::Components::EUpdateCallbacks p_previousCallbacks);
+		void DispatchUpdate(UpdateList& p_list, void(ECS::Components::AComponent::*p_callback)(float), float p_deltaTime);
+
 	private:
 		int64_t m_availableID = 1;
 		bool m_isPlaying = false;
 		std::vector<ECS::Actor*> m_actors;
 
 		FastAccessComponents m_fastAccessComponents;
+
+		UpdateList m_updateList;
+		UpdateList m_fixedUpdateList;
+		UpdateList m_lateUpdateList;
+
+		ParticleSystem::ParticleSimulator m_particleSimulator;
 	};
 }
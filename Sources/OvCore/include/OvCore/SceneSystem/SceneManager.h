@@ -10,6 +10,11 @@
 
 #include "OvCore/SceneSystem/Scene.h"
 
+namespace OvCore::Helpers
+{
+	class BinaryDocument;
+}
+
 namespace OvCore::SceneSystem
 {
 	/**
@@ -65,6 +70,12 @@ namespace OvCore::SceneSystem
 		*/
 		bool LoadSceneFromMemory(tinyxml2::XMLDocument& p_doc);
 
+		/**
+		* Load specific scene in memory from a binary document
+		* @param p_doc
+		*/
+		bool LoadSceneFromMemory(const OvCore::Helpers::BinaryDocument& p_doc);
+
 		/**
 		* Destroy current scene from memory
 		*/
@@ -0,0 +1,83 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OvCore::ECS
+{
+	class Actor;
+}
+
+namespace OvCore::SceneSystem
+{
+	class Scene;
+
+	/**
+	* In-memory copy of the state of a scene, used to restore it later (Ex: when leaving play mode).
+	* Every component is written directly into its own binary document, and restoring the snapshot
+	* only touches what changed since the capture
+	*/
+	class SceneSnapshot
+	{
+	public:
+		/**
+		* Capture the current state of the given scene (Replaces any previous capture)
+		* @param p_scene
+		*/
+		void Capture(Scene& p_scene);
+
+		/**
+		* Restore the captured state into the given scene, which is expected to be the captured one, and stopped.
+		* Existing actors and components are updated in place, and only deserialized if their state changed.
+		* Actors are only created or destroyed if their ID isn't in both the snapshot and the scene
+		* @param p_scene
+		*/
+		void Restore(Scene& p_scene) const;
+
+		/**
+		* Release the captured data
+		*/
+		void Clear();
+
+		/**
+		* Returns true if no scene has been captured
+		*/
+		bool IsEmpty() const;
+
+		/**
+		* Returns the size of the captured data in bytes
+		*/
+		size_t GetSize() const;
+
+	private:
+		struct ComponentState
+		{
+			std::string type; // Type name for components, script name for behaviours
+			std::vector<uint8_t> data;
+		};
+
+		struct ActorState
+		{
+			int64_t id;
+			int64_t parentID;
+			std::string name;
+			std::string tag;
+			bool active;
+			std::vector<ComponentState> components;
+			std::vector<ComponentState> behaviours;
+		};
+
+		void RestoreActor(ECS::Actor& p_actor, const ActorState& p_state) const;
+
+	private:
+		std::vector<ActorState> m_actors;
+		bool m_captured = false;
+	};
+}
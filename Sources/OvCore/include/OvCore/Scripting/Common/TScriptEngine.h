@@ -83,6 +83,12 @@ namespace OvCore::Scripting
 		*/
 		bool IsOk() const;
 
+		/**
+		* Called once per frame, after the scene update, to run the work scripts spread over several frames.
+		* @param p_deltaTime The time elapsed since the last frame.
+		*/
+		void Update(float p_deltaTime);
+
 		/**
 		* Called when a behaviour is awakened.
 		* @param p_target The target behaviour.
@@ -0,0 +1,121 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct lua_State;
+
+namespace OvCore::ECS::Components
+{
+	class Behaviour;
+}
+
+namespace OvCore::Scripting
+{
+	/**
+	* Resumes Lua coroutines once per frame. Coroutines yield what they wait for (The next frame, a duration, a number
+	* of frames or a condition) and are only resumed once it is fulfilled.
+	* Resuming doesn't allocate: each coroutine keeps its own Lua thread, created when it starts
+	*/
+	class LuaCoroutineScheduler
+	{
+	public:
+		/**
+		* What a coroutine waits for, yielded as its first value (Followed by the duration, frame count or condition)
+		*/
+		enum class EWait : uint8_t
+		{
+			FRAME,
+			SECONDS,
+			FRAMES,
+			CONDITION
+		};
+
+		/**
+		* Constructor of the scheduler
+		* @param p_luaState
+		*/
+		LuaCoroutineScheduler(lua_State* p_luaState);
+
+		/**
+		* Start a coroutine running the function on the caller stack, below the given number of arguments.
+		* The coroutine runs until it first yields, and is resumed by the next updates.
+		* Returns the identifier of the coroutine
+		* @param p_caller
+		* @param p_argumentCount
+		*/
+		uint32_t Start(lua_State* p_caller, int p_argumentCount);
+
+		/**
+		* Stop the coroutine with the given identifier (Nothing happens if it already ended)
+		* @param p_id
+		*/
+		void Stop(uint32_t p_id);
+
+		/**
+		* Stop the coroutines started by the given behaviour
+		* @param p_owner
+		*/
+		void StopAll(const OvCore::ECS::Components::Behaviour& p_owner);
+
+		/**
+		* Defines the behaviour executing Lua code, owning the coroutines it starts.
+		* Returns the previous one, to be restored once it returns
+		* @param p_owner
+		*/
+		const OvCore::ECS::Components::Behaviour* SetCurrentOwner(const OvCore::ECS::Components::Behaviour* p_owner);
+
+		/**
+		* Defines the time coroutines can run for each frame, in seconds (0 for no limit).
+		* Coroutines that didn't get to run are resumed first on the next frame
+		* @param p_seconds
+		*/
+		void SetFrameBudget(double p_seconds);
+
+		/**
+		* Returns the number of running coroutines
+		*/
+		size_t GetCoroutineCount() const;
+
+		/**
+		* Resume the coroutines that are done waiting
+		* @param p_deltaTime
+		*/
+		void Update(float p_deltaTime);
+
+	private:
+		struct Coroutine
+		{
+			lua_State* thread = nullptr;
+			int threadRef = -2;		// LUA_NOREF
+			int conditionRef = -2;	// LUA_NOREF
+			const OvCore::ECS::Components::Behaviour* owner = nullptr;
+			uint32_t id = 0;
+			EWait wait = EWait::FRAME;
+			uint64_t resumeFrame = 0;
+			double resumeTime = 0.0;
+			bool alive = true;
+		};
+
+		bool IsReady(size_t p_index);
+		void Resume(size_t p_index, int p_argumentCount, lua_State* p_from);
+		void Kill(Coroutine& p_coroutine);
+		void RemoveDeadCoroutines();
+
+	private:
+		lua_State* m_luaState;
+		std::vector<Coroutine> m_coroutines;
+		const OvCore::ECS::Components::Behaviour* m_currentOwner = nullptr;
+		uint32_t m_nextID = 1;
+		uint64_t m_frame = 0;
+		double m_time = 0.0;
+		double m_frameBudget = 0.0;
+		size_t m_cursor = 0;
+	};
+}
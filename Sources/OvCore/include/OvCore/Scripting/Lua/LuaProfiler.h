@@ -0,0 +1,117 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <OvCore/Scripting/Lua/LuaScript.h>
+
+struct lua_State;
+
+namespace OvCore::Scripting
+{
+	/**
+	* Gathers the time spent in each hook of each script, and the memory used by the Lua state.
+	* Memory is always tracked (The profiler is the allocator of the Lua state), hooks are only timed once enabled
+	*/
+	class LuaProfiler
+	{
+	public:
+		/**
+		* Timings of a hook, in seconds
+		*/
+		struct HookStatistics
+		{
+			uint64_t callCount = 0;
+			double totalTime = 0.0;
+			double maxTime = 0.0;
+		};
+
+		/**
+		* Timings of each hook of a script, indexed by ELuaHook
+		*/
+		using ScriptStatistics = std::array<HookStatistics, static_cast<size_t>(ELuaHook::COUNT)>;
+
+		/**
+		* Memory used by the Lua state. Frame counters cover the last frame
+		*/
+		struct MemoryStatistics
+		{
+			size_t heapSize = 0;
+			size_t peakHeapSize = 0;
+			uint64_t allocationCount = 0;
+			uint64_t frameAllocationCount = 0;
+			size_t frameAllocatedBytes = 0;
+			size_t frameFreedBytes = 0;
+			double gcStepTime = 0.0;	// Seconds spent in the last frame GC step (Only measured while enabled)
+		};
+
+		/**
+		* Allocation function of the Lua state (lua_Alloc), with the profiler as user data
+		* @param p_userData
+		* @param p_pointer
+		* @param p_oldSize
+		* @param p_newSize
+		*/
+		static void* Allocate(void* p_userData, void* p_pointer, size_t p_oldSize, size_t p_newSize);
+
+		/**
+		* Enable or disable hook timings. While enabled, a GC step is run and timed at the end of each frame
+		* @param p_enabled
+		*/
+		void SetEnabled(bool p_enabled);
+
+		/**
+		* Returns true if hooks are timed
+		*/
+		bool IsEnabled() const;
+
+		/**
+		* Record a hook call of the given script
+		* @param p_scriptName
+		* @param p_hook
+		* @param p_duration (In seconds)
+		*/
+		void RecordHook(const std::string& p_scriptName, ELuaHook p_hook, double p_duration);
+
+		/**
+		* Close the current frame: sends the plots to Tracy and resets the frame counters
+		* @param p_luaState
+		*/
+		void EndFrame(lua_State* p_luaState);
+
+		/**
+		* Clear the hook timings (Memory statistics are kept, they describe the current state)
+		*/
+		void ResetStatistics();
+
+		/**
+		* Clear the memory statistics, before creating a new Lua state
+		*/
+		void ResetMemoryStatistics();
+
+		/**
+		* Returns the hook timings of each script, by script name
+		*/
+		const std::unordered_map<std::string, ScriptStatistics>& GetScriptStatistics() const;
+
+		/**
+		* Returns the memory statistics of the Lua state
+		*/
+		const MemoryStatistics& GetMemoryStatistics() const;
+
+	private:
+		bool m_enabled = false;
+		double m_frameScriptTime = 0.0;
+		std::unordered_map<std::string, ScriptStatistics> m_scriptStatistics;
+		MemoryStatistics m_memoryStatistics;
+	};
+}
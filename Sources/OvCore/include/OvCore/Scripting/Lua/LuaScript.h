@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <memory>
 
 #include <OvCore/Scripting/Common/TScript.h>
@@ -26,16 +28,44 @@ namespace sol
 	template <bool b>
 	using table_core = basic_table_core<b, reference>;
 	using table = table_core<false>;
+
+	template <typename, bool, typename>
+	class basic_protected_function;
+	using protected_function = basic_protected_function<reference, false, reference>;
 }
 
 namespace OvCore::Scripting
 {
+	/**
+	* Functions a Lua script can implement, called by the engine
+	*/
+	enum class ELuaHook : uint8_t
+	{
+		AWAKE,
+		START,
+		ENABLE,
+		DISABLE,
+		DESTROY,
+		UPDATE,
+		FIXED_UPDATE,
+		LATE_UPDATE,
+		COLLISION_ENTER,
+		COLLISION_STAY,
+		COLLISION_EXIT,
+		TRIGGER_ENTER,
+		TRIGGER_STAY,
+		TRIGGER_EXIT,
+		COUNT
+	};
+
 	/**
 	* Lua script context
 	*/
 	struct LuaScriptContext
 	{
 		std::unique_ptr<sol::table> table;
+		std::array<std::unique_ptr<sol::protected_function>, static_cast<size_t>(ELuaHook::COUNT)> hooks;
+		uint16_t hookMask = 0;
 	};
 
 	using LuaScriptBase = TScript<EScriptingLanguage::LUA, LuaScriptContext>;
@@ -47,11 +77,23 @@ namespace OvCore::Scripting
 	{
 	public:
 		/**
-		* Constructor of the Lua script
+		* Constructor of the Lua script. Hooks are resolved once here, functions added to the table afterward aren't called
 		* @param p_table
 		*/
 		LuaScript(sol::table p_table);
 
+		/**
+		* Returns true if the script implements the given hook
+		* @param p_hook
+		*/
+		bool HasHook(ELuaHook p_hook) const;
+
+		/**
+		* Returns the function implementing the given hook (The script must implement it)
+		* @param p_hook
+		*/
+		sol::protected_function& GetHook(ELuaHook p_hook) const;
+
 		/**
 		* Sets the owner of the script
 		* @param p_owner
@@ -24,13 +24,21 @@ namespace sol
 
 namespace OvCore::Scripting
 {
+	struct LuaChunkCache;
+	class LuaCoroutineScheduler;
+	class LuaProfiler;
+
 	/**
 	* Lua script engine context
 	*/
 	struct LuaScriptEngineContext
 	{
 		std::unique_ptr<sol::state> luaState;
+		std::unique_ptr<LuaChunkCache> chunkCache;
+		std::unique_ptr<LuaCoroutineScheduler> coroutineScheduler;
+		std::unique_ptr<LuaProfiler> profiler;
 		std::filesystem::path scriptRootFolder;
+		std::filesystem::path bytecodeCacheFolder;
 		std::vector<std::reference_wrapper<OvCore::ECS::Components::Behaviour>> behaviours;
 		uint32_t errorCount;
 	};
@@ -62,5 +70,22 @@ namespace OvCore::Scripting
 		* Destroy the lua state
 		*/
 		void DestroyContext();
+
+		/**
+		* Defines the folder where compiled scripts are saved, so that they don't get compiled again on the next runs.
+		* An empty path disables the bytecode cache (Scripts are still compiled only once per run)
+		* @param p_folder
+		*/
+		void SetBytecodeCacheFolder(const std::filesystem::path& p_folder);
+
+		/**
+		* Returns the scheduler resuming the coroutines of the current Lua context
+		*/
+		LuaCoroutineScheduler& GetCoroutineScheduler();
+
+		/**
+		* Returns the profiler gathering the hook timings and the memory statistics of the scripts
+		*/
+		LuaProfiler& GetProfiler();
 	};
 }
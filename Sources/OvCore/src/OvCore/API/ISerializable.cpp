@@ -0,0 +1,29 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <tinyxml2.h>
+
+#include <OvCore/API/ISerializable.h>
+#include <OvCore/Helpers/BinaryDocument.h>
+
+void OvCore::API::ISerializable::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	tinyxml2::XMLDocument doc;
+	tinyxml2::XMLElement* node = doc.NewElement("data");
+	doc.InsertFirstChild(node);
+	OnSerialize(doc, node);
+
+	for (const tinyxml2::XMLNode* child = node->FirstChild(); child; child = child->NextSibling())
+		p_writer.WriteNode(*child);
+}
+
+void OvCore::API::ISerializable::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	tinyxml2::XMLDocument doc;
+
+	if (tinyxml2::XMLNode* node = Helpers::BinaryDocument::ToXML(p_node, doc, &doc))
+		OnDeserialize(doc, node);
+}
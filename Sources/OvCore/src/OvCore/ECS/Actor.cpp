@@ -24,6 +24,7 @@
 #include <OvCore/ECS/Components/CPostProcessStack.h>
 #include <OvCore/ECS/Components/CReflectionProbe.h>
 #include <OvCore/ECS/Components/CSpotLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <iostream>
 
@@ -41,28 +42,24 @@ OvTools::Eventing::Event<OvCore::ECS::Actor&> OvCore::ECS::Actor::CreatedEvent;
 OvTools::Eventing::Event<OvCore::ECS::Actor&, OvCore::ECS::Actor&> OvCore::ECS::Actor::AttachEvent;
 OvTools::Eventing::Event<OvCore::ECS::Actor&> OvCore::ECS::Actor::DettachEvent;
 
-OvCore::ECS::Actor::Actor(int64_t p_actorID, const std::string & p_name, const std::string & p_tag, bool& p_playing) :
+OvCore::ECS::Actor::Actor(int64_t p_actorID, const std::string & p_name, const std::string & p_tag, bool& p_playing, bool p_template) :
 	m_actorID(p_actorID),
+	m_template(p_template),
 	m_name(p_name),
 	m_tag(p_tag),
 	m_playing(p_playing),
 	transform(AddComponent<Components::CTransform>())
 {
-	CreatedEvent.Invoke(*this);
+	if (!m_template)
+		CreatedEvent.Invoke(*this);
 }
 
 OvCore::ECS::Actor::~Actor()
 {
-	if (!m_sleeping)
-	{
-		if (IsActive())
-			OnDisable();
-
-		if (m_awaked && m_started)
-			OnDestroy();
-	}
+	Sleep();
 
-	DestroyedEvent.Invoke(*this);
+	if (!m_template)
+		DestroyedEvent.Invoke(*this);
 
 	std::vector<Actor*> toDetach = m_children;
 
@@ -115,7 +112,7 @@ bool OvCore::ECS::Actor::IsSelfActive() const
 
 bool OvCore::ECS::Actor::IsActive() const
 {
-	return m_active && (m_parent ? m_parent->IsActive() : true);
+	return m_hierarchyActive;
 }
 
 void OvCore::ECS::Actor::SetID(int64_t p_id)
@@ -140,12 +137,16 @@ void OvCore::ECS::Actor::SetParent(Actor& p_parent)
 	/* Store the actor in the parent children list */
 	p_parent.m_children.push_back(this);
 
-	AttachEvent.Invoke(*this, p_parent);
+	RecursiveHierarchyActiveUpdate();
+
+	if (!m_template)
+		AttachEvent.Invoke(*this, p_parent);
 }
 
 void OvCore::ECS::Actor::DetachFromParent()
 {
-	DettachEvent.Invoke(*this);
+	if (!m_template)
+		DettachEvent.Invoke(*this);
 
 	/* Remove the actor from the parent children list */
 	if (m_parent)
@@ -160,6 +161,8 @@ void OvCore::ECS::Actor::DetachFromParent()
 	m_parentID = 0;
 
 	transform.RemoveParent();
+
+	RecursiveHierarchyActiveUpdate();
 }
 
 bool OvCore::ECS::Actor::IsDescendantOf(const Actor* p_actor) const
@@ -198,6 +201,11 @@ std::vector<OvCore::ECS::Actor*>& OvCore::ECS::Actor::GetChildren()
 	return m_children;
 }
 
+bool OvCore::ECS::Actor::IsTemplate() const
+{
+	return m_template;
+}
+
 void OvCore::ECS::Actor::MarkAsDestroy()
 {
 	m_destroyed = true;
@@ -216,6 +224,22 @@ void OvCore::ECS::Actor::SetSleeping(bool p_sleeping)
 	m_sleeping = p_sleeping;
 }
 
+void OvCore::ECS::Actor::Sleep()
+{
+	if (!m_sleeping)
+	{
+		if (IsActive())
+			OnDisable();
+
+		if (m_awaked && m_started)
+			OnDestroy();
+	}
+
+	m_sleeping = true;
+	m_awaked = false;
+	m_started = false;
+}
+
 void OvCore::ECS::Actor::OnAwake()
 {
 	m_awaked = true;
@@ -450,6 +474,7 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 	OvCore::Helpers::Serializer::DeserializeBoolean(p_doc, p_actorsRoot, "active", m_active);
 	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "id", m_actorID);
 	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "parent", m_parentID);
+	RecursiveHierarchyActiveUpdate();
 
 	{
 		tinyxml2::XMLNode* componentsRoot = p_actorsRoot->FirstChildElement("components");
@@ -460,26 +485,7 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 			while (currentComponent)
 			{
 				const std::string componentType = currentComponent->FirstChildElement("type")->GetText();
-				OvCore::ECS::Components::AComponent* component = nullptr;
-
-				using namespace OvCore::ECS::Components;
-
-				if (IsType<CTransform>(componentType)) component = &transform;
-				else if (IsType<CPhysicalBox>(componentType)) component = &AddComponent<CPhysicalBox>();
-				else if (IsType<CPhysicalSphere>(componentType)) component = &AddComponent<CPhysicalSphere>();
-				else if (IsType<CPhysicalCapsule>(componentType)) component = &AddComponent<CPhysicalCapsule>();
-				else if (IsType<CModelRenderer>(componentType)) component = &AddComponent<CModelRenderer>();
-				else if (IsType<CCamera>(componentType)) component = &AddComponent<CCamera>();
-				else if (IsType<CMaterialRenderer>(componentType)) component = &AddComponent<CMaterialRenderer>();
-				else if (IsType<CAudioSource>(componentType)) component = &AddComponent<CAudioSource>();
-				else if (IsType<CAudioListener>(componentType)) component = &AddComponent<CAudioListener>();
-				else if (IsType<CPointLight>(componentType)) component = &AddComponent<CPointLight>();
-				else if (IsType<CDirectionalLight>(componentType)) component = &AddComponent<CDirectionalLight>();
-				else if (IsType<CSpotLight>(componentType)) component = &AddComponent<CSpotLight>();
-				else if (IsType<CAmbientBoxLight>(componentType)) component = &AddComponent<CAmbientBoxLight>();
-				else if (IsType<CAmbientSphereLight>(componentType)) component = &AddComponent<CAmbientSphereLight>();
-				else if (IsType<CPostProcessStack>(componentType)) component = &AddComponent<CPostProcessStack>();
-				else if (IsType<CReflectionProbe>(componentType)) component = &AddComponent<CReflectionProbe>();
+				OvCore::ECS::Components::AComponent* component = AddComponentFromTypeName(componentType);
 
 				if (component)
 				{
@@ -511,8 +517,62 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 	}
 }
 
+void OvCore::ECS::Actor::OnDeserialize(const OvCore::Helpers::BinaryNode& p_actorsRoot)
+{
+	OvCore::Helpers::Serializer::DeserializeString(p_actorsRoot, "name", m_name);
+	OvCore::Helpers::Serializer::DeserializeString(p_actorsRoot, "tag", m_tag);
+	OvCore::Helpers::Serializer::DeserializeBoolean(p_actorsRoot, "active", m_active);
+	OvCore::Helpers::Serializer::DeserializeInt64(p_actorsRoot, "id", m_actorID);
+	OvCore::Helpers::Serializer::DeserializeInt64(p_actorsRoot, "parent", m_parentID);
+	RecursiveHierarchyActiveUpdate();
+
+	if (auto componentsRoot = p_actorsRoot.FirstChildElement("components"))
+	{
+		for (auto currentComponent = componentsRoot.FirstChildElement("component"); currentComponent; currentComponent = currentComponent.NextSiblingElement("component"))
+		{
+			if (auto component = AddComponentFromTypeName(OvCore::Helpers::Serializer::DeserializeString(currentComponent, "type")))
+				component->OnDeserialize(currentComponent.FirstChildElement("data"));
+		}
+	}
+
+	if (auto behavioursRoot = p_actorsRoot.FirstChildElement("behaviours"))
+	{
+		for (auto currentBehaviour = behavioursRoot.FirstChildElement("behaviour"); currentBehaviour; currentBehaviour = currentBehaviour.NextSiblingElement("behaviour"))
+		{
+			auto& behaviour = AddBehaviour(OvCore::Helpers::Serializer::DeserializeString(currentBehaviour, "type"));
+			behaviour.OnDeserialize(currentBehaviour.FirstChildElement("data"));
+		}
+	}
+}
+
+OvCore::ECS::Components::AComponent* OvCore::ECS::Actor::AddComponentFromTypeName(std::string_view p_typeName)
+{
+	using namespace OvCore::ECS::Components;
+
+	if (IsType<CTransform>(p_typeName)) return &transform;
+	else if (IsType<CPhysicalBox>(p_typeName)) return &AddComponent<CPhysicalBox>();
+	else if (IsType<CPhysicalSphere>(p_typeName)) return &AddComponent<CPhysicalSphere>();
+	else if (IsType<CPhysicalCapsule>(p_typeName)) return &AddComponent<CPhysicalCapsule>();
+	else if (IsType<CModelRenderer>(p_typeName)) return &AddComponent<CModelRenderer>();
+	else if (IsType<CCamera>(p_typeName)) return &AddComponent<CCamera>();
+	else if (IsType<CMaterialRenderer>(p_typeName)) return &AddComponent<CMaterialRenderer>();
+	else if (IsType<CAudioSource>(p_typeName)) return &AddComponent<CAudioSource>();
+	else if (IsType<CAudioListener>(p_typeName)) return &AddComponent<CAudioListener>();
+	else if (IsType<CPointLight>(p_typeName)) return &AddComponent<CPointLight>();
+	else if (IsType<CDirectionalLight>(p_typeName)) return &AddComponent<CDirectionalLight>();
+	else if (IsType<CSpotLight>(p_typeName)) return &AddComponent<CSpotLight>();
+	else if (IsType<CAmbientBoxLight>(p_typeName)) return &AddComponent<CAmbientBoxLight>();
+	else if (IsType<CAmbientSphereLight>(p_typeName)) return &AddComponent<CAmbientSphereLight>();
+	else if (IsType<CPostProcessStack>(p_typeName)) return &AddComponent<CPostProcessStack>();
+	else if (IsType<CReflectionProbe>(p_typeName)) return &AddComponent<CReflectionProbe>();
+
+	return nullptr;
+}
+
 void OvCore::ECS::Actor::RecursiveActiveUpdate()
 {
+	m_hierarchyActive = m_active && (m_parent ? m_parent->m_hierarchyActive : true);
+
 	bool isActive = IsActive();
 
 	if (!m_sleeping)
@@ -542,3 +602,10 @@ void OvCore::ECS::Actor::RecursiveWasActiveUpdate()
 	for (auto child : m_children)
 		child->RecursiveWasActiveUpdate();
 }
+
+void OvCore::ECS::Actor::RecursiveHierarchyActiveUpdate()
+{
+	m_hierarchyActive = m_active && (m_parent ? m_parent->m_hierarchyActive : true);
+	for (auto child : m_children)
+		child->RecursiveHierarchyActiveUpdate();
+}
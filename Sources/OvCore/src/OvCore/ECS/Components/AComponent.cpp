@@ -7,6 +7,8 @@
 #include "OvCore/ECS/Components/AComponent.h"
 #include "OvCore/ECS/Actor.h"
 
+#include <tinyxml2.h>
+
 OvCore::ECS::Components::AComponent::AComponent(ECS::Actor& p_owner) : owner(p_owner)
 {
 }
@@ -19,3 +21,14 @@ OvCore::ECS::Components::AComponent::~AComponent()
 		OnDestroy();
 	}
 }
+
+void OvCore::ECS::Components::AComponent::CopyFrom(const AComponent& p_source)
+{
+	tinyxml2::XMLDocument doc;
+	tinyxml2::XMLElement* data = doc.NewElement("data");
+	doc.InsertFirstChild(data);
+
+	// OnSerialize isn't const, but serializing a component doesn't modify it
+	const_cast<AComponent&>(p_source).OnSerialize(doc, data);
+	OnDeserialize(doc, data);
+}
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/Behaviour.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/Scripting/ScriptEngine.h>
 
@@ -54,6 +55,11 @@ void OvCore::ECS::Components::Behaviour::RemoveScript()
 	m_script.reset();
 }
 
+void OvCore::ECS::Components::Behaviour::SetUpdateCallbacks(EUpdateCallbacks p_callbacks)
+{
+	m_updateCallbacks = p_callbacks;
+}
+
 void OvCore::ECS::Components::Behaviour::OnAwake()
 {
 	OVSERVICE(Scripting::ScriptEngine).OnAwake(*this);
@@ -94,6 +100,11 @@ void OvCore::ECS::Components::Behaviour::OnLateUpdate(float p_deltaTime)
 	OVSERVICE(Scripting::ScriptEngine).OnLateUpdate(*this, p_deltaTime);
 }
 
+OvCore::ECS::Components::EUpdateCallbacks OvCore::ECS::Components::Behaviour::GetUpdateCallbacks() const
+{
+	return m_updateCallbacks;
+}
+
 void OvCore::ECS::Components::Behaviour::OnCollisionEnter(Components::CPhysicalObject& p_otherObject)
 {
 	OVSERVICE(Scripting::ScriptEngine).OnCollisionEnter(*this, p_otherObject);
@@ -128,10 +139,18 @@ void OvCore::ECS::Components::Behaviour::OnSerialize(tinyxml2::XMLDocument & p_d
 {
 }
 
+void OvCore::ECS::Components::Behaviour::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+}
+
 void OvCore::ECS::Components::Behaviour::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 }
 
+void OvCore::ECS::Components::Behaviour::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+}
+
 void OvCore::ECS::Components::Behaviour::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	using namespace OvMaths;
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CAmbientBoxLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvUI/Widgets/Buttons/Button.h>
 #include <OvUI/Widgets/Texts/Text.h>
@@ -54,6 +55,15 @@ void OvCore::ECS::Components::CAmbientBoxLight::OnSerialize(tinyxml2::XMLDocumen
 	Serializer::SerializeVec3(p_doc, p_node, "size", { m_data.constant, m_data.linear, m_data.quadratic });
 }
 
+void OvCore::ECS::Components::CAmbientBoxLight::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnSerialize(p_writer);
+
+	Serializer::SerializeVec3(p_writer, "size", { m_data.constant, m_data.linear, m_data.quadratic });
+}
+
 void OvCore::ECS::Components::CAmbientBoxLight::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	using namespace OvCore::Helpers;
@@ -66,6 +76,18 @@ void OvCore::ECS::Components::CAmbientBoxLight::OnDeserialize(tinyxml2::XMLDocum
 	m_data.quadratic = size.z;
 }
 
+void OvCore::ECS::Components::CAmbientBoxLight::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnDeserialize(p_node);
+
+	OvMaths::FVector3 size = Serializer::DeserializeVec3(p_node, "size");
+	m_data.constant = size.x;
+	m_data.linear = size.y;
+	m_data.quadratic = size.z;
+}
+
 void OvCore::ECS::Components::CAmbientBoxLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
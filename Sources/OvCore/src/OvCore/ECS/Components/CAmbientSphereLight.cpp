@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CAmbientSphereLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvUI/Widgets/Texts/Text.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -50,6 +51,15 @@ void OvCore::ECS::Components::CAmbientSphereLight::OnSerialize(tinyxml2::XMLDocu
 	Serializer::SerializeFloat(p_doc, p_node, "radius", m_data.constant);
 }
 
+void OvCore::ECS::Components::CAmbientSphereLight::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnSerialize(p_writer);
+
+	Serializer::SerializeFloat(p_writer, "radius", m_data.constant);
+}
+
 void OvCore::ECS::Components::CAmbientSphereLight::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	using namespace OvCore::Helpers;
@@ -59,6 +69,15 @@ void OvCore::ECS::Components::CAmbientSphereLight::OnDeserialize(tinyxml2::XMLDo
 	Serializer::DeserializeFloat(p_doc, p_node, "radius", m_data.constant);
 }
 
+void OvCore::ECS::Components::CAmbientSphereLight::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnDeserialize(p_node);
+
+	Serializer::DeserializeFloat(p_node, "radius", m_data.constant);
+}
+
 void OvCore::ECS::Components::CAmbientSphereLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CAudioListener.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 OvCore::ECS::Components::CAudioListener::CAudioListener(ECS::Actor& p_owner) :
 	AComponent(p_owner),
@@ -28,10 +29,18 @@ void OvCore::ECS::Components::CAudioListener::OnSerialize(tinyxml2::XMLDocument&
 {
 }
 
+void OvCore::ECS::Components::CAudioListener::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+}
+
 void OvCore::ECS::Components::CAudioListener::OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node)
 {
 }
 
+void OvCore::ECS::Components::CAudioListener::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+}
+
 void OvCore::ECS::Components::CAudioListener::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 
@@ -4,9 +4,12 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+
 #include <OvAudio/Core/AudioEngine.h>
 
 #include <OvCore/ECS/Components/CAudioSource.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/SceneSystem/SceneManager.h>
@@ -70,6 +73,11 @@ void OvCore::ECS::Components::CAudioSource::SetAttenuationThreshold(float p_dist
 	m_audioSource.SetAttenuationThreshold(p_distance);
 }
 
+void OvCore::ECS::Components::CAudioSource::SetPriority(uint8_t p_priority)
+{
+	m_audioSource.SetPriority(p_priority);
+}
+
 OvAudio::Resources::Sound* OvCore::ECS::Components::CAudioSource::GetSound() const
 {
 	return m_sound;
@@ -115,6 +123,11 @@ float OvCore::ECS::Components::CAudioSource::GetAttenuationThreshold() const
 	return m_audioSource.GetAttenuationThreshold();
 }
 
+uint8_t OvCore::ECS::Components::CAudioSource::GetPriority() const
+{
+	return m_audioSource.GetPriority();
+}
+
 void OvCore::ECS::Components::CAudioSource::Play()
 {
 	if (owner.IsActive() && m_sound)
@@ -150,9 +163,25 @@ void OvCore::ECS::Components::CAudioSource::OnSerialize(tinyxml2::XMLDocument& p
 	Serializer::SerializeBoolean(p_doc, p_node, "looped", IsLooped());
 	Serializer::SerializeFloat(p_doc, p_node, "pitch", GetPitch());
 	Serializer::SerializeFloat(p_doc, p_node, "attenuation_threshold", GetAttenuationThreshold());
+	Serializer::SerializeInt(p_doc, p_node, "priority", GetPriority());
 	Serializer::SerializeSound(p_doc, p_node, "audio_clip", m_sound);
 }
 
+void OvCore::ECS::Components::CAudioSource::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	using namespace OvCore::Helpers;
+
+	Serializer::SerializeBoolean(p_writer, "autoplay", m_autoPlay);
+	Serializer::SerializeBoolean(p_writer, "spatial", IsSpatial());
+	Serializer::SerializeFloat(p_writer, "volume", GetVolume());
+	Serializer::SerializeFloat(p_writer, "pan", GetPan());
+	Serializer::SerializeBoolean(p_writer, "looped", IsLooped());
+	Serializer::SerializeFloat(p_writer, "pitch", GetPitch());
+	Serializer::SerializeFloat(p_writer, "attenuation_threshold", GetAttenuationThreshold());
+	Serializer::SerializeInt(p_writer, "priority", GetPriority());
+	Serializer::SerializeSound(p_writer, "audio_clip", m_sound);
+}
+
 void OvCore::ECS::Components::CAudioSource::OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node)
 {
 	using namespace OvCore::Helpers;
@@ -164,9 +193,49 @@ void OvCore::ECS::Components::CAudioSource::OnDeserialize(tinyxml2::XMLDocument&
 	SetLooped(Serializer::DeserializeBoolean(p_doc, p_node, "looped"));
 	SetPitch(Serializer::DeserializeFloat(p_doc, p_node, "pitch"));
 	SetAttenuationThreshold(Serializer::DeserializeFloat(p_doc, p_node, "attenuation_threshold"));
+
+	// Scenes saved before priorities existed keep the default priority
+	int priority = GetPriority();
+	Serializer::DeserializeInt(p_doc, p_node, "priority", priority);
+	SetPriority(static_cast<uint8_t>(std::clamp(priority, 0, 255)));
+
 	Serializer::DeserializeSound(p_doc, p_node, "audio_clip", m_sound);
 }
 
+void OvCore::ECS::Components::CAudioSource::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	using namespace OvCore::Helpers;
+
+	Serializer::DeserializeBoolean(p_node, "autoplay", m_autoPlay);
+	SetSpatial(Serializer::DeserializeBoolean(p_node, "spatial"));
+	SetVolume(Serializer::DeserializeFloat(p_node, "volume"));
+	SetPan(Serializer::DeserializeFloat(p_node, "pan"));
+	SetLooped(Serializer::DeserializeBoolean(p_node, "looped"));
+	SetPitch(Serializer::DeserializeFloat(p_node, "pitch"));
+	SetAttenuationThreshold(Serializer::DeserializeFloat(p_node, "attenuation_threshold"));
+
+	int priority = GetPriority();
+	Serializer::DeserializeInt(p_node, "priority", priority);
+	SetPriority(static_cast<uint8_t>(std::clamp(priority, 0, 255)));
+
+	Serializer::DeserializeSound(p_node, "audio_clip", m_sound);
+}
+
+void OvCore::ECS::Components::CAudioSource::CopyFrom(const AComponent& p_source)
+{
+	const auto& source = static_cast<const CAudioSource&>(p_source);
+
+	m_autoPlay = source.m_autoPlay;
+	SetSpatial(source.IsSpatial());
+	SetVolume(source.GetVolume());
+	SetPan(source.GetPan());
+	SetLooped(source.IsLooped());
+	SetPitch(source.GetPitch());
+	SetAttenuationThreshold(source.GetAttenuationThreshold());
+	SetPriority(source.GetPriority());
+	m_sound = source.m_sound;
+}
+
 void OvCore::ECS::Components::CAudioSource::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvAudio::Entities;
@@ -180,6 +249,7 @@ void OvCore::ECS::Components::CAudioSource::OnInspector(OvUI::Internal::WidgetCo
 	GUIDrawer::DrawScalar<float>(p_root, "Pitch", std::bind(&CAudioSource::GetPitch, this), std::bind(&CAudioSource::SetPitch, this, std::placeholders::_1), 0.01f, 0.01f, 10000.0f);
 	GUIDrawer::DrawBoolean(p_root, "Spatial", std::bind(&CAudioSource::IsSpatial, this), std::bind(&CAudioSource::SetSpatial, this, std::placeholders::_1));
 	GUIDrawer::DrawScalar<float>(p_root, "Attenuation threshold", std::bind(&CAudioSource::GetAttenuationThreshold, this), std::bind(&CAudioSource::SetAttenuationThreshold, this, std::placeholders::_1), 0.5f);
+	GUIDrawer::DrawScalar<int>(p_root, "Priority", [this] { return static_cast<int>(GetPriority()); }, [this](int p_priority) { SetPriority(static_cast<uint8_t>(p_priority)); }, 1.f, 0, 255);
 
 	GUIDrawer::CreateTitle(p_root, "Spatial graph");
 	auto& graph = p_root.CreateWidget<OvUI::Widgets::Plots::PlotLines>(std::vector<float>(), -0.1f, 1.1f);
@@ -8,6 +8,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CCamera.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvUI/Plugins/DataDispatcher.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -127,6 +128,18 @@ void OvCore::ECS::Components::CCamera::OnSerialize(tinyxml2::XMLDocument & p_doc
 	OvCore::Helpers::Serializer::SerializeInt(p_doc, p_node, "projection_mode", static_cast<int>(m_camera.GetProjectionMode()));
 }
 
+void OvCore::ECS::Components::CCamera::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	OvCore::Helpers::Serializer::SerializeFloat(p_writer, "fov", m_camera.GetFov());
+	OvCore::Helpers::Serializer::SerializeFloat(p_writer, "size", m_camera.GetSize());
+	OvCore::Helpers::Serializer::SerializeFloat(p_writer, "near", m_camera.GetNear());
+	OvCore::Helpers::Serializer::SerializeFloat(p_writer, "far", m_camera.GetFar());
+	OvCore::Helpers::Serializer::SerializeVec3(p_writer, "clear_color", m_camera.GetClearColor());
+	OvCore::Helpers::Serializer::SerializeBoolean(p_writer, "frustum_geometry_culling", m_camera.HasFrustumGeometryCulling());
+	OvCore::Helpers::Serializer::SerializeBoolean(p_writer, "frustum_light_culling", m_camera.HasFrustumLightCulling());
+	OvCore::Helpers::Serializer::SerializeInt(p_writer, "projection_mode", static_cast<int>(m_camera.GetProjectionMode()));
+}
+
 void OvCore::ECS::Components::CCamera::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	m_camera.SetFov(OvCore::Helpers::Serializer::DeserializeFloat(p_doc, p_node, "fov"));
@@ -146,6 +159,37 @@ void OvCore::ECS::Components::CCamera::OnDeserialize(tinyxml2::XMLDocument & p_d
     }
 }
 
+void OvCore::ECS::Components::CCamera::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	m_camera.SetFov(OvCore::Helpers::Serializer::DeserializeFloat(p_node, "fov"));
+	m_camera.SetSize(OvCore::Helpers::Serializer::DeserializeFloat(p_node, "size"));
+	m_camera.SetNear(OvCore::Helpers::Serializer::DeserializeFloat(p_node, "near"));
+	m_camera.SetFar(OvCore::Helpers::Serializer::DeserializeFloat(p_node, "far"));
+	m_camera.SetClearColor(OvCore::Helpers::Serializer::DeserializeVec3(p_node, "clear_color"));
+	m_camera.SetFrustumGeometryCulling(OvCore::Helpers::Serializer::DeserializeBoolean(p_node, "frustum_geometry_culling"));
+	m_camera.SetFrustumLightCulling(OvCore::Helpers::Serializer::DeserializeBoolean(p_node, "frustum_light_culling"));
+
+    // Same as the XML path, the default projection mode is kept if none has been serialized
+    if (p_node.FirstChildElement("projection_mode"))
+    {
+        m_camera.SetProjectionMode(static_cast<OvRendering::Settings::EProjectionMode>(OvCore::Helpers::Serializer::DeserializeInt(p_node, "projection_mode")));
+    }
+}
+
+void OvCore::ECS::Components::CCamera::CopyFrom(const AComponent& p_source)
+{
+	const auto& source = static_cast<const CCamera&>(p_source);
+
+	SetFov(source.GetFov());
+	SetSize(source.GetSize());
+	SetNear(source.GetNear());
+	SetFar(source.GetFar());
+	SetClearColor(source.GetClearColor());
+	SetFrustumGeometryCulling(source.HasFrustumGeometryCulling());
+	SetFrustumLightCulling(source.HasFrustumLightCulling());
+	SetProjectionMode(source.GetProjectionMode());
+}
+
 void OvCore::ECS::Components::CCamera::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
     auto currentProjectionMode = GetProjectionMode();
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CDirectionalLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvUI/Widgets/Texts/Text.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -78,6 +79,15 @@ void OvCore::ECS::Components::CDirectionalLight::OnSerialize(tinyxml2::XMLDocume
 	OvCore::Helpers::Serializer::SerializeInt(p_doc, p_node, "shadow_map_resolution", m_data.shadowMapResolution);
 }
 
+void OvCore::ECS::Components::CDirectionalLight::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CLight::OnSerialize(p_writer);
+	OvCore::Helpers::Serializer::SerializeBoolean(p_writer, "cast_shadows", m_data.castShadows);
+	OvCore::Helpers::Serializer::SerializeFloat(p_writer, "shadow_area_size", m_data.shadowAreaSize);
+	OvCore::Helpers::Serializer::SerializeBoolean(p_writer, "shadow_follow_camera", m_data.shadowFollowCamera);
+	OvCore::Helpers::Serializer::SerializeInt(p_writer, "shadow_map_resolution", m_data.shadowMapResolution);
+}
+
 void OvCore::ECS::Components::CDirectionalLight::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	CLight::OnDeserialize(p_doc, p_node);
@@ -87,6 +97,15 @@ void OvCore::ECS::Components::CDirectionalLight::OnDeserialize(tinyxml2::XMLDocu
 	m_data.shadowMapResolution = OvCore::Helpers::Serializer::DeserializeInt(p_doc, p_node, "shadow_map_resolution");
 }
 
+void OvCore::ECS::Components::CDirectionalLight::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	CLight::OnDeserialize(p_node);
+	m_data.castShadows = OvCore::Helpers::Serializer::DeserializeBoolean(p_node, "cast_shadows");
+	m_data.shadowAreaSize = OvCore::Helpers::Serializer::DeserializeFloat(p_node, "shadow_area_size");
+	m_data.shadowFollowCamera = OvCore::Helpers::Serializer::DeserializeBoolean(p_node, "shadow_follow_camera");
+	m_data.shadowMapResolution = OvCore::Helpers::Serializer::DeserializeInt(p_node, "shadow_map_resolution");
+}
+
 void OvCore::ECS::Components::CDirectionalLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	CLight::OnInspector(p_root);
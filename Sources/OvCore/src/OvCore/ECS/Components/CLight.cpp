@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvUI/Widgets/Texts/Text.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -52,6 +53,14 @@ void OvCore::ECS::Components::CLight::OnSerialize(tinyxml2::XMLDocument & p_doc,
 	Serializer::SerializeFloat(p_doc, p_node, "intensity", m_data.intensity);
 }
 
+void OvCore::ECS::Components::CLight::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	using namespace OvCore::Helpers;
+
+	Serializer::SerializeVec3(p_writer, "color", m_data.color);
+	Serializer::SerializeFloat(p_writer, "intensity", m_data.intensity);
+}
+
 void OvCore::ECS::Components::CLight::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	using namespace OvCore::Helpers;
@@ -60,6 +69,31 @@ void OvCore::ECS::Components::CLight::OnDeserialize(tinyxml2::XMLDocument & p_do
 	Serializer::DeserializeFloat(p_doc, p_node, "intensity", m_data.intensity);
 }
 
+void OvCore::ECS::Components::CLight::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	using namespace OvCore::Helpers;
+
+	Serializer::DeserializeVec3(p_node, "color", m_data.color);
+	Serializer::DeserializeFloat(p_node, "intensity", m_data.intensity);
+}
+
+void OvCore::ECS::Components::CLight::CopyFrom(const AComponent& p_source)
+{
+	const auto& source = static_cast<const CLight&>(p_source).m_data;
+
+	m_data.color = source.color;
+	m_data.intensity = source.intensity;
+	m_data.constant = source.constant;
+	m_data.linear = source.linear;
+	m_data.quadratic = source.quadratic;
+	m_data.cutoff = source.cutoff;
+	m_data.outerCutoff = source.outerCutoff;
+	m_data.castShadows = source.castShadows;
+	m_data.shadowAreaSize = source.shadowAreaSize;
+	m_data.shadowFollowCamera = source.shadowFollowCamera;
+	m_data.shadowMapResolution = source.shadowMapResolution;
+}
+
 void OvCore::ECS::Components::CLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
@@ -4,11 +4,13 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <format>
 #include <tinyxml2.h>
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CMaterialRenderer.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvCore/ECS/Components/CModelRenderer.h>
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/ResourceManagement/MaterialManager.h>
@@ -18,6 +20,7 @@
 #include <OvUI/Widgets/Buttons/Button.h>
 #include <OvUI/Widgets/Buttons/ButtonSmall.h>
 #include <OvUI/Plugins/DDTarget.h>
+#include <OvUI/Plugins/DataDispatcher.h>
 #include <OvUI/Widgets/InputFields/InputInt.h>
 #include <OvUI/Widgets/Layout/Dummy.h>
 #include <OvUI/Widgets/Layout/Group.h>
@@ -26,11 +29,6 @@
 
 OvCore::ECS::Components::CMaterialRenderer::CMaterialRenderer(ECS::Actor & p_owner) : AComponent(p_owner)
 {
-	m_materials.fill(nullptr);
-
-	for (uint8_t i = 0; i < kMaxMaterialCount; ++i)
-		m_materialFields[i].fill(nullptr);
-
 	UpdateMaterialList();
 }
 
@@ -46,39 +44,38 @@ std::string OvCore::ECS::Components::CMaterialRenderer::GetTypeName()
 
 void OvCore::ECS::Components::CMaterialRenderer::FillWithMaterial(OvCore::Resources::Material & p_material)
 {
-	for (uint8_t i = 0; i < m_materials.size(); ++i)
-		m_materials[i] = &p_material;
+	std::fill(m_materials.begin(), m_materials.end(), &p_material);
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::SetMaterialAtIndex(uint8_t p_index, OvCore::Resources::Material& p_material)
 {
+	if (p_index >= m_materials.size())
+		m_materials.resize(p_index + 1, nullptr);
+
 	m_materials[p_index] = &p_material;
 }
 
-OvCore::Resources::Material* OvCore::ECS::Components::CMaterialRenderer::GetMaterialAtIndex(uint8_t p_index)
+OvCore::Resources::Material* OvCore::ECS::Components::CMaterialRenderer::GetMaterialAtIndex(uint8_t p_index) const
 {
-	return m_materials.at(p_index);
+	return p_index < m_materials.size() ? m_materials[p_index] : nullptr;
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::RemoveMaterialAtIndex(uint8_t p_index)
 {
 	if (p_index < m_materials.size())
 	{
-		m_materials[p_index] = nullptr;;
+		m_materials[p_index] = nullptr;
 	}
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::RemoveMaterialByInstance(OvCore::Resources::Material& p_instance)
 {
-	for (uint8_t i = 0; i < m_materials.size(); ++i)
-		if (m_materials[i] == &p_instance)
-			m_materials[i] = nullptr;
+	std::replace(m_materials.begin(), m_materials.end(), &p_instance, static_cast<OvCore::Resources::Material*>(nullptr));
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::RemoveAllMaterials()
 {
-	for (uint8_t i = 0; i < m_materials.size(); ++i)
-		m_materials[i] = nullptr;
+	std::fill(m_materials.begin(), m_materials.end(), nullptr);
 }
 
 const OvMaths::FMatrix4 & OvCore::ECS::Components::CMaterialRenderer::GetUserMatrix() const
@@ -112,16 +109,33 @@ void OvCore::ECS::Components::CMaterialRenderer::OnSerialize(tinyxml2::XMLDocume
 	p_node->InsertEndChild(materialsNode);
 
 	auto modelRenderer = owner.GetComponent<CModelRenderer>();
-	uint8_t elementsToSerialize = modelRenderer->GetModel() ? (uint8_t)std::min(modelRenderer->GetModel()->GetMaterialNames().size(), (size_t)kMaxMaterialCount) : 0;
+	uint8_t elementsToSerialize = modelRenderer && modelRenderer->GetModel() ? (uint8_t)std::min(modelRenderer->GetModel()->GetMaterialNames().size(), (size_t)kMaxMaterialCount) : 0;
 
 	for (uint8_t i = 0; i < elementsToSerialize; ++i)
 	{
-		OvCore::Helpers::Serializer::SerializeMaterial(p_doc, materialsNode, "material", m_materials[i]);
+		OvCore::Helpers::Serializer::SerializeMaterial(p_doc, materialsNode, "material", GetMaterialAtIndex(i));
 	}
 
 	OvCore::Helpers::Serializer::SerializeUint32(p_doc, p_node, "visibility_flags", reinterpret_cast<uint32_t&>(m_visibilityFlags));
 }
 
+void OvCore::ECS::Components::CMaterialRenderer::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	p_writer.BeginElement("materials");
+
+	auto modelRenderer = owner.GetComponent<CModelRenderer>();
+	uint8_t elementsToSerialize = modelRenderer && modelRenderer->GetModel() ? (uint8_t)std::min(modelRenderer->GetModel()->GetMaterialNames().size(), (size_t)kMaxMaterialCount) : 0;
+
+	for (uint8_t i = 0; i < elementsToSerialize; ++i)
+	{
+		OvCore::Helpers::Serializer::SerializeMaterial(p_writer, "material", GetMaterialAtIndex(i));
+	}
+
+	p_writer.EndElement();
+
+	OvCore::Helpers::Serializer::SerializeUint32(p_writer, "visibility_flags", reinterpret_cast<uint32_t&>(m_visibilityFlags));
+}
+
 void OvCore::ECS::Components::CMaterialRenderer::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	tinyxml2::XMLNode* materialsRoot = p_node->FirstChildElement("materials");
@@ -133,6 +147,9 @@ void OvCore::ECS::Components::CMaterialRenderer::OnDeserialize(tinyxml2::XMLDocu
 
 		while (currentMaterial)
 		{
+			if (materialIndex >= m_materials.size())
+				m_materials.resize(materialIndex + 1, nullptr);
+
 			if (auto material = Global::ServiceLocator::Get<ResourceManagement::MaterialManager>()[currentMaterial->GetText()])
 				m_materials[materialIndex] = material;
 
@@ -146,29 +163,80 @@ void OvCore::ECS::Components::CMaterialRenderer::OnDeserialize(tinyxml2::XMLDocu
 	OvCore::Helpers::Serializer::DeserializeUint32(p_doc, p_node, "visibility_flags", reinterpret_cast<uint32_t&>(m_visibilityFlags));
 }
 
-std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvCore::Resources::Material*& p_data)
+void OvCore::ECS::Components::CMaterialRenderer::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	if (auto materialsRoot = p_node.FirstChildElement("materials"))
+	{
+		auto& materialManager = Global::ServiceLocator::Get<ResourceManagement::MaterialManager>();
+
+		uint8_t materialIndex = 0;
+
+		for (auto currentMaterial = materialsRoot.FirstChildElement("material"); currentMaterial; currentMaterial = currentMaterial.NextSiblingElement("material"))
+		{
+			std::string path;
+			currentMaterial.QueryStringText(path);
+
+			if (materialIndex >= m_materials.size())
+				m_materials.resize(materialIndex + 1, nullptr);
+
+			if (auto material = materialManager[path])
+				m_materials[materialIndex] = material;
+
+			++materialIndex;
+		}
+	}
+
+	UpdateMaterialList();
+
+	OvCore::Helpers::Serializer::DeserializeUint32(p_node, "visibility_flags", reinterpret_cast<uint32_t&>(m_visibilityFlags));
+}
+
+void OvCore::ECS::Components::CMaterialRenderer::CopyFrom(const AComponent& p_source)
+{
+	const auto& source = static_cast<const CMaterialRenderer&>(p_source);
+
+	m_materials = source.m_materials;
+	m_userMatrix = source.m_userMatrix;
+	m_visibilityFlags = source.m_visibilityFlags;
+
+	UpdateMaterialList();
+}
+
+std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::WidgetContainer& p_root, OvCore::ECS::Components::CMaterialRenderer& p_renderer, uint8_t p_index)
 {
 	using namespace OvCore::Helpers;
 
 	std::array<OvUI::Widgets::AWidget*, 3> widgets;
 
-	widgets[0] = &p_root.CreateWidget<OvUI::Widgets::Texts::TextColored>(p_name, GUIDrawer::TitleColor);
+	auto& title = p_root.CreateWidget<OvUI::Widgets::Texts::TextColored>("", GUIDrawer::TitleColor);
+	title.AddPlugin<OvUI::Plugins::DataDispatcher<std::string>>().RegisterGatherer([&p_renderer, p_index]
+	{
+		const auto modelRenderer = p_renderer.owner.GetComponent<OvCore::ECS::Components::CModelRenderer>();
+		const auto model = modelRenderer ? modelRenderer->GetModel() : nullptr;
+		const bool hasName = model && p_index < model->GetMaterialNames().size();
+		return std::format("Material [{}]: <{}>", p_index, hasName ? model->GetMaterialNames()[p_index] : std::string{});
+	});
+
+	widgets[0] = &title;
 
-	std::string displayedText = (p_data ? p_data->path : std::string("Empty"));
 	auto & rightSide = p_root.CreateWidget<OvUI::Widgets::Layout::Group>();
 
-	auto& widget = rightSide.CreateWidget<OvUI::Widgets::Texts::Text>(displayedText);
+	auto& widget = rightSide.CreateWidget<OvUI::Widgets::Texts::Text>();
+	widget.AddPlugin<OvUI::Plugins::DataDispatcher<std::string>>().RegisterGatherer([&p_renderer, p_index]
+	{
+		const auto material = p_renderer.GetMaterialAtIndex(p_index);
+		return material ? material->path : std::string("Empty");
+	});
 
 	widgets[1] = &widget;
 
-	widget.AddPlugin<OvUI::Plugins::DDTarget<std::pair<std::string, OvUI::Widgets::Layout::Group*>>>("File").DataReceivedEvent += [&widget, &p_data](auto p_receivedData)
+	widget.AddPlugin<OvUI::Plugins::DDTarget<std::pair<std::string, OvUI::Widgets::Layout::Group*>>>("File").DataReceivedEvent += [&p_renderer, p_index](auto p_receivedData)
 	{
 		if (OvTools::Utils::PathParser::GetFileType(p_receivedData.first) == OvTools::Utils::PathParser::EFileType::MATERIAL)
 		{
 			if (auto resource = OVSERVICE(OvCore::ResourceManagement::MaterialManager).GetResource(p_receivedData.first); resource)
 			{
-				p_data = resource;
-				widget.content = p_receivedData.first;
+				p_renderer.SetMaterialAtIndex(p_index, *resource);
 			}
 		}
 	};
@@ -177,10 +245,9 @@ std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::Widg
 
 	auto & resetButton = rightSide.CreateWidget<OvUI::Widgets::Buttons::ButtonSmall>("Clear");
 	resetButton.idleBackgroundColor = GUIDrawer::ClearButtonColor;
-	resetButton.ClickedEvent += [&widget, &p_data]
+	resetButton.ClickedEvent += [&p_renderer, p_index]
 	{
-		p_data = nullptr;
-		widget.content = "Empty";
+		p_renderer.RemoveMaterialAtIndex(p_index);
 	};
 
 	widgets[2] = &resetButton;
@@ -212,40 +279,40 @@ void OvCore::ECS::Components::CMaterialRenderer::OnInspector(OvUI::Internal::Wid
 	p_root.CreateWidget<OvUI::Widgets::Visual::Separator>();
 	p_root.CreateWidget<OvUI::Widgets::Layout::Dummy>(); // Necessary to fill the "value" column
 
-	for (uint8_t i = 0; i < m_materials.size(); ++i)
-	{
-		m_materialFields[i] = CustomMaterialDrawer(p_root, "Material", m_materials[i]);
-	}
+	/*
+	* A field is created for every possible slot, but only the existing ones are shown, so the inspector
+	* follows model changes. The fields are owned by the widgets, not by the component
+	*/
+	std::vector<std::array<OvUI::Widgets::AWidget*, 3>> fields;
+	fields.reserve(kMaxMaterialCount);
 
-	UpdateMaterialList();
-}
+	GUIDrawer::CreateTitle(p_root, "Material Slots");
+	auto& slotCount = p_root.CreateWidget<OvUI::Widgets::Texts::Text>();
+	auto& slotCountDispatcher = slotCount.AddPlugin<OvUI::Plugins::DataDispatcher<std::string>>();
 
-void OvCore::ECS::Components::CMaterialRenderer::UpdateMaterialList()
-{
-	if (auto modelRenderer = owner.GetComponent<CModelRenderer>(); modelRenderer && modelRenderer->GetModel())
+	for (uint8_t i = 0; i < kMaxMaterialCount; ++i)
 	{
-		uint8_t materialIndex = 0;
+		fields.push_back(CustomMaterialDrawer(p_root, *this, i));
+	}
 
-		for (const std::string& materialName : modelRenderer->GetModel()->GetMaterialNames())
+	slotCountDispatcher.RegisterGatherer([this, fields = std::move(fields)]
+	{
+		for (size_t i = 0; i < fields.size(); ++i)
 		{
-			m_materialNames[materialIndex++] = materialName;
+			for (auto widget : fields[i])
+				widget->enabled = i < m_materials.size();
 		}
 
-		for (uint8_t i = materialIndex; i < kMaxMaterialCount; ++i)
-			m_materialNames[i] = "";
-	}
+		return std::to_string(m_materials.size());
+	});
+}
 
-	for (uint8_t i = 0; i < m_materialFields.size(); ++i)
+void OvCore::ECS::Components::CMaterialRenderer::UpdateMaterialList()
+{
+	if (auto modelRenderer = owner.GetComponent<CModelRenderer>(); modelRenderer && modelRenderer->GetModel())
 	{
-		if (m_materialFields[i][0])
-		{
-			bool enabled = !m_materialNames[i].empty();
-			m_materialFields[i][0]->enabled = enabled;
-			m_materialFields[i][1]->enabled = enabled;
-			m_materialFields[i][2]->enabled = enabled;
-			const auto formattedName = std::format("Material [{}]: <{}>", i, m_materialNames[i]);
-			reinterpret_cast<OvUI::Widgets::Texts::Text*>(m_materialFields[i][0]) ->content = formattedName;
-		}
+		const size_t materialCount = std::min(modelRenderer->GetModel()->GetMaterialNames().size(), static_cast<size_t>(kMaxMaterialCount));
+		m_materials.resize(materialCount, nullptr);
 	}
 }
 
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CModelRenderer.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvCore/ECS/Components/CMaterialRenderer.h>
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
@@ -78,6 +79,14 @@ void OvCore::ECS::Components::CModelRenderer::OnSerialize(tinyxml2::XMLDocument
 	OvCore::Helpers::Serializer::SerializeFloat(p_doc, p_node, "custom_bounding_sphere_radius", m_customBoundingSphere.radius);
 }
 
+void OvCore::ECS::Components::CModelRenderer::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	OvCore::Helpers::Serializer::SerializeModel(p_writer, "model", m_model);
+	OvCore::Helpers::Serializer::SerializeInt(p_writer, "frustum_behaviour", reinterpret_cast<int&>(m_frustumBehaviour));
+	OvCore::Helpers::Serializer::SerializeVec3(p_writer, "custom_bounding_sphere_position", m_customBoundingSphere.position);
+	OvCore::Helpers::Serializer::SerializeFloat(p_writer, "custom_bounding_sphere_radius", m_customBoundingSphere.radius);
+}
+
 void OvCore::ECS::Components::CModelRenderer::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode* p_node)
 {
 	OvCore::Helpers::Serializer::DeserializeModel(p_doc, p_node, "model", m_model);
@@ -86,6 +95,23 @@ void OvCore::ECS::Components::CModelRenderer::OnDeserialize(tinyxml2::XMLDocumen
 	OvCore::Helpers::Serializer::DeserializeFloat(p_doc, p_node, "custom_bounding_sphere_radius", m_customBoundingSphere.radius);
 }
 
+void OvCore::ECS::Components::CModelRenderer::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	OvCore::Helpers::Serializer::DeserializeModel(p_node, "model", m_model);
+	OvCore::Helpers::Serializer::DeserializeInt(p_node, "frustum_behaviour", reinterpret_cast<int&>(m_frustumBehaviour));
+	OvCore::Helpers::Serializer::DeserializeVec3(p_node, "custom_bounding_sphere_position", m_customBoundingSphere.position);
+	OvCore::Helpers::Serializer::DeserializeFloat(p_node, "custom_bounding_sphere_radius", m_customBoundingSphere.radius);
+}
+
+void OvCore::ECS::Components::CModelRenderer::CopyFrom(const AComponent& p_source)
+{
+	const auto& source = static_cast<const CModelRenderer&>(p_source);
+
+	m_model = source.m_model;
+	m_frustumBehaviour = source.m_frustumBehaviour;
+	m_customBoundingSphere = source.m_customBoundingSphere;
+}
+
 void OvCore::ECS::Components::CModelRenderer::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CPhysicalBox.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvPhysics/Entities/PhysicalBox.h>
 
@@ -49,6 +50,13 @@ void OvCore::ECS::Components::CPhysicalBox::OnSerialize(tinyxml2::XMLDocument &
 	Helpers::Serializer::SerializeVec3(p_doc, p_node, "size", GetSize());
 }
 
+void OvCore::ECS::Components::CPhysicalBox::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CPhysicalObject::OnSerialize(p_writer);
+
+	Helpers::Serializer::SerializeVec3(p_writer, "size", GetSize());
+}
+
 void OvCore::ECS::Components::CPhysicalBox::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	CPhysicalObject::OnDeserialize(p_doc, p_node);
@@ -56,6 +64,20 @@ void OvCore::ECS::Components::CPhysicalBox::OnDeserialize(tinyxml2::XMLDocument
 	SetSize(Helpers::Serializer::DeserializeVec3(p_doc, p_node, "size"));
 }
 
+void OvCore::ECS::Components::CPhysicalBox::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	CPhysicalObject::OnDeserialize(p_node);
+
+	SetSize(Helpers::Serializer::DeserializeVec3(p_node, "size"));
+}
+
+void OvCore::ECS::Components::CPhysicalBox::CopyFrom(const AComponent& p_source)
+{
+	CPhysicalObject::CopyFrom(p_source);
+
+	SetSize(static_cast<const CPhysicalBox&>(p_source).GetSize());
+}
+
 void OvCore::ECS::Components::CPhysicalBox::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CPhysicalCapsule.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvPhysics/Entities/PhysicalCapsule.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -61,6 +62,14 @@ void OvCore::ECS::Components::CPhysicalCapsule::OnSerialize(tinyxml2::XMLDocumen
 	Helpers::Serializer::SerializeFloat(p_doc, p_node, "height", GetHeight());
 }
 
+void OvCore::ECS::Components::CPhysicalCapsule::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CPhysicalObject::OnSerialize(p_writer);
+
+	Helpers::Serializer::SerializeFloat(p_writer, "radius", GetRadius());
+	Helpers::Serializer::SerializeFloat(p_writer, "height", GetHeight());
+}
+
 void OvCore::ECS::Components::CPhysicalCapsule::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	CPhysicalObject::OnDeserialize(p_doc, p_node);
@@ -69,6 +78,23 @@ void OvCore::ECS::Components::CPhysicalCapsule::OnDeserialize(tinyxml2::XMLDocum
 	SetHeight(Helpers::Serializer::DeserializeFloat(p_doc, p_node, "height"));
 }
 
+void OvCore::ECS::Components::CPhysicalCapsule::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	CPhysicalObject::OnDeserialize(p_node);
+
+	SetRadius(Helpers::Serializer::DeserializeFloat(p_node, "radius"));
+	SetHeight(Helpers::Serializer::DeserializeFloat(p_node, "height"));
+}
+
+void OvCore::ECS::Components::CPhysicalCapsule::CopyFrom(const AComponent& p_source)
+{
+	CPhysicalObject::CopyFrom(p_source);
+
+	const auto& source = static_cast<const CPhysicalCapsule&>(p_source);
+	SetRadius(source.GetRadius());
+	SetHeight(source.GetHeight());
+}
+
 void OvCore::ECS::Components::CPhysicalCapsule::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
@@ -8,10 +8,12 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CPhysicalObject.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvDebug/Logger.h>
 
 #include <OvPhysics/Entities/PhysicalObject.h>
+#include <OvPhysics/Settings/PhysicsSettings.h>
 
 #include <OvUI/Widgets/Drags/DragFloat.h>
 #include <OvUI/Widgets/Selection/ComboBox.h>
@@ -91,6 +93,11 @@ bool OvCore::ECS::Components::CPhysicalObject::IsKinematic() const
 	return m_physicalObject->IsKinematic();
 }
 
+uint32_t OvCore::ECS::Components::CPhysicalObject::GetLayer() const
+{
+	return m_physicalObject->GetLayer();
+}
+
 OvPhysics::Entities::PhysicalObject::EActivationState OvCore::ECS::Components::CPhysicalObject::GetActivationState() const
 {
 	return m_physicalObject->GetActivationState();
@@ -141,6 +148,11 @@ void OvCore::ECS::Components::CPhysicalObject::SetKinematic(bool p_kinematic)
 	m_physicalObject->SetKinematic(p_kinematic);
 }
 
+void OvCore::ECS::Components::CPhysicalObject::SetLayer(uint32_t p_layer)
+{
+	m_physicalObject->SetLayer(p_layer);
+}
+
 void OvCore::ECS::Components::CPhysicalObject::SetActivationState(OvPhysics::Entities::PhysicalObject::EActivationState p_state)
 {
 	m_physicalObject->SetActivationState(p_state);
@@ -156,6 +168,20 @@ void OvCore::ECS::Components::CPhysicalObject::OnSerialize(tinyxml2::XMLDocument
 	Helpers::Serializer::SerializeVec3(p_doc, p_node, "linear_factor", GetLinearFactor());
 	Helpers::Serializer::SerializeVec3(p_doc, p_node, "angular_factor", GetAngularFactor());
 	Helpers::Serializer::SerializeInt(p_doc, p_node, "collision_mode", static_cast<int>(GetCollisionDetectionMode()));
+	Helpers::Serializer::SerializeUint32(p_doc, p_node, "layer", GetLayer());
+}
+
+void OvCore::ECS::Components::CPhysicalObject::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	Helpers::Serializer::SerializeBoolean(p_writer, "is_trigger", IsTrigger());
+	Helpers::Serializer::SerializeBoolean(p_writer, "is_kinematic", IsKinematic());
+	Helpers::Serializer::SerializeFloat(p_writer, "bounciness", GetBounciness());
+	Helpers::Serializer::SerializeFloat(p_writer, "mass", GetMass());
+	Helpers::Serializer::SerializeFloat(p_writer, "friction", GetFriction());
+	Helpers::Serializer::SerializeVec3(p_writer, "linear_factor", GetLinearFactor());
+	Helpers::Serializer::SerializeVec3(p_writer, "angular_factor", GetAngularFactor());
+	Helpers::Serializer::SerializeInt(p_writer, "collision_mode", static_cast<int>(GetCollisionDetectionMode()));
+	Helpers::Serializer::SerializeUint32(p_writer, "layer", GetLayer());
 }
 
 void OvCore::ECS::Components::CPhysicalObject::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
@@ -168,6 +194,42 @@ void OvCore::ECS::Components::CPhysicalObject::OnDeserialize(tinyxml2::XMLDocume
 	SetLinearFactor(Helpers::Serializer::DeserializeVec3(p_doc, p_node, "linear_factor"));
 	SetAngularFactor(Helpers::Serializer::DeserializeVec3(p_doc, p_node, "angular_factor"));
 	SetCollisionDetectionMode(static_cast<OvPhysics::Entities::PhysicalObject::ECollisionDetectionMode>(Helpers::Serializer::DeserializeInt(p_doc, p_node, "collision_mode")));
+
+	// Scenes saved before collision layers existed keep the default layer
+	uint32_t layer = GetLayer();
+	Helpers::Serializer::DeserializeUint32(p_doc, p_node, "layer", layer);
+	SetLayer(layer);
+}
+
+void OvCore::ECS::Components::CPhysicalObject::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	SetTrigger(Helpers::Serializer::DeserializeBoolean(p_node, "is_trigger"));
+	SetKinematic(Helpers::Serializer::DeserializeBoolean(p_node, "is_kinematic"));
+	SetBounciness(Helpers::Serializer::DeserializeFloat(p_node, "bounciness"));
+	SetMass(Helpers::Serializer::DeserializeFloat(p_node, "mass"));
+	SetFriction(Helpers::Serializer::DeserializeFloat(p_node, "friction"));
+	SetLinearFactor(Helpers::Serializer::DeserializeVec3(p_node, "linear_factor"));
+	SetAngularFactor(Helpers::Serializer::DeserializeVec3(p_node, "angular_factor"));
+	SetCollisionDetectionMode(static_cast<OvPhysics::Entities::PhysicalObject::ECollisionDetectionMode>(Helpers::Serializer::DeserializeInt(p_node, "collision_mode")));
+
+	uint32_t layer = GetLayer();
+	Helpers::Serializer::DeserializeUint32(p_node, "layer", layer);
+	SetLayer(layer);
+}
+
+void OvCore::ECS::Components::CPhysicalObject::CopyFrom(const AComponent& p_source)
+{
+	const auto& source = static_cast<const CPhysicalObject&>(p_source);
+
+	SetTrigger(source.IsTrigger());
+	SetKinematic(source.IsKinematic());
+	SetBounciness(source.GetBounciness());
+	SetMass(source.GetMass());
+	SetFriction(source.GetFriction());
+	SetLinearFactor(source.GetLinearFactor());
+	SetAngularFactor(source.GetAngularFactor());
+	SetCollisionDetectionMode(source.GetCollisionDetectionMode());
+	SetLayer(source.GetLayer());
 }
 
 void OvCore::ECS::Components::CPhysicalObject::OnInspector(OvUI::Internal::WidgetContainer & p_root)
@@ -179,6 +241,7 @@ void OvCore::ECS::Components::CPhysicalObject::OnInspector(OvUI::Internal::Widge
 	Helpers::GUIDrawer::DrawScalar<float>(p_root, "Friction", std::bind(&CPhysicalObject::GetFriction, this), std::bind(&CPhysicalObject::SetFriction, this, std::placeholders::_1), 0.1f, 0.f, 1.f);
 	Helpers::GUIDrawer::DrawVec3(p_root, "Linear Factor", std::bind(&CPhysicalObject::GetLinearFactor, this), std::bind(&CPhysicalObject::SetLinearFactor, this, std::placeholders::_1), 0.1f, 0.f, 1.f);
 	Helpers::GUIDrawer::DrawVec3(p_root, "Angular Factor", std::bind(&CPhysicalObject::GetAngularFactor, this), std::bind(&CPhysicalObject::SetAngularFactor, this, std::placeholders::_1), 0.1f, 0.f, 1.f);
+	Helpers::GUIDrawer::DrawScalar<int>(p_root, "Layer", [this] { return static_cast<int>(GetLayer()); }, [this](int p_layer) { SetLayer(static_cast<uint32_t>(p_layer)); }, 1.f, 0, static_cast<int>(OvPhysics::Settings::PhysicsSettings::kLayerCount) - 1);
 	
 	Helpers::GUIDrawer::CreateTitle(p_root, "Collision Mode");
 	auto& collisionMode = p_root.CreateWidget<OvUI::Widgets::Selection::ComboBox>(static_cast<int>(GetCollisionDetectionMode()));
@@ -7,6 +7,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CPhysicalSphere.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvPhysics/Entities/PhysicalSphere.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -51,6 +52,13 @@ void OvCore::ECS::Components::CPhysicalSphere::OnSerialize(tinyxml2::XMLDocument
 	Helpers::Serializer::SerializeFloat(p_doc, p_node, "radius", GetRadius());
 }
 
+void OvCore::ECS::Components::CPhysicalSphere::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	CPhysicalObject::OnSerialize(p_writer);
+
+	Helpers::Serializer::SerializeFloat(p_writer, "radius", GetRadius());
+}
+
 void OvCore::ECS::Components::CPhysicalSphere::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	CPhysicalObject::OnDeserialize(p_doc, p_node);
@@ -58,6 +66,20 @@ void OvCore::ECS::Components::CPhysicalSphere::OnDeserialize(tinyxml2::XMLDocume
 	SetRadius(Helpers::Serializer::DeserializeFloat(p_doc, p_node, "radius"));
 }
 
+void OvCore::ECS::Components::CPhysicalSphere::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	CPhysicalObject::OnDeserialize(p_node);
+
+	SetRadius(Helpers::Serializer::DeserializeFloat(p_node, "radius"));
+}
+
+void OvCore::ECS::Components::CPhysicalSphere::CopyFrom(const AComponent& p_source)
+{
+	CPhysicalObject::CopyFrom(p_source);
+
+	SetRadius(static_cast<const CPhysicalSphere&>(p_source).GetRadius());
+}
+
 void OvCore::ECS::Components::CPhysicalSphere::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CPointLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvUI/Widgets/Texts/Text.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -70,6 +71,17 @@ void OvCore::ECS::Components::CPointLight::OnSerialize(tinyxml2::XMLDocument & p
 	Serializer::SerializeFloat(p_doc, p_node, "quadratic", m_data.quadratic);
 }
 
+void OvCore::ECS::Components::CPointLight::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnSerialize(p_writer);
+
+	Serializer::SerializeFloat(p_writer, "constant", m_data.constant);
+	Serializer::SerializeFloat(p_writer, "linear", m_data.linear);
+	Serializer::SerializeFloat(p_writer, "quadratic", m_data.quadratic);
+}
+
 void OvCore::ECS::Components::CPointLight::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	using namespace OvCore::Helpers;
@@ -81,6 +93,17 @@ void OvCore::ECS::Components::CPointLight::OnDeserialize(tinyxml2::XMLDocument &
 	Serializer::DeserializeFloat(p_doc, p_node, "quadratic", m_data.quadratic);
 }
 
+void OvCore::ECS::Components::CPointLight::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnDeserialize(p_node);
+
+	Serializer::DeserializeFloat(p_node, "constant", m_data.constant);
+	Serializer::DeserializeFloat(p_node, "linear", m_data.linear);
+	Serializer::DeserializeFloat(p_node, "quadratic", m_data.quadratic);
+}
+
 void OvCore::ECS::Components::CPointLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
@@ -5,6 +5,7 @@
 */
 
 #include <OvCore/ECS/Components/CPostProcessStack.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvUI/Widgets/Visual/Separator.h>
 #include <OvUI/Widgets/Layout/Spacing.h>
 #include <OvUI/Widgets/Selection/ComboBox.h>
@@ -51,6 +52,34 @@ void OvCore::ECS::Components::CPostProcessStack::OnSerialize(tinyxml2::XMLDocume
 	Helpers::Serializer::SerializeBoolean(p_doc, p_node, "fxaa_enabled", fxaaSettings.enabled);
 }
 
+void OvCore::ECS::Components::CPostProcessStack::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	auto& bloomSettings = m_settings.Get<Rendering::PostProcess::BloomEffect, Rendering::PostProcess::BloomSettings>();
+	auto& autoExposureSettings = m_settings.Get<Rendering::PostProcess::AutoExposureEffect, Rendering::PostProcess::AutoExposureSettings>();
+	auto& fxaaSettings = m_settings.Get<Rendering::PostProcess::FXAAEffect, Rendering::PostProcess::FXAASettings>();
+	auto& tonemappingSettings = m_settings.Get<Rendering::PostProcess::TonemappingEffect, Rendering::PostProcess::TonemappingSettings>();
+
+	Helpers::Serializer::SerializeBoolean(p_writer, "bloom_enabled", bloomSettings.enabled);
+	Helpers::Serializer::SerializeFloat(p_writer, "bloom_intensity", bloomSettings.intensity);
+	Helpers::Serializer::SerializeInt(p_writer, "bloom_passes", bloomSettings.passes);
+
+	Helpers::Serializer::SerializeBoolean(p_writer, "auto_exposure_enabled", autoExposureSettings.enabled);
+	Helpers::Serializer::SerializeFloat(p_writer, "auto_exposure_center_weight_bias", autoExposureSettings.centerWeightBias);
+	Helpers::Serializer::SerializeFloat(p_writer, "auto_exposure_luminance_min", autoExposureSettings.minLuminanceEV);
+	Helpers::Serializer::SerializeFloat(p_writer, "auto_exposure_luminance_max", autoExposureSettings.maxLuminanceEV);
+	Helpers::Serializer::SerializeFloat(p_writer, "auto_exposure_exposure_compensation", autoExposureSettings.exposureCompensationEV);
+	Helpers::Serializer::SerializeBoolean(p_writer, "auto_exposure_progressive", autoExposureSettings.progressive);
+	Helpers::Serializer::SerializeFloat(p_writer, "auto_exposure_speed_up", autoExposureSettings.speedUp);
+	Helpers::Serializer::SerializeFloat(p_writer, "auto_exposure_speed_down", autoExposureSettings.speedDown);
+
+	Helpers::Serializer::SerializeBoolean(p_writer, "tonemapping_enabled", tonemappingSettings.enabled);
+	Helpers::Serializer::SerializeFloat(p_writer, "tonemapping_exposure", tonemappingSettings.exposure);
+	Helpers::Serializer::SerializeInt(p_writer, "tonemapping_mode", static_cast<int>(tonemappingSettings.mode));
+	Helpers::Serializer::SerializeBoolean(p_writer, "tonemapping_gamma_correction", tonemappingSettings.gammaCorrection);
+
+	Helpers::Serializer::SerializeBoolean(p_writer, "fxaa_enabled", fxaaSettings.enabled);
+}
+
 void OvCore::ECS::Components::CPostProcessStack::OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node)
 {
 	auto& bloomSettings = m_settings.Get<Rendering::PostProcess::BloomEffect, Rendering::PostProcess::BloomSettings>();
@@ -79,6 +108,46 @@ void OvCore::ECS::Components::CPostProcessStack::OnDeserialize(tinyxml2::XMLDocu
 	Helpers::Serializer::DeserializeBoolean(p_doc, p_node, "fxaa_enabled", fxaaSettings.enabled);
 }
 
+void OvCore::ECS::Components::CPostProcessStack::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	auto& bloomSettings = m_settings.Get<Rendering::PostProcess::BloomEffect, Rendering::PostProcess::BloomSettings>();
+	auto& autoExposureSettings = m_settings.Get<Rendering::PostProcess::AutoExposureEffect, Rendering::PostProcess::AutoExposureSettings>();
+	auto& fxaaSettings = m_settings.Get<Rendering::PostProcess::FXAAEffect, Rendering::PostProcess::FXAASettings>();
+	auto& tonemappingSettings = m_settings.Get<Rendering::PostProcess::TonemappingEffect, Rendering::PostProcess::TonemappingSettings>();
+
+	Helpers::Serializer::DeserializeBoolean(p_node, "bloom_enabled", bloomSettings.enabled);
+	Helpers::Serializer::DeserializeFloat(p_node, "bloom_intensity", bloomSettings.intensity);
+	Helpers::Serializer::DeserializeInt(p_node, "bloom_passes", bloomSettings.passes);
+
+	Helpers::Serializer::DeserializeBoolean(p_node, "auto_exposure_enabled", autoExposureSettings.enabled);
+	Helpers::Serializer::DeserializeFloat(p_node, "auto_exposure_center_weight_bias", autoExposureSettings.centerWeightBias);
+	Helpers::Serializer::DeserializeFloat(p_node, "auto_exposure_min_luminance", autoExposureSettings.minLuminanceEV);
+	Helpers::Serializer::DeserializeFloat(p_node, "auto_exposure_max_luminance", autoExposureSettings.maxLuminanceEV);
+	Helpers::Serializer::DeserializeFloat(p_node, "auto_exposure_exposure_compensation", autoExposureSettings.exposureCompensationEV);
+	Helpers::Serializer::DeserializeBoolean(p_node, "auto_exposure_progressive", autoExposureSettings.progressive);
+	Helpers::Serializer::DeserializeFloat(p_node, "auto_exposure_speed_up", autoExposureSettings.speedUp);
+	Helpers::Serializer::DeserializeFloat(p_node, "auto_exposure_speed_down", autoExposureSettings.speedDown);
+
+	Helpers::Serializer::DeserializeBoolean(p_node, "tonemapping_enabled", tonemappingSettings.enabled);
+	Helpers::Serializer::DeserializeFloat(p_node, "tonemapping_exposure", tonemappingSettings.exposure);
+	Helpers::Serializer::DeserializeInt(p_node, "tonemapping_mode", reinterpret_cast<int&>(tonemappingSettings.mode));
+	Helpers::Serializer::DeserializeBoolean(p_node, "tonemapping_gamma_correction", tonemappingSettings.gammaCorrection);
+
+	Helpers::Serializer::DeserializeBoolean(p_node, "fxaa_enabled", fxaaSettings.enabled);
+}
+
+void OvCore::ECS::Components::CPostProcessStack::CopyFrom(const AComponent& p_source)
+{
+	using namespace Rendering::PostProcess;
+
+	const auto& source = static_cast<const CPostProcessStack&>(p_source).m_settings;
+
+	m_settings.Get<BloomEffect, BloomSettings>() = source.Get<BloomEffect, BloomSettings>();
+	m_settings.Get<AutoExposureEffect, AutoExposureSettings>() = source.Get<AutoExposureEffect, AutoExposureSettings>();
+	m_settings.Get<FXAAEffect, FXAASettings>() = source.Get<FXAAEffect, FXAASettings>();
+	m_settings.Get<TonemappingEffect, TonemappingSettings>() = source.Get<TonemappingEffect, TonemappingSettings>();
+}
+
 void OvCore::ECS::Components::CPostProcessStack::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	auto& bloomSettings = m_settings.Get<Rendering::PostProcess::BloomEffect, Rendering::PostProcess::BloomSettings>();
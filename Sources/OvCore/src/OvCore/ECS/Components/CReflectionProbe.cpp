@@ -9,6 +9,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CReflectionProbe.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvDebug/Assertion.h>
 
@@ -205,6 +206,19 @@ void OvCore::ECS::Components::CReflectionProbe::OnSerialize(tinyxml2::XMLDocumen
 	Serializer::SerializeBoolean(p_doc, p_node, "box_projection", m_boxProjection);
 }
 
+void OvCore::ECS::Components::CReflectionProbe::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	using namespace OvCore::Helpers;
+	Serializer::SerializeUint32(p_writer, "refresh_mode", static_cast<uint32_t>(m_refreshMode));
+	Serializer::SerializeUint32(p_writer, "capture_speed", static_cast<uint32_t>(m_captureSpeed));
+	Serializer::SerializeVec3(p_writer, "capture_position", m_capturePosition);
+	Serializer::SerializeFloat(p_writer, "brightness", m_brightness);
+	Serializer::SerializeUint32(p_writer, "resolution", m_resolution);
+	Serializer::SerializeUint32(p_writer, "influence_policy", static_cast<uint32_t>(m_influencePolicy));
+	Serializer::SerializeVec3(p_writer, "influence_size", m_influenceSize);
+	Serializer::SerializeBoolean(p_writer, "box_projection", m_boxProjection);
+}
+
 void OvCore::ECS::Components::CReflectionProbe::OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node)
 {
 	using namespace OvCore::Helpers;
@@ -227,6 +241,28 @@ void OvCore::ECS::Components::CReflectionProbe::OnDeserialize(tinyxml2::XMLDocum
 	m_captureFaceIndex = 0;
 }
 
+void OvCore::ECS::Components::CReflectionProbe::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	using namespace OvCore::Helpers;
+
+	// Not ideal, but avoids garbage value from overriding the current resolution.
+	if (p_node.FirstChildElement("resolution"))
+	{
+		m_resolution = Serializer::DeserializeInt(p_node, "resolution");
+	}
+
+	Serializer::DeserializeUint32(p_node, "refresh_mode", reinterpret_cast<uint32_t&>(m_refreshMode));
+	Serializer::DeserializeUint32(p_node, "capture_speed", reinterpret_cast<uint32_t&>(m_captureSpeed));
+	Serializer::DeserializeVec3(p_node, "capture_position", m_capturePosition);
+	Serializer::DeserializeFloat(p_node, "brightness", m_brightness);
+	Serializer::DeserializeUint32(p_node, "resolution", m_resolution);
+	Serializer::DeserializeUint32(p_node, "influence_policy", reinterpret_cast<uint32_t&>(m_influencePolicy));
+	Serializer::DeserializeVec3(p_node, "influence_size", m_influenceSize);
+	Serializer::DeserializeBoolean(p_node, "box_projection", m_boxProjection);
+
+	m_captureFaceIndex = 0;
+}
+
 void OvCore::ECS::Components::CReflectionProbe::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
@@ -6,6 +6,7 @@
 
 #include <OvCore/ECS/Actor.h>
 #include <OvCore/ECS/Components/CSpotLight.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvUI/Widgets/Buttons/Button.h>
 #include <OvUI/Widgets/Drags/DragFloat.h>
@@ -92,6 +93,19 @@ void OvCore::ECS::Components::CSpotLight::OnSerialize(tinyxml2::XMLDocument & p_
 	Serializer::SerializeFloat(p_doc, p_node, "outercutoff", m_data.outerCutoff);
 }
 
+void OvCore::ECS::Components::CSpotLight::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnSerialize(p_writer);
+
+	Serializer::SerializeFloat(p_writer, "constant", m_data.constant);
+	Serializer::SerializeFloat(p_writer, "linear", m_data.linear);
+	Serializer::SerializeFloat(p_writer, "quadratic", m_data.quadratic);
+	Serializer::SerializeFloat(p_writer, "cutoff", m_data.cutoff);
+	Serializer::SerializeFloat(p_writer, "outercutoff", m_data.outerCutoff);
+}
+
 void OvCore::ECS::Components::CSpotLight::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	using namespace OvCore::Helpers;
@@ -105,6 +119,19 @@ void OvCore::ECS::Components::CSpotLight::OnDeserialize(tinyxml2::XMLDocument &
 	Serializer::DeserializeFloat(p_doc, p_node, "outercutoff", m_data.outerCutoff);
 }
 
+void OvCore::ECS::Components::CSpotLight::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	using namespace OvCore::Helpers;
+
+	CLight::OnDeserialize(p_node);
+
+	Serializer::DeserializeFloat(p_node, "constant", m_data.constant);
+	Serializer::DeserializeFloat(p_node, "linear", m_data.linear);
+	Serializer::DeserializeFloat(p_node, "quadratic", m_data.quadratic);
+	Serializer::DeserializeFloat(p_node, "cutoff", m_data.cutoff);
+	Serializer::DeserializeFloat(p_node, "outercutoff", m_data.outerCutoff);
+}
+
 void OvCore::ECS::Components::CSpotLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvCore::Helpers;
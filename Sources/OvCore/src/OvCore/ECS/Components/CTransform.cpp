@@ -5,6 +5,7 @@
 */
 
 #include <OvCore/ECS/Components/CTransform.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 OvCore::ECS::Components::CTransform::CTransform(ECS::Actor& p_owner, OvMaths::FVector3 p_localPosition, OvMaths::FQuaternion p_localRotation, OvMaths::FVector3 p_localScale) :
 AComponent(p_owner)
@@ -164,6 +165,13 @@ void OvCore::ECS::Components::CTransform::OnSerialize(tinyxml2::XMLDocument& p_d
 	OvCore::Helpers::Serializer::SerializeVec3(p_doc, p_node, "scale", GetLocalScale());
 }
 
+void OvCore::ECS::Components::CTransform::OnSerialize(OvCore::Helpers::BinaryWriter& p_writer)
+{
+	OvCore::Helpers::Serializer::SerializeVec3(p_writer, "position", GetLocalPosition());
+	OvCore::Helpers::Serializer::SerializeQuat(p_writer, "rotation", GetLocalRotation());
+	OvCore::Helpers::Serializer::SerializeVec3(p_writer, "scale", GetLocalScale());
+}
+
 void OvCore::ECS::Components::CTransform::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	m_transform.GenerateMatricesLocal
@@ -174,6 +182,28 @@ void OvCore::ECS::Components::CTransform::OnDeserialize(tinyxml2::XMLDocument &
 	);
 }
 
+void OvCore::ECS::Components::CTransform::OnDeserialize(const OvCore::Helpers::BinaryNode& p_node)
+{
+	m_transform.GenerateMatricesLocal
+	(
+		OvCore::Helpers::Serializer::DeserializeVec3(p_node, "position"),
+		OvCore::Helpers::Serializer::DeserializeQuat(p_node, "rotation"),
+		OvCore::Helpers::Serializer::DeserializeVec3(p_node, "scale")
+	);
+}
+
+void OvCore::ECS::Components::CTransform::CopyFrom(const AComponent& p_source)
+{
+	const auto& source = static_cast<const CTransform&>(p_source);
+
+	m_transform.GenerateMatricesLocal
+	(
+		source.m_transform.GetLocalPosition(),
+		source.m_transform.GetLocalRotation(),
+		source.m_transform.GetLocalScale()
+	);
+}
+
 void OvCore::ECS::Components::CTransform::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	auto getRotation = [this]
@@ -10,6 +10,14 @@
 
 #include <OvPhysics/Core/PhysicsEngine.h>
 
+namespace
+{
+	OvCore::ECS::Components::CPhysicalObject* ToComponent(OvPhysics::Entities::PhysicalObject* p_object)
+	{
+		return std::addressof(p_object->GetUserData<std::reference_wrapper<OvCore::ECS::Components::CPhysicalObject>>().get());
+	}
+}
+
 std::optional<OvCore::ECS::PhysicsWrapper::RaycastHit> OvCore::ECS::PhysicsWrapper::Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance)
 {
 	if (auto result = OVSERVICE(OvPhysics::Core::PhysicsEngine).Raycast(p_origin, p_direction, p_distance))
@@ -25,3 +33,46 @@ std::optional<OvCore::ECS::PhysicsWrapper::RaycastHit> OvCore::ECS::PhysicsWrapp
 	else
 		return {};
 }
+
+std::optional<OvCore::ECS::PhysicsWrapper::RaycastHit> OvCore::ECS::PhysicsWrapper::SphereCast(OvMaths::FVector3 p_origin, float p_radius, OvMaths::FVector3 p_direction, float p_distance)
+{
+	OvPhysics::Core::SweepQuery query;
+	query.shape.type = OvPhysics::Core::EQueryShape::SPHERE;
+	query.shape.radius = p_radius;
+	query.origin = p_origin;
+	query.direction = p_direction;
+	query.distance = p_distance;
+	query.mode = OvPhysics::Core::EQueryMode::ALL;
+
+	OvPhysics::Core::QueryResults results;
+	OVSERVICE(OvPhysics::Core::PhysicsEngine).Sweep({ &query, 1 }, results, false);
+
+	if (!results.HasHit(0))
+		return {};
+
+	RaycastHit finalResult;
+
+	finalResult.FirstResultObject = ToComponent(results.GetHits(0).front().object);
+	for (const auto& hit : results.GetHits(0))
+		finalResult.ResultObjects.push_back(ToComponent(hit.object));
+
+	return finalResult;
+}
+
+std::vector<OvCore::ECS::Components::CPhysicalObject*> OvCore::ECS::PhysicsWrapper::OverlapSphere(OvMaths::FVector3 p_center, float p_radius)
+{
+	OvPhysics::Core::OverlapQuery query;
+	query.shape.type = OvPhysics::Core::EQueryShape::SPHERE;
+	query.shape.radius = p_radius;
+	query.position = p_center;
+
+	OvPhysics::Core::QueryResults results;
+	OVSERVICE(OvPhysics::Core::PhysicsEngine).Overlap({ &query, 1 }, results, false);
+
+	std::vector<Components::CPhysicalObject*> objects;
+
+	for (const auto& hit : results.GetHits(0))
+		objects.push_back(ToComponent(hit.object));
+
+	return objects;
+}
@@ -0,0 +1,839 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+#include <tinyxml2.h>
+#include <tracy/Tracy.hpp>
+
+#include <OvCore/Helpers/BinaryDocument.h>
+#include <OvTools/Filesystem/MappedFile.h>
+
+namespace
+{
+	using ENodeType = OvCore::Helpers::BinaryDocument::ENodeType;
+	using ETextType = OvCore::Helpers::BinaryDocument::ETextType;
+
+	constexpr size_t kHeaderSize = sizeof(OvCore::Helpers::BinaryDocument::kMagic) + 4 * sizeof(uint32_t);
+	constexpr int kTextBufferSize = 200;
+
+	template<typename T>
+	T Read(const uint8_t* p_data)
+	{
+		std::array<uint8_t, sizeof(T)> bytes;
+		std::memcpy(bytes.data(), p_data, sizeof(T));
+
+		if constexpr (std::endian::native == std::endian::big)
+			std::reverse(bytes.begin(), bytes.end());
+
+		return std::bit_cast<T>(bytes);
+	}
+
+	template<typename T>
+	T Consume(const uint8_t*& p_cursor)
+	{
+		const T value = Read<T>(p_cursor);
+		p_cursor += sizeof(T);
+		return value;
+	}
+
+	template<typename T>
+	void Write(std::vector<uint8_t>& p_out, T p_value)
+	{
+		auto bytes = std::bit_cast<std::array<uint8_t, sizeof(T)>>(p_value);
+
+		if constexpr (std::endian::native == std::endian::big)
+			std::reverse(bytes.begin(), bytes.end());
+
+		p_out.insert(p_out.end(), bytes.begin(), bytes.end());
+	}
+
+	template<typename T>
+	void Patch(std::vector<uint8_t>& p_out, size_t p_offset, T p_value)
+	{
+		auto bytes = std::bit_cast<std::array<uint8_t, sizeof(T)>>(p_value);
+
+		if constexpr (std::endian::native == std::endian::big)
+			std::reverse(bytes.begin(), bytes.end());
+
+		std::copy(bytes.begin(), bytes.end(), p_out.begin() + p_offset);
+	}
+
+	size_t GetTextPayloadSize(ETextType p_type)
+	{
+		switch (p_type)
+		{
+		case ETextType::STRING: return sizeof(uint32_t);
+		case ETextType::BOOLEAN: return sizeof(uint8_t);
+		case ETextType::INT64: return sizeof(int64_t);
+		case ETextType::FLOAT: return sizeof(float);
+		case ETextType::DOUBLE: return sizeof(double);
+		}
+
+		return 0;
+	}
+
+	/* Element layout: [type:u8][name:u32][attributeCount:u32][(name:u32, value:u32) * attributeCount][childrenSize:u32][children] */
+	const uint8_t* GetAttributes(const uint8_t* p_element)
+	{
+		return p_element + 1 + 2 * sizeof(uint32_t);
+	}
+
+	const uint8_t* GetChildrenHeader(const uint8_t* p_element)
+	{
+		const uint32_t attributeCount = Read<uint32_t>(p_element + 1 + sizeof(uint32_t));
+		return GetAttributes(p_element) + attributeCount * 2 * sizeof(uint32_t);
+	}
+
+	const uint8_t* GetChildrenBegin(const uint8_t* p_element)
+	{
+		return GetChildrenHeader(p_element) + sizeof(uint32_t);
+	}
+
+	const uint8_t* GetChildrenEnd(const uint8_t* p_element)
+	{
+		const uint8_t* childrenHeader = GetChildrenHeader(p_element);
+		return childrenHeader + sizeof(uint32_t) + Read<uint32_t>(childrenHeader);
+	}
+
+	const uint8_t* GetNextNode(const uint8_t* p_node)
+	{
+		switch (static_cast<ENodeType>(*p_node))
+		{
+		case ENodeType::ELEMENT: return GetChildrenEnd(p_node);
+		case ENodeType::TEXT: return p_node + 2 + GetTextPayloadSize(static_cast<ETextType>(p_node[1]));
+		default: return p_node + 1 + sizeof(uint32_t);
+		}
+	}
+
+	const uint8_t* FindElement(const uint8_t* p_begin, const uint8_t* p_end, bool p_filterByName, uint32_t p_name)
+	{
+		for (const uint8_t* node = p_begin; node < p_end; node = GetNextNode(node))
+		{
+			if (static_cast<ENodeType>(*node) == ENodeType::ELEMENT && (!p_filterByName || Read<uint32_t>(node + 1) == p_name))
+				return node;
+		}
+
+		return nullptr;
+	}
+
+	bool ValidateNodes(const uint8_t* p_begin, const uint8_t* p_end, uint32_t p_stringCount)
+	{
+		const uint8_t* cursor = p_begin;
+
+		auto hasBytes = [&cursor, p_end](size_t p_size) { return static_cast<size_t>(p_end - cursor) >= p_size; };
+		auto isString = [p_stringCount](uint32_t p_index) { return p_index < p_stringCount; };
+
+		while (cursor < p_end)
+		{
+			const auto type = static_cast<ENodeType>(*cursor++);
+
+			switch (type)
+			{
+			case ENodeType::ELEMENT:
+			{
+				if (!hasBytes(2 * sizeof(uint32_t)) || !isString(Consume<uint32_t>(cursor)))
+					return false;
+
+				const uint32_t attributeCount = Consume<uint32_t>(cursor);
+
+				if (static_cast<size_t>(p_end - cursor) / (2 * sizeof(uint32_t)) < attributeCount)
+					return false;
+
+				for (uint32_t i = 0; i < 2 * attributeCount; ++i)
+				{
+					if (!isString(Consume<uint32_t>(cursor)))
+						return false;
+				}
+
+				if (!hasBytes(sizeof(uint32_t)))
+					return false;
+
+				const uint32_t childrenSize = Consume<uint32_t>(cursor);
+
+				if (!hasBytes(childrenSize) || !ValidateNodes(cursor, cursor + childrenSize, p_stringCount))
+					return false;
+
+				cursor += childrenSize;
+				break;
+			}
+			case ENodeType::TEXT:
+			{
+				if (!hasBytes(1) || *cursor > static_cast<uint8_t>(ETextType::DOUBLE))
+					return false;
+
+				const auto textType = static_cast<ETextType>(*cursor++);
+				const size_t payloadSize = GetTextPayloadSize(textType);
+
+				if (!hasBytes(payloadSize) || (textType == ETextType::STRING && !isString(Read<uint32_t>(cursor))))
+					return false;
+
+				cursor += payloadSize;
+				break;
+			}
+			case ENodeType::COMMENT:
+			case ENodeType::DECLARATION:
+			case ENodeType::UNKNOWN:
+			{
+				if (!hasBytes(sizeof(uint32_t)) || !isString(Consume<uint32_t>(cursor)))
+					return false;
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+
+		return cursor == p_end;
+	}
+
+	template<typename T>
+	bool IsExactText(T p_value, const char* p_text)
+	{
+		char buffer[kTextBufferSize];
+		tinyxml2::XMLUtil::ToStr(p_value, buffer, kTextBufferSize);
+		return std::strcmp(buffer, p_text) == 0;
+	}
+}
+
+OvCore::Helpers::BinaryNode::BinaryNode(const BinaryDocument* p_document, const uint8_t* p_node, const uint8_t* p_end) :
+	m_document(p_document),
+	m_node(p_node),
+	m_end(p_end)
+{
+}
+
+OvCore::Helpers::BinaryNode::operator bool() const
+{
+	return m_node != nullptr;
+}
+
+std::string_view OvCore::Helpers::BinaryNode::Name() const
+{
+	return m_node ? m_document->GetString(Read<uint32_t>(m_node + 1)) : std::string_view{};
+}
+
+OvCore::Helpers::BinaryNode OvCore::Helpers::BinaryNode::FirstChildElement(std::string_view p_name) const
+{
+	if (!m_node)
+		return {};
+
+	uint32_t nameIndex = 0;
+	if (!p_name.empty() && !m_document->FindString(p_name, nameIndex))
+		return {};
+
+	const uint8_t* childrenEnd = GetChildrenEnd(m_node);
+
+	if (const uint8_t* found = FindElement(GetChildrenBegin(m_node), childrenEnd, !p_name.empty(), nameIndex))
+		return BinaryNode(m_document, found, childrenEnd);
+
+	return {};
+}
+
+OvCore::Helpers::BinaryNode OvCore::Helpers::BinaryNode::NextSiblingElement(std::string_view p_name) const
+{
+	if (!m_node)
+		return {};
+
+	uint32_t nameIndex = 0;
+	if (!p_name.empty() && !m_document->FindString(p_name, nameIndex))
+		return {};
+
+	if (const uint8_t* found = FindElement(GetNextNode(m_node), m_end, !p_name.empty(), nameIndex))
+		return BinaryNode(m_document, found, m_end);
+
+	return {};
+}
+
+const char* OvCore::Helpers::BinaryNode::Attribute(std::string_view p_name) const
+{
+	uint32_t nameIndex = 0;
+
+	if (m_node && m_document->FindString(p_name, nameIndex))
+	{
+		const uint32_t attributeCount = Read<uint32_t>(m_node + 1 + sizeof(uint32_t));
+		const uint8_t* attributes = GetAttributes(m_node);
+
+		for (uint32_t i = 0; i < attributeCount; ++i)
+		{
+			if (Read<uint32_t>(attributes + i * 2 * sizeof(uint32_t)) == nameIndex)
+				return m_document->GetString(Read<uint32_t>(attributes + (i * 2 + 1) * sizeof(uint32_t)));
+		}
+	}
+
+	return nullptr;
+}
+
+const uint8_t* OvCore::Helpers::BinaryNode::GetTextNode() const
+{
+	if (m_node)
+	{
+		const uint8_t* firstChild = GetChildrenBegin(m_node);
+
+		if (firstChild < GetChildrenEnd(m_node) && static_cast<BinaryDocument::ENodeType>(*firstChild) == BinaryDocument::ENodeType::TEXT)
+			return firstChild;
+	}
+
+	return nullptr;
+}
+
+bool OvCore::Helpers::BinaryNode::FormatText(char* p_buffer, int p_bufferSize) const
+{
+	const uint8_t* text = GetTextNode();
+	return text && m_document->FormatText(text, p_buffer, p_bufferSize);
+}
+
+bool OvCore::Helpers::BinaryNode::QueryStringText(std::string& p_out) const
+{
+	const uint8_t* text = GetTextNode();
+
+	if (!text)
+		return false;
+
+	if (static_cast<BinaryDocument::ETextType>(text[1]) == BinaryDocument::ETextType::STRING)
+	{
+		p_out = m_document->GetString(Read<uint32_t>(text + 2));
+		return true;
+	}
+
+	char buffer[kTextBufferSize];
+	FormatText(buffer, kTextBufferSize);
+	p_out = buffer;
+	return true;
+}
+
+/*
+* Typed values are returned directly. Mismatching types go through the exact text the XML
+* document would contain, so both formats always yield the same results
+*/
+
+bool OvCore::Helpers::BinaryNode::QueryBoolText(bool& p_out) const
+{
+	if (const uint8_t* text = GetTextNode(); text && static_cast<BinaryDocument::ETextType>(text[1]) == BinaryDocument::ETextType::BOOLEAN)
+	{
+		p_out = text[2] != 0;
+		return true;
+	}
+
+	char buffer[kTextBufferSize];
+	return FormatText(buffer, kTextBufferSize) && tinyxml2::XMLUtil::ToBool(buffer, &p_out);
+}
+
+bool OvCore::Helpers::BinaryNode::QueryIntText(int& p_out) const
+{
+	if (const uint8_t* text = GetTextNode(); text && static_cast<BinaryDocument::ETextType>(text[1]) == BinaryDocument::ETextType::INT64)
+	{
+		if (const int64_t value = Read<int64_t>(text + 2); value >= INT32_MIN && value <= INT32_MAX)
+		{
+			p_out = static_cast<int>(value);
+			return true;
+		}
+	}
+
+	char buffer[kTextBufferSize];
+	return FormatText(buffer, kTextBufferSize) && tinyxml2::XMLUtil::ToInt(buffer, &p_out);
+}
+
+bool OvCore::Helpers::BinaryNode::QueryUnsignedText(uint32_t& p_out) const
+{
+	if (const uint8_t* text = GetTextNode(); text && static_cast<BinaryDocument::ETextType>(text[1]) == BinaryDocument::ETextType::INT64)
+	{
+		if (const int64_t value = Read<int64_t>(text + 2); value >= 0 && value <= UINT32_MAX)
+		{
+			p_out = static_cast<uint32_t>(value);
+			return true;
+		}
+	}
+
+	char buffer[kTextBufferSize];
+	unsigned value = 0;
+
+	if (FormatText(buffer, kTextBufferSize) && tinyxml2::XMLUtil::ToUnsigned(buffer, &value))
+	{
+		p_out = value;
+		return true;
+	}
+
+	return false;
+}
+
+bool OvCore::Helpers::BinaryNode::QueryInt64Text(int64_t& p_out) const
+{
+	if (const uint8_t* text = GetTextNode(); text && static_cast<BinaryDocument::ETextType>(text[1]) == BinaryDocument::ETextType::INT64)
+	{
+		p_out = Read<int64_t>(text + 2);
+		return true;
+	}
+
+	char buffer[kTextBufferSize];
+	return FormatText(buffer, kTextBufferSize) && tinyxml2::XMLUtil::ToInt64(buffer, &p_out);
+}
+
+bool OvCore::Helpers::BinaryNode::QueryFloatText(float& p_out) const
+{
+	if (const uint8_t* text = GetTextNode(); text)
+	{
+		switch (static_cast<BinaryDocument::ETextType>(text[1]))
+		{
+		case BinaryDocument::ETextType::FLOAT: p_out = Read<float>(text + 2); return true;
+		case BinaryDocument::ETextType::INT64: p_out = static_cast<float>(Read<int64_t>(text + 2)); return true;
+		default: break;
+		}
+	}
+
+	char buffer[kTextBufferSize];
+	return FormatText(buffer, kTextBufferSize) && tinyxml2::XMLUtil::ToFloat(buffer, &p_out);
+}
+
+bool OvCore::Helpers::BinaryNode::QueryDoubleText(double& p_out) const
+{
+	if (const uint8_t* text = GetTextNode(); text)
+	{
+		switch (static_cast<BinaryDocument::ETextType>(text[1]))
+		{
+		case BinaryDocument::ETextType::DOUBLE: p_out = Read<double>(text + 2); return true;
+		case BinaryDocument::ETextType::INT64: p_out = static_cast<double>(Read<int64_t>(text + 2)); return true;
+		default: break;
+		}
+	}
+
+	char buffer[kTextBufferSize];
+	return FormatText(buffer, kTextBufferSize) && tinyxml2::XMLUtil::ToDouble(buffer, &p_out);
+}
+
+void OvCore::Helpers::BinaryWriter::BeginElement(std::string_view p_name)
+{
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::ELEMENT));
+	Write<uint32_t>(m_nodes, Intern(p_name));
+	Write<uint32_t>(m_nodes, 0);
+
+	m_openedElements.push_back(m_nodes.size());
+	Write<uint32_t>(m_nodes, 0);
+}
+
+void OvCore::Helpers::BinaryWriter::EndElement()
+{
+	const size_t sizeOffset = m_openedElements.back();
+	m_openedElements.pop_back();
+
+	Patch<uint32_t>(m_nodes, sizeOffset, static_cast<uint32_t>(m_nodes.size() - sizeOffset - sizeof(uint32_t)));
+}
+
+void OvCore::Helpers::BinaryWriter::WriteText(const char* p_value)
+{
+	const char* text = p_value ? p_value : "";
+
+	bool boolValue = false;
+	int64_t int64Value = 0;
+	float floatValue = 0.0f;
+	double doubleValue = 0.0;
+
+	if ((std::strcmp(text, "true") == 0 || std::strcmp(text, "false") == 0) && tinyxml2::XMLUtil::ToBool(text, &boolValue) && IsExactText(boolValue, text))
+	{
+		WriteBoolText(boolValue);
+	}
+	else if (tinyxml2::XMLUtil::ToInt64(text, &int64Value) && IsExactText(int64Value, text))
+	{
+		WriteInt64Text(int64Value);
+	}
+	else if (tinyxml2::XMLUtil::ToFloat(text, &floatValue) && IsExactText(floatValue, text))
+	{
+		WriteFloatText(floatValue);
+	}
+	else if (tinyxml2::XMLUtil::ToDouble(text, &doubleValue) && IsExactText(doubleValue, text))
+	{
+		WriteDoubleText(doubleValue);
+	}
+	else
+	{
+		Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::TEXT));
+		Write<uint8_t>(m_nodes, static_cast<uint8_t>(ETextType::STRING));
+		Write<uint32_t>(m_nodes, Intern(text));
+	}
+}
+
+void OvCore::Helpers::BinaryWriter::WriteBoolText(bool p_value)
+{
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::TEXT));
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ETextType::BOOLEAN));
+	Write<uint8_t>(m_nodes, p_value ? 1 : 0);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteInt64Text(int64_t p_value)
+{
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::TEXT));
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ETextType::INT64));
+	Write<int64_t>(m_nodes, p_value);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteFloatText(float p_value)
+{
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::TEXT));
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ETextType::FLOAT));
+	Write<float>(m_nodes, p_value);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteDoubleText(double p_value)
+{
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::TEXT));
+	Write<uint8_t>(m_nodes, static_cast<uint8_t>(ETextType::DOUBLE));
+	Write<double>(m_nodes, p_value);
+}
+
+void OvCore::Helpers::BinaryWriter::WriteNode(const tinyxml2::XMLNode& p_node)
+{
+	if (const tinyxml2::XMLElement* element = p_node.ToElement())
+	{
+		Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::ELEMENT));
+		Write<uint32_t>(m_nodes, Intern(element->Name()));
+
+		uint32_t attributeCount = 0;
+		for (const tinyxml2::XMLAttribute* attribute = element->FirstAttribute(); attribute; attribute = attribute->Next())
+			++attributeCount;
+
+		Write<uint32_t>(m_nodes, attributeCount);
+
+		for (const tinyxml2::XMLAttribute* attribute = element->FirstAttribute(); attribute; attribute = attribute->Next())
+		{
+			Write<uint32_t>(m_nodes, Intern(attribute->Name()));
+			Write<uint32_t>(m_nodes, Intern(attribute->Value()));
+		}
+
+		WriteChildren(p_node);
+	}
+	else if (const tinyxml2::XMLText* text = p_node.ToText())
+	{
+		WriteText(text->Value());
+	}
+	else if (const tinyxml2::XMLComment* comment = p_node.ToComment())
+	{
+		Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::COMMENT));
+		Write<uint32_t>(m_nodes, Intern(comment->Value()));
+	}
+	else if (const tinyxml2::XMLDeclaration* declaration = p_node.ToDeclaration())
+	{
+		Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::DECLARATION));
+		Write<uint32_t>(m_nodes, Intern(declaration->Value()));
+	}
+	else if (const tinyxml2::XMLUnknown* unknown = p_node.ToUnknown())
+	{
+		Write<uint8_t>(m_nodes, static_cast<uint8_t>(ENodeType::UNKNOWN));
+		Write<uint32_t>(m_nodes, Intern(unknown->Value()));
+	}
+}
+
+std::vector<uint8_t> OvCore::Helpers::BinaryWriter::Finalize() const
+{
+	std::vector<uint8_t> result;
+
+	uint32_t stringDataSize = 0;
+	for (const auto& string : m_strings)
+		stringDataSize += static_cast<uint32_t>(string.size() + 1);
+
+	result.reserve(kHeaderSize + m_strings.size() * sizeof(uint32_t) + stringDataSize + m_nodes.size());
+
+	result.insert(result.end(), std::begin(BinaryDocument::kMagic), std::end(BinaryDocument::kMagic));
+	Write<uint32_t>(result, BinaryDocument::kVersion);
+	Write<uint32_t>(result, static_cast<uint32_t>(m_strings.size()));
+	Write<uint32_t>(result, stringDataSize);
+	Write<uint32_t>(result, static_cast<uint32_t>(m_nodes.size()));
+
+	uint32_t offset = 0;
+	for (const auto& string : m_strings)
+	{
+		Write<uint32_t>(result, offset);
+		offset += static_cast<uint32_t>(string.size() + 1);
+	}
+
+	for (const auto& string : m_strings)
+		result.insert(result.end(), string.c_str(), string.c_str() + string.size() + 1);
+
+	result.insert(result.end(), m_nodes.begin(), m_nodes.end());
+
+	return result;
+}
+
+uint32_t OvCore::Helpers::BinaryWriter::Intern(std::string_view p_string)
+{
+	const auto [it, inserted] = m_indices.try_emplace(std::string(p_string), static_cast<uint32_t>(m_strings.size()));
+
+	if (inserted)
+		m_strings.push_back(it->first);
+
+	return it->second;
+}
+
+void OvCore::Helpers::BinaryWriter::WriteChildren(const tinyxml2::XMLNode& p_node)
+{
+	const size_t sizeOffset = m_nodes.size();
+	Write<uint32_t>(m_nodes, 0);
+
+	for (const tinyxml2::XMLNode* child = p_node.FirstChild(); child; child = child->NextSibling())
+		WriteNode(*child);
+
+	Patch<uint32_t>(m_nodes, sizeOffset, static_cast<uint32_t>(m_nodes.size() - sizeOffset - sizeof(uint32_t)));
+}
+
+OvCore::Helpers::BinaryDocument::BinaryDocument()
+{
+}
+
+OvCore::Helpers::BinaryDocument::~BinaryDocument()
+{
+}
+
+bool OvCore::Helpers::BinaryDocument::LoadFile(const std::string& p_filePath)
+{
+	ZoneScoped;
+
+	auto file = std::make_unique<OvTools::Filesystem::MappedFile>(p_filePath);
+
+	if (!file->IsValid())
+	{
+		m_error = true;
+		return false;
+	}
+
+	m_file = std::move(file);
+	return Load(m_file->GetData());
+}
+
+bool OvCore::Helpers::BinaryDocument::Load(std::span<const uint8_t> p_data)
+{
+	ZoneScoped;
+
+	m_error = true;
+	m_nodes = {};
+	m_strings.clear();
+	m_stringIndices.clear();
+
+	if (!IsBinary(p_data) || p_data.size() < kHeaderSize)
+		return false;
+
+	const uint8_t* cursor = p_data.data() + sizeof(kMagic);
+	const uint32_t version = Consume<uint32_t>(cursor);
+	const uint64_t stringCount = Consume<uint32_t>(cursor);
+	const uint64_t stringDataSize = Consume<uint32_t>(cursor);
+	const uint64_t nodesSize = Consume<uint32_t>(cursor);
+
+	if (version != kVersion || kHeaderSize + stringCount * sizeof(uint32_t) + stringDataSize + nodesSize != p_data.size())
+		return false;
+
+	const uint8_t* offsets = cursor;
+	const char* stringData = reinterpret_cast<const char*>(offsets + stringCount * sizeof(uint32_t));
+
+	// Every string is null-terminated, so the table must end with a terminator
+	if (stringCount > 0 && (stringDataSize == 0 || stringData[stringDataSize - 1] != '\0'))
+		return false;
+
+	m_strings.reserve(stringCount);
+	m_stringIndices.reserve(stringCount);
+
+	for (uint32_t i = 0; i < stringCount; ++i)
+	{
+		const uint32_t offset = Read<uint32_t>(offsets + i * sizeof(uint32_t));
+
+		if (offset >= stringDataSize)
+			return false;
+
+		m_strings.push_back(stringData + offset);
+		m_stringIndices.emplace(m_strings.back(), i);
+	}
+
+	m_nodes = p_data.subspan(p_data.size() - nodesSize);
+
+	if (!ValidateNodes(m_nodes.data(), m_nodes.data() + m_nodes.size(), static_cast<uint32_t>(stringCount)))
+	{
+		m_nodes = {};
+		return false;
+	}
+
+	m_error = false;
+	return true;
+}
+
+bool OvCore::Helpers::BinaryDocument::Error() const
+{
+	return m_error;
+}
+
+OvCore::Helpers::BinaryNode OvCore::Helpers::BinaryDocument::FirstChildElement(std::string_view p_name) const
+{
+	if (m_error)
+		return {};
+
+	uint32_t nameIndex = 0;
+	if (!p_name.empty() && !FindString(p_name, nameIndex))
+		return {};
+
+	const uint8_t* end = m_nodes.data() + m_nodes.size();
+
+	if (const uint8_t* found = FindElement(m_nodes.data(), end, !p_name.empty(), nameIndex))
+		return BinaryNode(this, found, end);
+
+	return {};
+}
+
+bool OvCore::Helpers::BinaryDocument::ToXML(tinyxml2::XMLDocument& p_out) const
+{
+	if (m_error)
+		return false;
+
+	p_out.Clear();
+
+	const uint8_t* end = m_nodes.data() + m_nodes.size();
+
+	for (const uint8_t* node = m_nodes.data(); node < end; node = GetNextNode(node))
+	{
+		if (static_cast<ENodeType>(*node) == ENodeType::ELEMENT)
+			ToXML(BinaryNode(this, node, end), p_out, &p_out);
+		else
+			InsertNode(node, p_out, &p_out);
+	}
+
+	return true;
+}
+
+tinyxml2::XMLNode* OvCore::Helpers::BinaryDocument::ToXML(const BinaryNode& p_node, tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent)
+{
+	if (!p_node)
+		return nullptr;
+
+	const BinaryDocument& document = *p_node.m_document;
+	const uint8_t* node = p_node.m_node;
+
+	tinyxml2::XMLElement* element = p_doc.NewElement(document.GetString(Read<uint32_t>(node + 1)));
+	p_parent->InsertEndChild(element);
+
+	const uint32_t attributeCount = Read<uint32_t>(node + 1 + sizeof(uint32_t));
+	const uint8_t* attributes = GetAttributes(node);
+
+	for (uint32_t i = 0; i < attributeCount; ++i)
+	{
+		element->SetAttribute(
+			document.GetString(Read<uint32_t>(attributes + i * 2 * sizeof(uint32_t))),
+			document.GetString(Read<uint32_t>(attributes + (i * 2 + 1) * sizeof(uint32_t)))
+		);
+	}
+
+	const uint8_t* childrenEnd = GetChildrenEnd(node);
+
+	for (const uint8_t* child = GetChildrenBegin(node); child < childrenEnd; child = GetNextNode(child))
+	{
+		if (static_cast<ENodeType>(*child) == ENodeType::ELEMENT)
+			ToXML(BinaryNode(&document, child, childrenEnd), p_doc, element);
+		else
+			document.InsertNode(child, p_doc, element);
+	}
+
+	return element;
+}
+
+const char* OvCore::Helpers::BinaryDocument::GetString(uint32_t p_index) const
+{
+	return m_strings[p_index];
+}
+
+bool OvCore::Helpers::BinaryDocument::FindString(std::string_view p_string, uint32_t& p_index) const
+{
+	if (auto found = m_stringIndices.find(p_string); found != m_stringIndices.end())
+	{
+		p_index = found->second;
+		return true;
+	}
+
+	return false;
+}
+
+bool OvCore::Helpers::BinaryDocument::FormatText(const uint8_t* p_textNode, char* p_buffer, int p_bufferSize) const
+{
+	const uint8_t* payload = p_textNode + 2;
+
+	switch (static_cast<ETextType>(p_textNode[1]))
+	{
+	case ETextType::STRING:
+		std::strncpy(p_buffer, GetString(Read<uint32_t>(payload)), p_bufferSize - 1);
+		p_buffer[p_bufferSize - 1] = '\0';
+		return true;
+	case ETextType::BOOLEAN: tinyxml2::XMLUtil::ToStr(*payload != 0, p_buffer, p_bufferSize); return true;
+	case ETextType::INT64: tinyxml2::XMLUtil::ToStr(Read<int64_t>(payload), p_buffer, p_bufferSize); return true;
+	case ETextType::FLOAT: tinyxml2::XMLUtil::ToStr(Read<float>(payload), p_buffer, p_bufferSize); return true;
+	case ETextType::DOUBLE: tinyxml2::XMLUtil::ToStr(Read<double>(payload), p_buffer, p_bufferSize); return true;
+	}
+
+	return false;
+}
+
+void OvCore::Helpers::BinaryDocument::InsertNode(const uint8_t* p_node, tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent) const
+{
+	const uint8_t* value = p_node + 1;
+
+	switch (static_cast<ENodeType>(*p_node))
+	{
+	case ENodeType::TEXT:
+		if (static_cast<ETextType>(p_node[1]) == ETextType::STRING)
+		{
+			p_parent->InsertEndChild(p_doc.NewText(GetString(Read<uint32_t>(p_node + 2))));
+		}
+		else
+		{
+			char buffer[kTextBufferSize];
+			FormatText(p_node, buffer, kTextBufferSize);
+			p_parent->InsertEndChild(p_doc.NewText(buffer));
+		}
+		break;
+	case ENodeType::COMMENT: p_parent->InsertEndChild(p_doc.NewComment(GetString(Read<uint32_t>(value)))); break;
+	case ENodeType::DECLARATION: p_parent->InsertEndChild(p_doc.NewDeclaration(GetString(Read<uint32_t>(value)))); break;
+	case ENodeType::UNKNOWN: p_parent->InsertEndChild(p_doc.NewUnknown(GetString(Read<uint32_t>(value)))); break;
+	default: break;
+	}
+}
+
+std::vector<uint8_t> OvCore::Helpers::BinaryDocument::FromXML(const tinyxml2::XMLDocument& p_doc)
+{
+	ZoneScoped;
+
+	BinaryWriter writer;
+
+	for (const tinyxml2::XMLNode* node = p_doc.FirstChild(); node; node = node->NextSibling())
+		writer.WriteNode(*node);
+
+	return writer.Finalize();
+}
+
+bool OvCore::Helpers::BinaryDocument::SaveFile(const tinyxml2::XMLDocument& p_doc, const std::string& p_filePath)
+{
+	const std::vector<uint8_t> data = FromXML(p_doc);
+
+	std::ofstream file(p_filePath, std::ios::binary | std::ios::trunc);
+
+	if (!file)
+		return false;
+
+	file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+	return file.good();
+}
+
+bool OvCore::Helpers::BinaryDocument::IsBinary(std::span<const uint8_t> p_data)
+{
+	return p_data.size() >= sizeof(kMagic) && std::memcmp(p_data.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+bool OvCore::Helpers::BinaryDocument::IsBinaryFile(const std::string& p_filePath)
+{
+	std::ifstream file(p_filePath, std::ios::binary);
+
+	uint8_t magic[sizeof(kMagic)];
+
+	if (!file.read(reinterpret_cast<char*>(magic), sizeof(magic)))
+		return false;
+
+	return IsBinary(magic);
+}
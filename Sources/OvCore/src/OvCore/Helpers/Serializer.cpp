@@ -12,6 +12,7 @@
 #include <OvCore/ResourceManagement/MaterialManager.h>
 #include <OvCore/ResourceManagement/SoundManager.h>
 #include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvCore/Helpers/Serializer.h>
 
 void OvCore::Helpers::Serializer::SerializeBoolean(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node, const std::string & p_name, bool p_value)
@@ -502,3 +503,435 @@ OvAudio::Resources::Sound* OvCore::Helpers::Serializer::DeserializeSound(tinyxml
 	DeserializeSound(p_doc, p_node, p_name, result);
 	return result;
 }
+
+void OvCore::Helpers::Serializer::SerializeBoolean(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, bool p_value)
+{
+	p_writer.BeginElement(p_name);
+	p_writer.WriteBoolText(p_value);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeString(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, const std::string& p_value)
+{
+	p_writer.BeginElement(p_name);
+	p_writer.WriteText(p_value.c_str());
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeFloat(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, float p_value)
+{
+	p_writer.BeginElement(p_name);
+	p_writer.WriteFloatText(p_value);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeDouble(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, double p_value)
+{
+	p_writer.BeginElement(p_name);
+	p_writer.WriteDoubleText(p_value);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeInt(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, int p_value)
+{
+	p_writer.BeginElement(p_name);
+	p_writer.WriteInt64Text(p_value);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeUint32(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, uint32_t p_value)
+{
+	p_writer.BeginElement(p_name);
+	p_writer.WriteInt64Text(p_value);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeInt64(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, int64_t p_value)
+{
+	p_writer.BeginElement(p_name);
+	p_writer.WriteInt64Text(p_value);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeVec2(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FVector2& p_value)
+{
+	p_writer.BeginElement(p_name);
+	SerializeFloat(p_writer, "x", p_value.x);
+	SerializeFloat(p_writer, "y", p_value.y);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeVec3(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FVector3& p_value)
+{
+	p_writer.BeginElement(p_name);
+	SerializeFloat(p_writer, "x", p_value.x);
+	SerializeFloat(p_writer, "y", p_value.y);
+	SerializeFloat(p_writer, "z", p_value.z);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeVec4(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FVector4& p_value)
+{
+	p_writer.BeginElement(p_name);
+	SerializeFloat(p_writer, "x", p_value.x);
+	SerializeFloat(p_writer, "y", p_value.y);
+	SerializeFloat(p_writer, "z", p_value.z);
+	SerializeFloat(p_writer, "w", p_value.w);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeMat4(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FMatrix4& p_value)
+{
+	p_writer.BeginElement(p_name);
+
+	for (uint32_t i = 0; i < 16; ++i)
+		SerializeFloat(p_writer, "d" + std::to_string(i), p_value.data[i]);
+
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeQuat(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, const OvMaths::FQuaternion& p_value)
+{
+	p_writer.BeginElement(p_name);
+	SerializeFloat(p_writer, "x", p_value.x);
+	SerializeFloat(p_writer, "y", p_value.y);
+	SerializeFloat(p_writer, "z", p_value.z);
+	SerializeFloat(p_writer, "w", p_value.w);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeColor(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, const OvUI::Types::Color& p_value)
+{
+	p_writer.BeginElement(p_name);
+	SerializeFloat(p_writer, "r", p_value.r);
+	SerializeFloat(p_writer, "g", p_value.g);
+	SerializeFloat(p_writer, "b", p_value.b);
+	SerializeFloat(p_writer, "a", p_value.a);
+	p_writer.EndElement();
+}
+
+void OvCore::Helpers::Serializer::SerializeModel(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, OvRendering::Resources::Model* p_value)
+{
+	SerializeString(p_writer, p_name, p_value ? p_value->path : "?");
+}
+
+void OvCore::Helpers::Serializer::SerializeTexture(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, OvRendering::Resources::Texture* p_value)
+{
+	SerializeString(p_writer, p_name, p_value ? p_value->path : "?");
+}
+
+void OvCore::Helpers::Serializer::SerializeShader(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, OvRendering::Resources::Shader* p_value)
+{
+	SerializeString(p_writer, p_name, p_value ? p_value->path : "?");
+}
+
+void OvCore::Helpers::Serializer::SerializeMaterial(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, OvCore::Resources::Material* p_value)
+{
+	SerializeString(p_writer, p_name, p_value ? p_value->path : "?");
+}
+
+void OvCore::Helpers::Serializer::SerializeSound(OvCore::Helpers::BinaryWriter& p_writer, const std::string& p_name, OvAudio::Resources::Sound* p_value)
+{
+	SerializeString(p_writer, p_name, p_value ? p_value->path : "?");
+}
+
+void OvCore::Helpers::Serializer::DeserializeBoolean(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, bool& p_out)
+{
+	if (auto element = p_node.FirstChildElement(p_name); element)
+		element.QueryBoolText(p_out);
+}
+
+void OvCore::Helpers::Serializer::DeserializeString(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, std::string& p_out)
+{
+	if (auto element = p_node.FirstChildElement(p_name); element && !element.QueryStringText(p_out))
+		p_out = "";
+}
+
+void OvCore::Helpers::Serializer::DeserializeFloat(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, float& p_out)
+{
+	if (auto element = p_node.FirstChildElement(p_name); element)
+		element.QueryFloatText(p_out);
+}
+
+void OvCore::Helpers::Serializer::DeserializeDouble(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, double& p_out)
+{
+	if (auto element = p_node.FirstChildElement(p_name); element)
+		element.QueryDoubleText(p_out);
+}
+
+void OvCore::Helpers::Serializer::DeserializeInt(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, int& p_out)
+{
+	if (auto element = p_node.FirstChildElement(p_name); element)
+		element.QueryIntText(p_out);
+}
+
+void OvCore::Helpers::Serializer::DeserializeUint32(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, uint32_t& p_out)
+{
+	if (auto element = p_node.FirstChildElement(p_name); element)
+		element.QueryUnsignedText(p_out);
+}
+
+void OvCore::Helpers::Serializer::DeserializeInt64(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, int64_t& p_out)
+{
+	if (auto element = p_node.FirstChildElement(p_name); element)
+		element.QueryInt64Text(p_out);
+}
+
+void OvCore::Helpers::Serializer::DeserializeVec2(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvMaths::FVector2& p_out)
+{
+	if (auto node = p_node.FirstChildElement(p_name); node)
+	{
+		if (auto element = node.FirstChildElement("x"); element)
+			element.QueryFloatText(p_out.x);
+
+		if (auto element = node.FirstChildElement("y"); element)
+			element.QueryFloatText(p_out.y);
+	}
+}
+
+void OvCore::Helpers::Serializer::DeserializeVec3(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvMaths::FVector3& p_out)
+{
+	if (auto node = p_node.FirstChildElement(p_name); node)
+	{
+		if (auto element = node.FirstChildElement("x"); element)
+			element.QueryFloatText(p_out.x);
+
+		if (auto element = node.FirstChildElement("y"); element)
+			element.QueryFloatText(p_out.y);
+
+		if (auto element = node.FirstChildElement("z"); element)
+			element.QueryFloatText(p_out.z);
+	}
+}
+
+void OvCore::Helpers::Serializer::DeserializeVec4(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvMaths::FVector4& p_out)
+{
+	if (auto node = p_node.FirstChildElement(p_name); node)
+	{
+		if (auto element = node.FirstChildElement("x"); element)
+			element.QueryFloatText(p_out.x);
+
+		if (auto element = node.FirstChildElement("y"); element)
+			element.QueryFloatText(p_out.y);
+
+		if (auto element = node.FirstChildElement("z"); element)
+			element.QueryFloatText(p_out.z);
+
+		if (auto element = node.FirstChildElement("w"); element)
+			element.QueryFloatText(p_out.w);
+	}
+}
+
+void OvCore::Helpers::Serializer::DeserializeMat4(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvMaths::FMatrix4& p_out)
+{
+	if (auto node = p_node.FirstChildElement(p_name); node)
+	{
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			if (auto element = node.FirstChildElement("d" + std::to_string(i)); element)
+				element.QueryFloatText(p_out.data[i]);
+		}
+	}
+}
+
+void OvCore::Helpers::Serializer::DeserializeQuat(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvMaths::FQuaternion& p_out)
+{
+	if (auto node = p_node.FirstChildElement(p_name); node)
+	{
+		if (auto element = node.FirstChildElement("x"); element)
+			element.QueryFloatText(p_out.x);
+
+		if (auto element = node.FirstChildElement("y"); element)
+			element.QueryFloatText(p_out.y);
+
+		if (auto element = node.FirstChildElement("z"); element)
+			element.QueryFloatText(p_out.z);
+
+		if (auto element = node.FirstChildElement("w"); element)
+			element.QueryFloatText(p_out.w);
+	}
+}
+
+void OvCore::Helpers::Serializer::DeserializeColor(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvUI::Types::Color& p_out)
+{
+	if (auto node = p_node.FirstChildElement(p_name); node)
+	{
+		if (auto element = node.FirstChildElement("r"); element)
+			element.QueryFloatText(p_out.r);
+
+		if (auto element = node.FirstChildElement("g"); element)
+			element.QueryFloatText(p_out.g);
+
+		if (auto element = node.FirstChildElement("b"); element)
+			element.QueryFloatText(p_out.b);
+
+		if (auto element = node.FirstChildElement("q"); element)
+			element.QueryFloatText(p_out.a);
+	}
+}
+
+void OvCore::Helpers::Serializer::DeserializeModel(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvRendering::Resources::Model*& p_out)
+{
+	if (std::string path = DeserializeString(p_node, p_name); path != "?" && path != "")
+		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>().GetResource(path);
+	else
+		p_out = nullptr;
+}
+
+void OvCore::Helpers::Serializer::DeserializeTexture(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvRendering::Resources::Texture*& p_out)
+{
+	if (std::string path = DeserializeString(p_node, p_name); path != "?" && path != "")
+		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::TextureManager>().GetResource(path);
+	else
+		p_out = nullptr;
+}
+
+void OvCore::Helpers::Serializer::DeserializeShader(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvRendering::Resources::Shader*& p_out)
+{
+	if (std::string path = DeserializeString(p_node, p_name); path != "?" && path != "")
+		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ShaderManager>().GetResource(path);
+	else
+		p_out = nullptr;
+}
+
+void OvCore::Helpers::Serializer::DeserializeMaterial(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvCore::Resources::Material*& p_out)
+{
+	if (std::string path = DeserializeString(p_node, p_name); path != "?" && path != "")
+		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::MaterialManager>().GetResource(path);
+	else
+		p_out = nullptr;
+}
+
+void OvCore::Helpers::Serializer::DeserializeSound(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name, OvAudio::Resources::Sound*& p_out)
+{
+	if (std::string path = DeserializeString(p_node, p_name); path != "?" && path != "")
+		p_out = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::SoundManager>().GetResource(path);
+	else
+		p_out = nullptr;
+}
+
+bool OvCore::Helpers::Serializer::DeserializeBoolean(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	bool result;
+	DeserializeBoolean(p_node, p_name, result);
+	return result;
+}
+
+std::string OvCore::Helpers::Serializer::DeserializeString(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	std::string result;
+	DeserializeString(p_node, p_name, result);
+	return result;
+}
+
+float OvCore::Helpers::Serializer::DeserializeFloat(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	float result;
+	DeserializeFloat(p_node, p_name, result);
+	return result;
+}
+
+double OvCore::Helpers::Serializer::DeserializeDouble(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	double result;
+	DeserializeDouble(p_node, p_name, result);
+	return result;
+}
+
+int OvCore::Helpers::Serializer::DeserializeInt(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	int result;
+	DeserializeInt(p_node, p_name, result);
+	return result;
+}
+
+uint32_t OvCore::Helpers::Serializer::DeserializeUint32(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	uint32_t result;
+	DeserializeUint32(p_node, p_name, result);
+	return result;
+}
+
+int64_t OvCore::Helpers::Serializer::DeserializeInt64(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	int64_t result;
+	DeserializeInt64(p_node, p_name, result);
+	return result;
+}
+
+OvMaths::FVector2 OvCore::Helpers::Serializer::DeserializeVec2(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvMaths::FVector2 result;
+	DeserializeVec2(p_node, p_name, result);
+	return result;
+}
+
+OvMaths::FVector3 OvCore::Helpers::Serializer::DeserializeVec3(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvMaths::FVector3 result;
+	DeserializeVec3(p_node, p_name, result);
+	return result;
+}
+
+OvMaths::FVector4 OvCore::Helpers::Serializer::DeserializeVec4(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvMaths::FVector4 result;
+	DeserializeVec4(p_node, p_name, result);
+	return result;
+}
+
+OvMaths::FMatrix4 OvCore::Helpers::Serializer::DeserializeMat4(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvMaths::FMatrix4 result;
+	DeserializeMat4(p_node, p_name, result);
+	return result;
+}
+
+OvMaths::FQuaternion OvCore::Helpers::Serializer::DeserializeQuat(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvMaths::FQuaternion result;
+	DeserializeQuat(p_node, p_name, result);
+	return result;
+}
+
+OvUI::Types::Color OvCore::Helpers::Serializer::DeserializeColor(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvUI::Types::Color result;
+	DeserializeColor(p_node, p_name, result);
+	return result;
+}
+
+OvRendering::Resources::Model* OvCore::Helpers::Serializer::DeserializeModel(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvRendering::Resources::Model* result = nullptr;
+	DeserializeModel(p_node, p_name, result);
+	return result;
+}
+
+OvRendering::Resources::Texture* OvCore::Helpers::Serializer::DeserializeTexture(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvRendering::Resources::Texture* result = nullptr;
+	DeserializeTexture(p_node, p_name, result);
+	return result;
+}
+
+OvRendering::Resources::Shader* OvCore::Helpers::Serializer::DeserializeShader(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvRendering::Resources::Shader* result = nullptr;
+	DeserializeShader(p_node, p_name, result);
+	return result;
+}
+
+OvCore::Resources::Material* OvCore::Helpers::Serializer::DeserializeMaterial(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvCore::Resources::Material* result = nullptr;
+	DeserializeMaterial(p_node, p_name, result);
+	return result;
+}
+
+OvAudio::Resources::Sound* OvCore::Helpers::Serializer::DeserializeSound(const OvCore::Helpers::BinaryNode& p_node, const std::string& p_name)
+{
+	OvAudio::Resources::Sound* result = nullptr;
+	DeserializeSound(p_node, p_name, result);
+	return result;
+}
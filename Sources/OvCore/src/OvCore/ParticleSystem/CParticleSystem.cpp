@@ -4,16 +4,18 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <vector>
 
 #include <tinyxml2.h>
+#include <tracy/Tracy.hpp>
 
-#include <OvRendering/Geometry/Vertex.h>
 #include <OvUI/Widgets/Buttons/Button.h>
 
 #include "OvCore/ECS/Actor.h"
 #include "OvCore/Helpers/Serializer.h"
 #include "OvCore/ParticleSystem/CParticleSystem.h"
+#include "OvCore/ParticleSystem/ParticleKernels.h"
 
 OvTools::Eventing::Event<OvCore::ECS::Components::CParticleSystem&>
 	OvCore::ECS::Components::CParticleSystem::OpenInEditorRequestEvent;
@@ -38,48 +40,53 @@ void OvCore::ECS::Components::CParticleSystem::OnAwake()
 	AComponent::OnAwake();
 }
 
-void OvCore::ECS::Components::CParticleSystem::OnUpdate(float p_deltaTime)
+void OvCore::ECS::Components::CParticleSystem::Simulate(float p_deltaTime)
 {
-	AComponent::OnUpdate(p_deltaTime);
+	ZoneScoped;
+
+	using EStream = ParticleSystem::ParticlePool::EStream;
 
 	// Emit new particles
 	if (m_emitter)
 		m_emitter->Emit(m_pool, p_deltaTime);
 
-	// Update live particles and release dead ones
-	for (auto& p : m_pool.GetSlots())
-	{
-		if (!p.active)
-			continue;
+	const uint32_t count = m_pool.GetActiveCount();
+	float* timeToLive = m_pool.GetStream(EStream::TIME_TO_LIVE);
 
-		// Apply affectors
-		for (auto& affector : m_affectors)
-			affector->Apply(p, p_deltaTime);
+	// Apply affectors, each one as a pass over the whole live range
+	for (auto& affector : m_affectors)
+		affector->Apply(m_pool, p_deltaTime);
 
-		// Integrate position
-		p.position += p.velocity * p_deltaTime;
+	// Integrate position
+	ParticleSystem::Kernels::MultiplyAdd(m_pool.GetStream(EStream::POSITION_X), m_pool.GetStream(EStream::VELOCITY_X), p_deltaTime, count);
+	ParticleSystem::Kernels::MultiplyAdd(m_pool.GetStream(EStream::POSITION_Y), m_pool.GetStream(EStream::VELOCITY_Y), p_deltaTime, count);
+	ParticleSystem::Kernels::MultiplyAdd(m_pool.GetStream(EStream::POSITION_Z), m_pool.GetStream(EStream::VELOCITY_Z), p_deltaTime, count);
 
-		// Fade alpha over lifetime (only if no ColorGradientAffector is present)
-		bool hasColorGradient = false;
-		for (auto& affector : m_affectors)
-		{
-			if (dynamic_cast<ParticleSystem::ColorGradientAffector*>(affector.get()))
-			{
-				hasColorGradient = true;
-				break;
-			}
-		}
-		if (!hasColorGradient)
-		{
-			const float lifeRatio = p.timeToLive / p.totalTimeToLive;
-			p.color.w = lifeRatio;
-		}
+	// Fade alpha over lifetime (only if no affector drives the color)
+	if (!IsFlagSet(m_affectorCapabilities, ParticleSystem::EAffectorCapabilities::COLOR))
+		ParticleSystem::Kernels::Divide(m_pool.GetStream(EStream::COLOR_A), timeToLive, m_pool.GetStream(EStream::TOTAL_TIME_TO_LIVE), count);
 
-		p.timeToLive -= p_deltaTime;
+	ParticleSystem::Kernels::Add(timeToLive, -p_deltaTime, count);
 
-		if (p.timeToLive <= 0.0f)
-			m_pool.Release(p);
+	// Release dead particles (The last live particle is moved in the released slot, so the same index is checked again)
+	for (uint32_t i = 0; i < m_pool.GetActiveCount();)
+	{
+		if (timeToLive[i] <= 0.0f)
+			m_pool.Kill(i);
+		else
+			++i;
 	}
+
+	// Pack here rather than in RebuildMesh, so it runs on the simulation threads
+	m_meshOrigin = owner.transform.GetWorldPosition();
+	m_mesh.Pack(m_pool, m_meshOrigin);
+	m_meshDirty = true;
+}
+
+void OvCore::ECS::Components::CParticleSystem::NotifyViewed(bool p_inFrustum, float p_distance)
+{
+	m_inFrustum = m_inFrustum || p_inFrustum;
+	m_viewDistance = std::min(m_viewDistance, p_distance);
 }
 
 void OvCore::ECS::Components::CParticleSystem::SetEmitter(
@@ -92,66 +99,59 @@ void OvCore::ECS::Components::CParticleSystem::AddAffector(
 	std::unique_ptr<ParticleSystem::AParticleAffector> p_affector)
 {
 	m_affectors.push_back(std::move(p_affector));
+	UpdateAffectorCapabilities();
 }
 
 void OvCore::ECS::Components::CParticleSystem::Reset()
 {
 	m_emitter = std::make_unique<ParticleSystem::PointParticleEmitter>();
 	m_affectors.clear();
+	UpdateAffectorCapabilities();
 	m_pool.Clear();
 	material = nullptr;
 }
 
-void OvCore::ECS::Components::CParticleSystem::RebuildMesh(
-	const OvMaths::FVector3& p_cameraRight,
-	const OvMaths::FVector3& p_cameraUp)
+void OvCore::ECS::Components::CParticleSystem::Restart()
 {
-	if (m_pool.GetActiveCount() == 0)
-		return;
+	if (m_emitter)
+		m_emitter->Restart();
 
-	const OvMaths::FVector3 worldPos = owner.transform.GetWorldPosition();
+	m_pool.Clear();
+	m_pendingTime = 0.0f;
+	m_skippedFrames = 0;
 
-	std::vector<OvRendering::Geometry::Vertex> vertices;
-	std::vector<uint32_t> indices;
-	vertices.reserve(m_pool.GetActiveCount() * 4);
-	indices.reserve(m_pool.GetActiveCount() * 6);
+	// The mesh still holds the particles of the last simulation
+	m_meshOrigin = owner.transform.GetWorldPosition();
+	m_mesh.Pack(m_pool, m_meshOrigin);
+	m_meshDirty = true;
+}
+
+void OvCore::ECS::Components::CParticleSystem::RebuildMesh(const OvMaths::FVector3& p_viewPosition)
+{
+	const OvMaths::FVector3& origin = owner.transform.GetWorldPosition();
+
+	// The owner moved while its simulation was throttled
+	if (m_meshOrigin != origin)
+	{
+		m_meshOrigin = origin;
+		m_mesh.Pack(m_pool, m_meshOrigin);
+		m_meshDirty = true;
+	}
 
-	for (const auto& p : m_pool.GetSlots())
+	// New particles or another camera, the order of the last sort is used as a starting point
+	if (material && material->IsBlendable() && (m_meshDirty || m_sortViewPosition != p_viewPosition))
 	{
-		if (!p.active)
-			continue;
-
-		const OvMaths::FVector3 center = worldPos + p.position;
-		const float half = p.size * 0.5f;
-
-		const OvMaths::FVector3 bl = center - p_cameraRight * half - p_cameraUp * half;
-		const OvMaths::FVector3 br = center + p_cameraRight * half - p_cameraUp * half;
-		const OvMaths::FVector3 tr = center + p_cameraRight * half + p_cameraUp * half;
-		const OvMaths::FVector3 tl = center - p_cameraRight * half + p_cameraUp * half;
-
-		const uint32_t base = static_cast<uint32_t>(vertices.size());
-
-		auto makeVertex = [](const OvMaths::FVector3& pos, const OvMaths::FVector4& color, float u, float v) -> OvRendering::Geometry::Vertex {
-			OvRendering::Geometry::Vertex vert{};
-			vert.position[0] = pos.x; vert.position[1] = pos.y; vert.position[2] = pos.z;
-			vert.color[0] = color.x;  vert.color[1] = color.y;
-			vert.color[2] = color.z;  vert.color[3] = color.w;
-			vert.texCoords[0] = u;    vert.texCoords[1] = v;
-			return vert;
-		};
-
-		vertices.push_back(makeVertex(bl, p.color, p.lb_uv.x, p.lb_uv.y));
-		vertices.push_back(makeVertex(br, p.color, p.rt_uv.x, p.lb_uv.y));
-		vertices.push_back(makeVertex(tr, p.color, p.rt_uv.x, p.rt_uv.y));
-		vertices.push_back(makeVertex(tl, p.color, p.lb_uv.x, p.rt_uv.y));
-
-		indices.insert(indices.end(), {
-			base, base + 1, base + 2,
-			base, base + 2, base + 3
-		});
+		ZoneScopedN("Sort Particles");
+
+		m_meshDirty = m_mesh.Sort(p_viewPosition) || m_meshDirty;
+		m_sortViewPosition = p_viewPosition;
 	}
 
-	m_mesh.Update(vertices, indices);
+	if (m_meshDirty)
+	{
+		m_mesh.Upload();
+		m_meshDirty = false;
+	}
 }
 
 OvCore::ParticleSystem::ParticleMesh& OvCore::ECS::Components::CParticleSystem::GetMesh()
@@ -281,10 +281,20 @@ void OvCore::ECS::Components::CParticleSystem::OnDeserialize(
 		}
 	}
 
+	UpdateAffectorCapabilities();
+
 	// Material
 	Helpers::Serializer::DeserializeMaterial(p_doc, p_node, "material", material);
 }
 
+void OvCore::ECS::Components::CParticleSystem::UpdateAffectorCapabilities()
+{
+	m_affectorCapabilities = ParticleSystem::EAffectorCapabilities::NONE;
+
+	for (auto& affector : m_affectors)
+		m_affectorCapabilities |= affector->GetCapabilities();
+}
+
 OvCore::ParticleSystem::AParticleEmitter* OvCore::ECS::Components::CParticleSystem::GetEmitter()
 {
 	return m_emitter.get();
@@ -0,0 +1,226 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <array>
+#include <utility>
+
+#include "OvCore/ParticleSystem/ParticleKernels.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define OV_PARTICLE_KERNELS_SSE
+#endif
+
+namespace
+{
+	// The insertion sort is only tried when at most 1 entry out of 32 is smaller than its predecessor,
+	// and gives up once the entries moved by 2 slots on average (Ex: many particles released and spawned)
+	constexpr size_t kMaxDescentRatio = 32;
+	constexpr uint64_t kMaxInsertionMovesPerEntry = 2;
+
+	constexpr uint32_t kRadixBits = 11;
+	constexpr uint32_t kRadixSize = 1 << kRadixBits;
+	constexpr uint32_t kRadixPasses = (32 + kRadixBits - 1) / kRadixBits;
+
+	/**
+	* Gradient coefficients: the age ratio is mapped to the first segment parameter with
+	* t1 = ratio * firstScale, and to the second one with t2 = ratio * secondScale + secondOffset
+	*/
+	struct GradientCoefficients
+	{
+		float firstScale;
+		float secondScale;
+		float secondOffset;
+	};
+
+	GradientCoefficients ComputeGradientCoefficients(float p_midTime)
+	{
+		GradientCoefficients result;
+		result.firstScale = p_midTime > 0.0f ? 1.0f / p_midTime : 0.0f;
+
+		if (p_midTime < 1.0f)
+		{
+			result.secondScale = 1.0f / (1.0f - p_midTime);
+			result.secondOffset = -p_midTime * result.secondScale;
+		}
+		else
+		{
+			result.secondScale = 0.0f;
+			result.secondOffset = 1.0f;
+		}
+
+		return result;
+	}
+
+	/**
+	* Sort the entries in place, unless more than p_maxMoves moves are needed.
+	* Returns false if the sort was interrupted (The entries are then partially sorted)
+	*/
+	bool InsertionSort(std::vector<OvCore::ParticleSystem::Kernels::SortEntry>& p_entries, uint64_t p_maxMoves)
+	{
+		uint64_t moves = 0;
+
+		for (size_t i = 1; i < p_entries.size(); ++i)
+		{
+			const auto entry = p_entries[i];
+			size_t j = i;
+
+			for (; j > 0 && p_entries[j - 1].key > entry.key; --j)
+				p_entries[j] = p_entries[j - 1];
+
+			p_entries[j] = entry;
+			moves += i - j;
+
+			if (moves > p_maxMoves)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	* Least significant digit first, each pass is stable so the final order is sorted on the whole key.
+	* Histograms of every pass are built with a single read, and passes where every key has the same digit are skipped
+	*/
+	void RadixSort(std::vector<OvCore::ParticleSystem::Kernels::SortEntry>& p_entries, std::vector<OvCore::ParticleSystem::Kernels::SortEntry>& p_scratch)
+	{
+		std::array<std::array<uint32_t, kRadixSize>, kRadixPasses> offsets{};
+
+		for (const auto& entry : p_entries)
+		{
+			for (uint32_t pass = 0; pass < kRadixPasses; ++pass)
+				++offsets[pass][(entry.key >> (pass * kRadixBits)) & (kRadixSize - 1)];
+		}
+
+		p_scratch.resize(p_entries.size());
+
+		auto* source = &p_entries;
+		auto* destination = &p_scratch;
+
+		for (uint32_t pass = 0; pass < kRadixPasses; ++pass)
+		{
+			const uint32_t shift = pass * kRadixBits;
+			auto& passOffsets = offsets[pass];
+
+			if (passOffsets[(source->front().key >> shift) & (kRadixSize - 1)] == source->size())
+				continue;
+
+			uint32_t total = 0;
+			for (auto& offset : passOffsets)
+			{
+				const uint32_t bucketSize = offset;
+				offset = total;
+				total += bucketSize;
+			}
+
+			for (const auto& entry : *source)
+				(*destination)[passOffsets[(entry.key >> shift) & (kRadixSize - 1)]++] = entry;
+
+			std::swap(source, destination);
+		}
+
+		// The result is in the scratch buffer after an odd number of passes
+		if (source != &p_entries)
+			p_entries.swap(p_scratch);
+	}
+}
+
+void OvCore::ParticleSystem::Kernels::Add(float* p_dst, float p_value, uint32_t p_count)
+{
+	uint32_t i = 0;
+
+#ifdef OV_PARTICLE_KERNELS_SSE
+	const __m128 value = _mm_set1_ps(p_value);
+	for (; i + 4 <= p_count; i += 4)
+		_mm_storeu_ps(p_dst + i, _mm_add_ps(_mm_loadu_ps(p_dst + i), value));
+#endif
+
+	for (; i < p_count; ++i)
+		p_dst[i] += p_value;
+}
+
+void OvCore::ParticleSystem::Kernels::MultiplyAdd(float* p_dst, const float* p_src, float p_scale, uint32_t p_count)
+{
+	uint32_t i = 0;
+
+#ifdef OV_PARTICLE_KERNELS_SSE
+	const __m128 scale = _mm_set1_ps(p_scale);
+	for (; i + 4 <= p_count; i += 4)
+		_mm_storeu_ps(p_dst + i, _mm_add_ps(_mm_loadu_ps(p_dst + i), _mm_mul_ps(_mm_loadu_ps(p_src + i), scale)));
+#endif
+
+	for (; i < p_count; ++i)
+		p_dst[i] += p_src[i] * p_scale;
+}
+
+void OvCore::ParticleSystem::Kernels::Divide(float* p_dst, const float* p_numerator, const float* p_denominator, uint32_t p_count)
+{
+	uint32_t i = 0;
+
+#ifdef OV_PARTICLE_KERNELS_SSE
+	for (; i + 4 <= p_count; i += 4)
+		_mm_storeu_ps(p_dst + i, _mm_div_ps(_mm_loadu_ps(p_numerator + i), _mm_loadu_ps(p_denominator + i)));
+#endif
+
+	for (; i < p_count; ++i)
+		p_dst[i] = p_numerator[i] / p_denominator[i];
+}
+
+void OvCore::ParticleSystem::Kernels::Gradient(float* p_dst, const float* p_timeToLive, const float* p_totalTimeToLive, float p_start, float p_mid, float p_end, float p_midTime, uint32_t p_count)
+{
+	const GradientCoefficients coefficients = ComputeGradientCoefficients(p_midTime);
+	const float firstRange = p_mid - p_start;
+	const float secondRange = p_end - p_mid;
+
+	uint32_t i = 0;
+
+#ifdef OV_PARTICLE_KERNELS_SSE
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 midTime = _mm_set1_ps(p_midTime);
+	const __m128 firstScale = _mm_set1_ps(coefficients.firstScale);
+	const __m128 secondScale = _mm_set1_ps(coefficients.secondScale);
+	const __m128 secondOffset = _mm_set1_ps(coefficients.secondOffset);
+	const __m128 start = _mm_set1_ps(p_start);
+	const __m128 mid = _mm_set1_ps(p_mid);
+	const __m128 first = _mm_set1_ps(firstRange);
+	const __m128 second = _mm_set1_ps(secondRange);
+
+	for (; i + 4 <= p_count; i += 4)
+	{
+		const __m128 ratio = _mm_sub_ps(one, _mm_div_ps(_mm_loadu_ps(p_timeToLive + i), _mm_loadu_ps(p_totalTimeToLive + i)));
+		const __m128 firstValue = _mm_add_ps(start, _mm_mul_ps(first, _mm_mul_ps(ratio, firstScale)));
+		const __m128 secondValue = _mm_add_ps(mid, _mm_mul_ps(second, _mm_add_ps(_mm_mul_ps(ratio, secondScale), secondOffset)));
+		const __m128 isFirst = _mm_cmplt_ps(ratio, midTime);
+		_mm_storeu_ps(p_dst + i, _mm_or_ps(_mm_and_ps(isFirst, firstValue), _mm_andnot_ps(isFirst, secondValue)));
+	}
+#endif
+
+	for (; i < p_count; ++i)
+	{
+		const float ratio = 1.0f - p_timeToLive[i] / p_totalTimeToLive[i];
+
+		p_dst[i] = ratio < p_midTime ?
+			p_start + firstRange * (ratio * coefficients.firstScale) :
+			p_mid + secondRange * (ratio * coefficients.secondScale + coefficients.secondOffset);
+	}
+}
+
+bool OvCore::ParticleSystem::Kernels::SortIncremental(std::vector<SortEntry>& p_entries, std::vector<SortEntry>& p_scratch)
+{
+	const size_t count = p_entries.size();
+
+	size_t descents = 0;
+	for (size_t i = 1; i < count; ++i)
+		descents += p_entries[i - 1].key > p_entries[i].key;
+
+	if (descents == 0)
+		return false;
+
+	if (descents * kMaxDescentRatio > count || !InsertionSort(p_entries, count * kMaxInsertionMovesPerEntry))
+		RadixSort(p_entries, p_scratch);
+
+	return true;
+}
@@ -4,78 +4,252 @@
 * @licence: MIT
 */
 
-#include <array>
+#include <algorithm>
+#include <bit>
+#include <numbers>
+#include <cmath>
 
 #include <OvMaths/FVector3.h>
+#include <OvMaths/FVector4.h>
 #include <OvRendering/Settings/EAccessSpecifier.h>
-#include <OvRendering/Settings/EDataType.h>
 #include <OvRendering/Settings/VertexAttribute.h>
 
 #include "OvCore/ParticleSystem/ParticleMesh.h"
 
+namespace
+{
+	constexpr uint32_t kVerticesPerQuad = 4;
+	constexpr uint32_t kIndicesPerQuad = 6;
+
+	uint32_t PackUnorm(float p_value, float p_scale)
+	{
+		return static_cast<uint32_t>(std::lround(std::clamp(p_value, 0.0f, 1.0f) * p_scale));
+	}
+
+	float UnpackUnorm(uint32_t p_value, uint32_t p_mask)
+	{
+		return static_cast<float>(p_value & p_mask) / static_cast<float>(p_mask);
+	}
+
+	// Same bit layouts as GLSL packUnorm4x8 and packUnorm2x16 (First component in the lowest bits)
+	uint32_t PackUnorm4x8(float p_x, float p_y, float p_z, float p_w)
+	{
+		return PackUnorm(p_x, 255.0f) | PackUnorm(p_y, 255.0f) << 8 | PackUnorm(p_z, 255.0f) << 16 | PackUnorm(p_w, 255.0f) << 24;
+	}
+
+	uint32_t PackUnorm2x16(float p_x, float p_y)
+	{
+		return PackUnorm(p_x, 65535.0f) | PackUnorm(p_y, 65535.0f) << 16;
+	}
+}
+
 OvCore::ParticleSystem::ParticleMesh::ParticleMesh()
 {
-	// Pre-allocate small buffers; they will grow on demand in Update().
+	// Buffers are allocated on demand in Upload().
 }
 
-void OvCore::ParticleSystem::ParticleMesh::Update(
-	std::span<const OvRendering::Geometry::Vertex> p_vertices,
-	std::span<const uint32_t> p_indices
-)
+OvCore::ParticleSystem::ParticleMesh::~ParticleMesh() = default;
+
+void OvCore::ParticleSystem::ParticleMesh::Pack(const ParticlePool& p_pool, const OvMaths::FVector3& p_origin)
 {
-	m_vertexCount = static_cast<uint32_t>(p_vertices.size());
-	m_indexCount  = static_cast<uint32_t>(p_indices.size());
+	using EStream = ParticlePool::EStream;
 
-	if (m_vertexCount == 0 || m_indexCount == 0)
-		return;
+	const uint32_t count = p_pool.GetActiveCount();
 
-	const uint64_t vbSize = p_vertices.size_bytes();
-	const uint64_t ibSize = p_indices.size_bytes();
+	const float* positionX = p_pool.GetStream(EStream::POSITION_X);
+	const float* positionY = p_pool.GetStream(EStream::POSITION_Y);
+	const float* positionZ = p_pool.GetStream(EStream::POSITION_Z);
+	const float* colorR    = p_pool.GetStream(EStream::COLOR_R);
+	const float* colorG    = p_pool.GetStream(EStream::COLOR_G);
+	const float* colorB    = p_pool.GetStream(EStream::COLOR_B);
+	const float* colorA    = p_pool.GetStream(EStream::COLOR_A);
+	const float* uvLeft    = p_pool.GetStream(EStream::UV_LEFT);
+	const float* uvBottom  = p_pool.GetStream(EStream::UV_BOTTOM);
+	const float* uvRight   = p_pool.GetStream(EStream::UV_RIGHT);
+	const float* uvTop     = p_pool.GetStream(EStream::UV_TOP);
+	const float* size      = p_pool.GetStream(EStream::SIZE);
 
-	// Re-allocate only when the buffer is too small
-	if (m_vertexBuffer.GetSize() < vbSize)
-		m_vertexBuffer.Allocate(vbSize, OvRendering::Settings::EAccessSpecifier::DYNAMIC_DRAW);
+	// Bounding box of the particle centers and the origin, grown by the largest quad half-diagonal
+	OvMaths::FVector3 min = OvMaths::FVector3::Zero;
+	OvMaths::FVector3 max = OvMaths::FVector3::Zero;
+	float maxSize = 0.0f;
+
+	m_instances.resize(count);
+
+	// Keep the order of the last sort, so the next one starts from an almost sorted stream
+	if (!m_order.empty())
+		UpdateOrder(count);
+
+	for (uint32_t slot = 0; slot < count; ++slot)
+	{
+		const uint32_t i = m_order.empty() ? slot : m_order[slot];
+
+		auto& instance = m_instances[slot];
+		instance.position[0] = p_origin.x + positionX[i];
+		instance.position[1] = p_origin.y + positionY[i];
+		instance.position[2] = p_origin.z + positionZ[i];
+		instance.size        = size[i];
+		instance.color       = PackUnorm4x8(colorR[i], colorG[i], colorB[i], colorA[i]);
+		instance.uvMin       = PackUnorm2x16(uvLeft[i], uvBottom[i]);
+		instance.uvMax       = PackUnorm2x16(uvRight[i], uvTop[i]);
+		instance.padding     = 0;
+
+		min.x = std::min(min.x, positionX[i]); max.x = std::max(max.x, positionX[i]);
+		min.y = std::min(min.y, positionY[i]); max.y = std::max(max.y, positionY[i]);
+		min.z = std::min(min.z, positionZ[i]); max.z = std::max(max.z, positionZ[i]);
+		maxSize = std::max(maxSize, size[i]);
+	}
+
+	m_boundingSphere.position = p_origin + (min + max) * 0.5f;
+	m_boundingSphere.radius   = OvMaths::FVector3::Length(max - min) * 0.5f + maxSize * std::numbers::sqrt2_v<float> * 0.5f;
+}
 
-	if (m_indexBuffer.GetSize() < ibSize)
-		m_indexBuffer.Allocate(ibSize, OvRendering::Settings::EAccessSpecifier::DYNAMIC_DRAW);
+bool OvCore::ParticleSystem::ParticleMesh::Sort(const OvMaths::FVector3& p_viewPosition)
+{
+	const uint32_t count = static_cast<uint32_t>(m_instances.size());
+
+	if (count < 2)
+		return false;
+
+	// First sort, the instances are in pool order
+	if (m_order.size() != count)
+	{
+		m_order.resize(count);
+		for (uint32_t slot = 0; slot < count; ++slot)
+			m_order[slot] = slot;
+	}
 
-	m_vertexBuffer.Upload(p_vertices.data());
-	m_indexBuffer.Upload(p_indices.data());
+	// The squared distance is positive, so its bits sort like the float, and are inverted to sort back-to-front
+	m_sortEntries.resize(count);
 
-	if (!m_layoutReady)
+	for (uint32_t slot = 0; slot < count; ++slot)
 	{
-		SetupLayout();
-		m_layoutReady = true;
+		const auto& position = m_instances[slot].position;
+		const float dx = position[0] - p_viewPosition.x;
+		const float dy = position[1] - p_viewPosition.y;
+		const float dz = position[2] - p_viewPosition.z;
+
+		m_sortEntries[slot] = { ~std::bit_cast<uint32_t>(dx * dx + dy * dy + dz * dz), slot };
 	}
 
-	// Simple bounding sphere: centre at origin, radius = max distance from origin
-	m_boundingSphere.position = OvMaths::FVector3::Zero;
-	m_boundingSphere.radius   = 0.0f;
-	for (const auto& v : p_vertices)
+	if (!Kernels::SortIncremental(m_sortEntries, m_sortScratch))
+		return false;
+
+	m_sortedInstances.resize(count);
+	m_sortedOrder.resize(count);
+
+	for (uint32_t slot = 0; slot < count; ++slot)
 	{
-		const auto& pos = reinterpret_cast<const OvMaths::FVector3&>(v.position);
-		m_boundingSphere.radius = std::max(m_boundingSphere.radius, OvMaths::FVector3::Length(pos));
+		m_sortedInstances[slot] = m_instances[m_sortEntries[slot].index];
+		m_sortedOrder[slot] = m_order[m_sortEntries[slot].index];
+	}
+
+	m_instances.swap(m_sortedInstances);
+	m_order.swap(m_sortedOrder);
+
+	return true;
+}
+
+void OvCore::ParticleSystem::ParticleMesh::Upload()
+{
+	const uint32_t count = static_cast<uint32_t>(m_instances.size());
+
+	if (count == 0)
+		return;
+
+	if (!m_gpu)
+		m_gpu = std::make_unique<GPUResources>();
+
+	ReserveQuads(count);
+
+	const uint64_t instancesSize = count * sizeof(ParticleInstance);
+
+	// Re-allocate only when the buffer is too small
+	if (m_gpu->instanceBuffer.GetSize() < instancesSize)
+		m_gpu->instanceBuffer.Allocate(m_quadCapacity * sizeof(ParticleInstance), OvRendering::Settings::EAccessSpecifier::STREAM_DRAW);
+
+	m_gpu->instanceBuffer.Upload(m_instances.data(), OvRendering::HAL::BufferMemoryRange{ 0, instancesSize });
+}
+
+std::span<const OvCore::ParticleSystem::ParticleInstance> OvCore::ParticleSystem::ParticleMesh::GetInstances() const
+{
+	return m_instances;
+}
+
+void OvCore::ParticleSystem::ParticleMesh::ExpandBillboards(
+	std::span<const ParticleInstance> p_instances,
+	const OvMaths::FVector3& p_cameraRight,
+	const OvMaths::FVector3& p_cameraUp,
+	std::vector<OvRendering::Geometry::Vertex>& p_vertices,
+	std::vector<uint32_t>& p_indices
+)
+{
+	p_vertices.clear();
+	p_indices.clear();
+	p_vertices.reserve(p_instances.size() * kVerticesPerQuad);
+	p_indices.reserve(p_instances.size() * kIndicesPerQuad);
+
+	// Corner order matches the particle vertex shader: bottom-left, bottom-right, top-right, top-left
+	constexpr float kCornerX[kVerticesPerQuad] = { -0.5f, 0.5f, 0.5f, -0.5f };
+	constexpr float kCornerY[kVerticesPerQuad] = { -0.5f, -0.5f, 0.5f, 0.5f };
+
+	for (const auto& instance : p_instances)
+	{
+		const OvMaths::FVector3 center{ instance.position[0], instance.position[1], instance.position[2] };
+		const float uv[4] = {
+			UnpackUnorm(instance.uvMin, 0xFFFF), UnpackUnorm(instance.uvMin >> 16, 0xFFFF),
+			UnpackUnorm(instance.uvMax, 0xFFFF), UnpackUnorm(instance.uvMax >> 16, 0xFFFF)
+		};
+
+		const uint32_t base = static_cast<uint32_t>(p_vertices.size());
+
+		for (uint32_t corner = 0; corner < kVerticesPerQuad; ++corner)
+		{
+			const OvMaths::FVector3 position = center + p_cameraRight * (kCornerX[corner] * instance.size) + p_cameraUp * (kCornerY[corner] * instance.size);
+
+			OvRendering::Geometry::Vertex vertex{};
+			vertex.position[0] = position.x;
+			vertex.position[1] = position.y;
+			vertex.position[2] = position.z;
+			vertex.texCoords[0] = kCornerX[corner] < 0.0f ? uv[0] : uv[2];
+			vertex.texCoords[1] = kCornerY[corner] < 0.0f ? uv[1] : uv[3];
+
+			for (uint32_t channel = 0; channel < 4; ++channel)
+				vertex.color[channel] = UnpackUnorm(instance.color >> (channel * 8), 0xFF);
+
+			p_vertices.push_back(vertex);
+		}
+
+		p_indices.insert(p_indices.end(), {
+			base, base + 1, base + 2,
+			base, base + 2, base + 3
+		});
 	}
 }
 
 void OvCore::ParticleSystem::ParticleMesh::Bind() const
 {
-	m_vertexArray.Bind();
+	if (m_gpu)
+	{
+		m_gpu->vertexArray.Bind();
+		m_gpu->instanceBuffer.Bind(kInstanceBufferBinding);
+	}
 }
 
 void OvCore::ParticleSystem::ParticleMesh::Unbind() const
 {
-	m_vertexArray.Unbind();
+	if (m_gpu)
+		m_gpu->vertexArray.Unbind();
 }
 
 uint32_t OvCore::ParticleSystem::ParticleMesh::GetVertexCount() const
 {
-	return m_vertexCount;
+	return static_cast<uint32_t>(m_instances.size()) * kVerticesPerQuad;
 }
 
 uint32_t OvCore::ParticleSystem::ParticleMesh::GetIndexCount() const
 {
-	return m_indexCount;
+	return static_cast<uint32_t>(m_instances.size()) * kIndicesPerQuad;
 }
 
 const OvRendering::Geometry::BoundingSphere& OvCore::ParticleSystem::ParticleMesh::GetBoundingSphere() const
@@ -83,14 +257,50 @@ const OvRendering::Geometry::BoundingSphere& OvCore::ParticleSystem::ParticleMes
 	return m_boundingSphere;
 }
 
-void OvCore::ParticleSystem::ParticleMesh::SetupLayout()
+void OvCore::ParticleSystem::ParticleMesh::ReserveQuads(uint32_t p_quadCount)
 {
-	m_vertexArray.SetLayout(std::to_array<OvRendering::Settings::VertexAttribute>({
-		{ OvRendering::Settings::EDataType::FLOAT, 3 }, // position
-		{ OvRendering::Settings::EDataType::FLOAT, 2 }, // texCoords
-		{ OvRendering::Settings::EDataType::FLOAT, 4 }, // color (RGBA)
-		{ OvRendering::Settings::EDataType::FLOAT, 3 }, // normal
-		{ OvRendering::Settings::EDataType::FLOAT, 3 }, // tangent
-		{ OvRendering::Settings::EDataType::FLOAT, 3 }  // bitangent
-	}), m_vertexBuffer, m_indexBuffer);
+	if (p_quadCount <= m_quadCapacity)
+		return;
+
+	const bool firstAllocation = m_quadCapacity == 0;
+
+	// The index buffer only depends on the quad count, so it is only rebuilt when the capacity grows
+	m_quadCapacity = std::max(p_quadCount, m_quadCapacity * 2);
+
+	std::vector<uint32_t> indices;
+	indices.reserve(m_quadCapacity * kIndicesPerQuad);
+
+	for (uint32_t quad = 0; quad < m_quadCapacity; ++quad)
+	{
+		const uint32_t base = quad * kVerticesPerQuad;
+
+		indices.insert(indices.end(), {
+			base, base + 1, base + 2,
+			base, base + 2, base + 3
+		});
+	}
+
+	m_gpu->indexBuffer.Allocate(indices.size() * sizeof(uint32_t), OvRendering::Settings::EAccessSpecifier::STATIC_DRAW);
+	m_gpu->indexBuffer.Upload(indices.data());
+
+	if (firstAllocation)
+	{
+		// No vertex attribute: the layout only attaches the index buffer to the vertex array
+		m_gpu->vertexArray.SetLayout({}, m_gpu->vertexBuffer, m_gpu->indexBuffer);
+	}
+}
+
+void OvCore::ParticleSystem::ParticleMesh::UpdateOrder(uint32_t p_count)
+{
+	// The order always holds every index of [0, size), as the pool only releases its last slot (Swap and pop)
+	// and spawns at its end. Particles moved by a release keep the slot of the released one, the sort fixes them
+	if (m_order.size() > p_count)
+	{
+		m_order.erase(std::remove_if(m_order.begin(), m_order.end(), [p_count](uint32_t p_index) { return p_index >= p_count; }), m_order.end());
+	}
+	else
+	{
+		for (uint32_t index = static_cast<uint32_t>(m_order.size()); index < p_count; ++index)
+			m_order.push_back(index);
+	}
 }
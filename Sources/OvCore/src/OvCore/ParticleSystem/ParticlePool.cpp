@@ -4,41 +4,75 @@
 * @licence: MIT
 */
 
+#include <cstddef>
+
 #include "OvCore/ParticleSystem/ParticlePool.h"
 
+namespace
+{
+	constexpr size_t kStreamCount = static_cast<size_t>(OvCore::ParticleSystem::ParticlePool::EStream::COUNT);
+}
+
 OvCore::ParticleSystem::ParticlePool::ParticlePool(uint32_t p_capacity)
 {
 	Resize(p_capacity);
 }
 
-OvCore::ParticleSystem::ParticleSystemParticle* OvCore::ParticleSystem::ParticlePool::Acquire()
+bool OvCore::ParticleSystem::ParticlePool::Spawn(const ParticleSystemParticle& p_particle)
+{
+	if (IsFull())
+		return false;
+
+	const uint32_t idx = m_activeCount++;
+
+	GetStream(EStream::POSITION_X)[idx]         = p_particle.position.x;
+	GetStream(EStream::POSITION_Y)[idx]         = p_particle.position.y;
+	GetStream(EStream::POSITION_Z)[idx]         = p_particle.position.z;
+	GetStream(EStream::VELOCITY_X)[idx]         = p_particle.velocity.x;
+	GetStream(EStream::VELOCITY_Y)[idx]         = p_particle.velocity.y;
+	GetStream(EStream::VELOCITY_Z)[idx]         = p_particle.velocity.z;
+	GetStream(EStream::COLOR_R)[idx]            = p_particle.color.x;
+	GetStream(EStream::COLOR_G)[idx]            = p_particle.color.y;
+	GetStream(EStream::COLOR_B)[idx]            = p_particle.color.z;
+	GetStream(EStream::COLOR_A)[idx]            = p_particle.color.w;
+	GetStream(EStream::UV_LEFT)[idx]            = p_particle.lb_uv.x;
+	GetStream(EStream::UV_BOTTOM)[idx]          = p_particle.lb_uv.y;
+	GetStream(EStream::UV_RIGHT)[idx]           = p_particle.rt_uv.x;
+	GetStream(EStream::UV_TOP)[idx]             = p_particle.rt_uv.y;
+	GetStream(EStream::SIZE)[idx]               = p_particle.size;
+	GetStream(EStream::TIME_TO_LIVE)[idx]       = p_particle.timeToLive;
+	GetStream(EStream::TOTAL_TIME_TO_LIVE)[idx] = p_particle.totalTimeToLive;
+
+	return true;
+}
+
+void OvCore::ParticleSystem::ParticlePool::Kill(uint32_t p_index)
 {
-	if (m_freeList.empty())
-		return nullptr;
-
-	const uint32_t idx = m_freeList.back();
-	m_freeList.pop_back();
-	m_slots[idx].active = true;
-	++m_activeCount;
-	return &m_slots[idx];
+	const uint32_t last = --m_activeCount;
+
+	if (p_index != last)
+	{
+		for (size_t stream = 0; stream < kStreamCount; ++stream)
+		{
+			float* data = m_data.data() + stream * m_capacity;
+			data[p_index] = data[last];
+		}
+	}
 }
 
-void OvCore::ParticleSystem::ParticlePool::Release(ParticleSystemParticle& p_particle)
+float* OvCore::ParticleSystem::ParticlePool::GetStream(EStream p_stream)
 {
-	const uint32_t idx = static_cast<uint32_t>(&p_particle - m_slots.data());
-	p_particle.active = false;
-	m_freeList.push_back(idx);
-	--m_activeCount;
+	return m_data.data() + static_cast<size_t>(p_stream) * m_capacity;
 }
 
-std::vector<OvCore::ParticleSystem::ParticleSystemParticle>& OvCore::ParticleSystem::ParticlePool::GetSlots()
+const float* OvCore::ParticleSystem::ParticlePool::GetStream(EStream p_stream) const
 {
-	return m_slots;
+	return m_data.data() + static_cast<size_t>(p_stream) * m_capacity;
 }
 
-const std::vector<OvCore::ParticleSystem::ParticleSystemParticle>& OvCore::ParticleSystem::ParticlePool::GetSlots() const
+bool OvCore::ParticleSystem::ParticlePool::IsFull() const
 {
-	return m_slots;
+	return m_activeCount == m_capacity;
 }
 
 uint32_t OvCore::ParticleSystem::ParticlePool::GetActiveCount() const
@@ -48,20 +82,17 @@ uint32_t OvCore::ParticleSystem::ParticlePool::GetActiveCount() const
 
 uint32_t OvCore::ParticleSystem::ParticlePool::GetCapacity() const
 {
-	return static_cast<uint32_t>(m_slots.size());
+	return m_capacity;
 }
 
 void OvCore::ParticleSystem::ParticlePool::Resize(uint32_t p_capacity)
 {
-	m_slots.assign(p_capacity, ParticleSystemParticle{});
-	m_freeList.clear();
-	m_freeList.reserve(p_capacity);
-	for (uint32_t i = p_capacity; i-- > 0;)
-		m_freeList.push_back(i);
+	m_data.assign(kStreamCount * p_capacity, 0.0f);
+	m_capacity = p_capacity;
 	m_activeCount = 0;
 }
 
 void OvCore::ParticleSystem::ParticlePool::Clear()
 {
-	Resize(static_cast<uint32_t>(m_slots.size()));
+	m_activeCount = 0;
 }
@@ -0,0 +1,107 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include <tracy/Tracy.hpp>
+
+#include <OvTools/Utils/ThreadPool.h>
+
+#include "OvCore/ECS/Actor.h"
+#include "OvCore/ParticleSystem/CParticleSystem.h"
+#include "OvCore/ParticleSystem/ParticleSimulator.h"
+
+void OvCore::ParticleSystem::ParticleSimulator::Simulate(std::span<ECS::Components::CParticleSystem* const> p_systems, float p_deltaTime)
+{
+	ZoneScoped;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	m_statistics = {};
+	m_candidates.clear();
+	m_jobs.clear();
+
+	for (auto system : p_systems)
+	{
+		if (!system->owner.IsActive())
+			continue;
+
+		++m_statistics.systemCount;
+		m_statistics.liveParticleCount += system->GetParticleCount();
+
+		system->m_pendingTime = std::min(system->m_pendingTime + p_deltaTime, settings.maxStep);
+		++system->m_skippedFrames;
+
+		// What the cameras saw since the last frame, reset to accumulate the views of the next one
+		const bool inFrustum = system->m_inFrustum;
+		const float viewDistance = system->m_viewDistance;
+		system->m_inFrustum = false;
+		system->m_viewDistance = std::numeric_limits<float>::infinity();
+
+		const uint32_t interval =
+			!inFrustum ? settings.hiddenInterval :
+			viewDistance > settings.throttleDistance ? settings.farInterval :
+			1;
+
+		if (system->m_skippedFrames < interval)
+		{
+			++m_statistics.throttledSystemCount;
+			continue;
+		}
+
+		m_candidates.push_back({ system, system->m_pendingTime, inFrustum, viewDistance });
+	}
+
+	// Visible systems first, then the ones waiting for the longest time, then the closest ones
+	std::sort(m_candidates.begin(), m_candidates.end(), [](const Job& p_a, const Job& p_b)
+	{
+		if (p_a.inFrustum != p_b.inFrustum)
+			return p_a.inFrustum;
+
+		if (p_a.system->m_skippedFrames != p_b.system->m_skippedFrames)
+			return p_a.system->m_skippedFrames > p_b.system->m_skippedFrames;
+
+		return p_a.viewDistance < p_b.viewDistance;
+	});
+
+	// Systems over the budget keep their pending time, and get a higher priority the next frame
+	for (const auto& candidate : m_candidates)
+	{
+		const uint32_t particleCount = candidate.system->GetParticleCount();
+
+		if (settings.particleBudget > 0 && !m_jobs.empty() && m_statistics.simulatedParticleCount + particleCount > settings.particleBudget)
+		{
+			++m_statistics.deferredSystemCount;
+			continue;
+		}
+
+		m_statistics.simulatedParticleCount += particleCount;
+		candidate.system->m_pendingTime = 0.0f;
+		candidate.system->m_skippedFrames = 0;
+		m_jobs.push_back(candidate);
+	}
+
+	m_statistics.simulatedSystemCount = static_cast<uint32_t>(m_jobs.size());
+
+	OvTools::Utils::ThreadPool::GetDefault().ParallelFor(static_cast<uint32_t>(m_jobs.size()), [this](uint32_t p_index)
+	{
+		m_jobs[p_index].system->Simulate(m_jobs[p_index].deltaTime);
+	});
+
+	m_statistics.simulationTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	TracyPlot("Particles (Live)", static_cast<int64_t>(m_statistics.liveParticleCount));
+	TracyPlot("Particles (Simulated)", static_cast<int64_t>(m_statistics.simulatedParticleCount));
+	TracyPlot("Particle Systems (Simulated)", static_cast<int64_t>(m_statistics.simulatedSystemCount));
+	TracyPlot("Particle Simulation (ms)", m_statistics.simulationTime);
+}
+
+const OvCore::ParticleSystem::ParticleSimulator::Statistics& OvCore::ParticleSystem::ParticleSimulator::GetStatistics() const
+{
+	return m_statistics;
+}
@@ -4,6 +4,7 @@
 * @licence: MIT
 */
 
+#include "OvCore/ParticleSystem/ParticleKernels.h"
 #include "OvCore/ParticleSystem/ParticleSystemAffector.h"
 
 OvCore::ParticleSystem::GravityAffector::GravityAffector(float p_gravity) :
@@ -11,9 +12,14 @@ OvCore::ParticleSystem::GravityAffector::GravityAffector(float p_gravity) :
 {
 }
 
-void OvCore::ParticleSystem::GravityAffector::Apply(ParticleSystemParticle& p_particle, float p_deltaTime)
+OvCore::ParticleSystem::EAffectorCapabilities OvCore::ParticleSystem::GravityAffector::GetCapabilities() const
 {
-	p_particle.velocity.y -= gravity * p_deltaTime;
+	return EAffectorCapabilities::VELOCITY;
+}
+
+void OvCore::ParticleSystem::GravityAffector::Apply(ParticlePool& p_pool, float p_deltaTime)
+{
+	Kernels::Add(p_pool.GetStream(ParticlePool::EStream::VELOCITY_Y), -gravity * p_deltaTime, p_pool.GetActiveCount());
 }
 
 // =============================================================================
@@ -33,22 +39,22 @@ OvCore::ParticleSystem::ColorGradientAffector::ColorGradientAffector(
 {
 }
 
-void OvCore::ParticleSystem::ColorGradientAffector::Apply(ParticleSystemParticle& p_particle, float p_deltaTime)
+OvCore::ParticleSystem::EAffectorCapabilities OvCore::ParticleSystem::ColorGradientAffector::GetCapabilities() const
+{
+	return EAffectorCapabilities::COLOR;
+}
+
+void OvCore::ParticleSystem::ColorGradientAffector::Apply(ParticlePool& p_pool, float p_deltaTime)
 {
-	// Calculate normalized lifetime (0 = birth, 1 = death)
-	const float lifeRatio = 1.0f - (p_particle.timeToLive / p_particle.totalTimeToLive);
-
-	// Interpolate color based on lifetime
-	if (lifeRatio < midTime)
-	{
-		// Interpolate between start and mid
-		const float t = midTime > 0.0f ? lifeRatio / midTime : 0.0f;
-		p_particle.color = startColor + (midColor - startColor) * t;
-	}
-	else
-	{
-		// Interpolate between mid and end
-		const float t = (midTime < 1.0f) ? (lifeRatio - midTime) / (1.0f - midTime) : 1.0f;
-		p_particle.color = midColor + (endColor - midColor) * t;
-	}
+	using EStream = ParticlePool::EStream;
+
+	const uint32_t count = p_pool.GetActiveCount();
+	const float* timeToLive = p_pool.GetStream(EStream::TIME_TO_LIVE);
+	const float* totalTimeToLive = p_pool.GetStream(EStream::TOTAL_TIME_TO_LIVE);
+
+	// Interpolate each color channel based on the normalized lifetime (0 = birth, 1 = death)
+	Kernels::Gradient(p_pool.GetStream(EStream::COLOR_R), timeToLive, totalTimeToLive, startColor.x, midColor.x, endColor.x, midTime, count);
+	Kernels::Gradient(p_pool.GetStream(EStream::COLOR_G), timeToLive, totalTimeToLive, startColor.y, midColor.y, endColor.y, midTime, count);
+	Kernels::Gradient(p_pool.GetStream(EStream::COLOR_B), timeToLive, totalTimeToLive, startColor.z, midColor.z, endColor.z, midTime, count);
+	Kernels::Gradient(p_pool.GetStream(EStream::COLOR_A), timeToLive, totalTimeToLive, startColor.w, midColor.w, endColor.w, midTime, count);
 }
@@ -5,6 +5,7 @@
 */
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <numbers>
 
@@ -13,12 +14,7 @@
 
 namespace
 {
-	float RandF()
-	{
-		static uint32_t seed = 12345u;
-		seed = seed * 1664525u + 1013904223u;
-		return static_cast<float>(static_cast<int32_t>(seed)) / static_cast<float>(0x7FFFFFFF);
-	}
+	std::atomic<uint32_t> nextSeed = 12345u;
 
 	OvMaths::FVector3 GenerateOrthonormalVector(const OvMaths::FVector3& p_direction)
 	{
@@ -39,6 +35,25 @@ namespace
 	}
 }
 
+// =============================================================================
+// AParticleEmitter
+// =============================================================================
+
+OvCore::ParticleSystem::AParticleEmitter::AParticleEmitter() :
+	m_seed(nextSeed.fetch_add(0x9E3779B9u))
+{
+}
+
+float OvCore::ParticleSystem::AParticleEmitter::RandF()
+{
+	m_seed = m_seed * 1664525u + 1013904223u;
+	return static_cast<float>(static_cast<int32_t>(m_seed)) / static_cast<float>(0x7FFFFFFF);
+}
+
+// =============================================================================
+// PointParticleEmitter
+// =============================================================================
+
 OvCore::ParticleSystem::PointParticleEmitter::PointParticleEmitter(
 	float p_emissionRate,
 	float p_lifetime,
@@ -82,12 +97,21 @@ void OvCore::ParticleSystem::PointParticleEmitter::Emit(
 
 	while (m_accumulator >= 1.0f)
 	{
-		if (auto* slot = p_pool.Acquire())
-			InitParticle(*slot);
+		if (!p_pool.IsFull())
+		{
+			ParticleSystemParticle particle;
+			InitParticle(particle);
+			p_pool.Spawn(particle);
+		}
 		m_accumulator -= 1.0f;
 	}
 }
 
+void OvCore::ParticleSystem::PointParticleEmitter::Restart()
+{
+	m_accumulator = 0.0f;
+}
+
 // =============================================================================
 // CircleParticleEmitter
 // =============================================================================
@@ -163,8 +187,17 @@ void OvCore::ParticleSystem::CircleParticleEmitter::Emit(
 
 	while (m_accumulator >= 1.0f)
 	{
-		if (auto* slot = p_pool.Acquire())
-			InitParticle(*slot);
+		if (!p_pool.IsFull())
+		{
+			ParticleSystemParticle particle;
+			InitParticle(particle);
+			p_pool.Spawn(particle);
+		}
 		m_accumulator -= 1.0f;
 	}
 }
+
+void OvCore::ParticleSystem::CircleParticleEmitter::Restart()
+{
+	m_accumulator = 0.0f;
+}
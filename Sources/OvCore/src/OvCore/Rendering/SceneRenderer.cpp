@@ -4,6 +4,7 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <cmath>
 #include <format>
 #include <optional>
@@ -140,17 +141,11 @@ void OvCore::Rendering::SceneRenderer::BeginFrame(const OvRendering::Data::Frame
 
 	OvRendering::Core::CompositeRenderer::BeginFrame(p_frameDescriptor);
 
-	const auto& viewMatrix = p_frameDescriptor.camera.value().GetViewMatrix();
-	const auto rightRow = OvMaths::FMatrix4::GetRow(viewMatrix, 0);
-	const auto upRow    = OvMaths::FMatrix4::GetRow(viewMatrix, 1);
-	const OvMaths::FVector3 cameraRight{ rightRow.x, rightRow.y, rightRow.z };
-	const OvMaths::FVector3 cameraUp   { upRow.x,    upRow.y,    upRow.z    };
-
 	AddDescriptor<SceneDrawablesDescriptor>({
 		ParseScene(SceneParsingInput{
-			.scene       = sceneDescriptor.scene,
-			.cameraRight = cameraRight,
-			.cameraUp    = cameraUp
+			.scene = sceneDescriptor.scene,
+			.camera = p_frameDescriptor.camera.value(),
+			.frustumOverride = sceneDescriptor.frustumOverride
 		})
 	});
 
@@ -417,7 +412,7 @@ void OvCore::Rendering::SceneRenderer::BuildFrameGraph(OvRendering::FrameGraph::
 
 					for (auto mesh : model->GetMeshes())
 					{
-						auto mat = mats.at(mesh->GetMaterialIndex());
+						auto mat = mesh->GetMaterialIndex() < mats.size() ? mats[mesh->GetMaterialIndex()] : nullptr;
 						if (!mat || !mat->IsValid() || !mat->IsShadowCaster()) continue;
 
 						const std::string shadowPass = "SHADOW_PASS";
@@ -863,6 +858,14 @@ SceneRenderer::SceneDrawablesDescriptor OvCore::Rendering::SceneRenderer::ParseS
 
 	SceneDrawablesDescriptor result;
 	const auto& scene = p_input.scene;
+	const auto& camera = p_input.camera;
+
+	OvTools::Utils::OptRef<const OvRendering::Data::Frustum> frustum;
+	if (camera.HasFrustumGeometryCulling())
+	{
+		frustum = p_input.frustumOverride ?
+			p_input.frustumOverride : camera.GetFrustum();
+	}
 
 	for (const auto modelRenderer : scene.GetFastAccessComponents().modelRenderers)
 	{
@@ -879,8 +882,8 @@ SceneRenderer::SceneDrawablesDescriptor OvCore::Rendering::SceneRenderer::ParseS
 		for (auto& mesh : model->GetMeshes())
 		{
 			OvTools::Utils::OptRef<OvRendering::Data::Material> material;
-			if (mesh->GetMaterialIndex() < kMaxMaterialCount)
-				material = materials.at(mesh->GetMaterialIndex());
+			if (mesh->GetMaterialIndex() < materials.size())
+				material = materials[mesh->GetMaterialIndex()];
 
 			OvRendering::Entities::Drawable drawable{
 				.mesh = *mesh,
@@ -919,9 +922,16 @@ SceneRenderer::SceneDrawablesDescriptor OvCore::Rendering::SceneRenderer::ParseS
 		auto& owner = particleSystem->owner;
 		if (!owner.IsActive()) continue;
 		if (!particleSystem->material || !particleSystem->material->IsValid()) continue;
+
+		// Bounds of the last simulation, reported even when empty so the simulator knows the system is looked at
+		const auto& bounds = particleSystem->GetMesh().GetBoundingSphere();
+		const bool inFrustum = !frustum || frustum->SphereInFrustum(bounds.position.x, bounds.position.y, bounds.position.z, bounds.radius);
+		particleSystem->NotifyViewed(inFrustum, std::max(OvMaths::FVector3::Distance(camera.GetPosition(), bounds.position) - bounds.radius, 0.0f));
+
+		if (!inFrustum) continue;
 		if (particleSystem->GetParticleCount() == 0) continue;
 
-		particleSystem->RebuildMesh(p_input.cameraRight, p_input.cameraUp);
+		particleSystem->RebuildMesh(camera.GetPosition());
 
 		OvRendering::Entities::Drawable drawable{
 			.mesh      = particleSystem->GetMesh(),
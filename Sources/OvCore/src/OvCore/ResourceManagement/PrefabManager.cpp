@@ -0,0 +1,31 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvCore/ResourceManagement/PrefabManager.h"
+
+OvCore::Resources::Prefab * OvCore::ResourceManagement::PrefabManager::CreateResource(const std::filesystem::path & p_path)
+{
+	std::string realPath = GetRealPath(p_path).string();
+
+	Resources::Prefab* prefab = OvCore::Resources::Loaders::PrefabLoader::Create(realPath);
+	if (prefab)
+	{
+		const_cast<std::string&>(prefab->path) = p_path.string(); // Force the resource path to fit the given path
+	}
+
+	return prefab;
+}
+
+void OvCore::ResourceManagement::PrefabManager::DestroyResource(OvCore::Resources::Prefab * p_resource)
+{
+	OvCore::Resources::Loaders::PrefabLoader::Destroy(p_resource);
+}
+
+void OvCore::ResourceManagement::PrefabManager::ReloadResource(OvCore::Resources::Prefab* p_resource, const std::filesystem::path& p_path)
+{
+	std::string realPath = GetRealPath(p_path).string();
+	OvCore::Resources::Loaders::PrefabLoader::Reload(*p_resource, realPath);
+}
@@ -4,12 +4,47 @@
 * @licence: MIT
 */
 
+#include <format>
+
+#include <OvTools/Filesystem/IniFile.h>
+
 #include "OvCore/ResourceManagement/SoundManager.h"
 
+namespace
+{
+	OvAudio::Settings::ESoundLoadMode LoadSoundLoadMode(const std::string_view p_filePath)
+	{
+		const auto metaFile = OvTools::Filesystem::IniFile(std::format("{}.meta", p_filePath));
+		return static_cast<OvAudio::Settings::ESoundLoadMode>(metaFile.GetOrDefault("LOAD_MODE", static_cast<int>(OvAudio::Settings::ESoundLoadMode::AUTOMATIC)));
+	}
+}
+
+OvAudio::Resources::Sound* OvCore::ResourceManagement::SoundManager::LoadResourceAsync(const std::filesystem::path& p_path)
+{
+	if (auto resource = GetResource(p_path, false); resource)
+		return resource;
+
+	std::string realPath = GetRealPath(p_path).string();
+	OvAudio::Resources::Sound* sound = OvAudio::Resources::Loaders::SoundLoader::CreateAsync(realPath, LoadSoundLoadMode(realPath));
+	const_cast<std::string&>(sound->path) = p_path.string(); // Force the resource path to fit the given path
+
+	return RegisterResource(p_path, sound);
+}
+
+size_t OvCore::ResourceManagement::SoundManager::GetMemoryUsage()
+{
+	size_t memoryUsage = 0;
+
+	for (const auto& [path, sound] : GetResources())
+		memoryUsage += sound->GetMemoryUsage();
+
+	return memoryUsage;
+}
+
 OvAudio::Resources::Sound* OvCore::ResourceManagement::SoundManager::CreateResource(const std::filesystem::path& p_path)
 {
 	std::string realPath = GetRealPath(p_path).string();
-	OvAudio::Resources::Sound* sound = OvAudio::Resources::Loaders::SoundLoader::Create(realPath);
+	OvAudio::Resources::Sound* sound = OvAudio::Resources::Loaders::SoundLoader::Create(realPath, LoadSoundLoadMode(realPath));
 	if (sound)
 	{
 		const_cast<std::string&>(sound->path) = p_path.string(); // Force the resource path to fit the given path
@@ -25,4 +60,7 @@ void OvCore::ResourceManagement::SoundManager::DestroyResource(OvAudio::Resource
 
 void OvCore::ResourceManagement::SoundManager::ReloadResource(OvAudio::Resources::Sound* p_resource, const std::filesystem::path& p_path)
 {
+	std::string realPath = GetRealPath(p_path).string();
+	OvAudio::Resources::Loaders::SoundLoader::Reload(*p_resource, realPath, LoadSoundLoadMode(realPath));
+	const_cast<std::string&>(p_resource->path) = p_path.string();
 }
@@ -0,0 +1,88 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <fstream>
+#include <iterator>
+
+#include <tinyxml2.h>
+
+#include <OvCore/Helpers/BinaryDocument.h>
+#include <OvCore/Resources/Loaders/PrefabLoader.h>
+#include <OvDebug/Logger.h>
+
+namespace
+{
+	bool ReadBlueprint(const std::string& p_path, std::vector<uint8_t>& p_out)
+	{
+		if (OvCore::Helpers::BinaryDocument::IsBinaryFile(p_path))
+		{
+			std::ifstream file(p_path, std::ios::binary);
+			p_out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			return true;
+		}
+
+		// Prefabs written by hand (Or converted) as XML are encoded once when loaded
+		tinyxml2::XMLDocument doc;
+		doc.LoadFile(p_path.c_str());
+
+		if (doc.Error())
+			return false;
+
+		p_out = OvCore::Helpers::BinaryDocument::FromXML(doc);
+		return true;
+	}
+}
+
+OvCore::Resources::Prefab* OvCore::Resources::Loaders::PrefabLoader::Create(const std::string& p_path)
+{
+	std::vector<uint8_t> data;
+
+	if (ReadBlueprint(p_path, data))
+	{
+		Prefab* prefab = new Prefab();
+
+		if (prefab->Load(std::move(data)))
+			return prefab;
+
+		delete prefab;
+	}
+
+	return nullptr;
+}
+
+void OvCore::Resources::Loaders::PrefabLoader::Reload(Prefab& p_prefab, const std::string& p_path)
+{
+	std::vector<uint8_t> data;
+
+	if (ReadBlueprint(p_path, data) && p_prefab.Load(std::move(data)))
+		OVLOG_INFO("[PREFAB] \"" + p_path + "\" Reloaded");
+}
+
+void OvCore::Resources::Loaders::PrefabLoader::Save(const Prefab& p_prefab, const std::string& p_path)
+{
+	const auto& data = p_prefab.GetData();
+
+	std::ofstream file(p_path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+	if (file)
+		OVLOG_INFO("[PREFAB] \"" + p_path + "\": Saved");
+	else
+		OVLOG_ERROR("[PREFAB] \"" + p_path + "\": Failed to save");
+}
+
+bool OvCore::Resources::Loaders::PrefabLoader::Destroy(Prefab*& p_prefab)
+{
+	if (p_prefab)
+	{
+		delete p_prefab;
+		p_prefab = nullptr;
+
+		return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,95 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <unordered_map>
+
+#include <tinyxml2.h>
+#include <tracy/Tracy.hpp>
+
+#include "OvCore/ECS/Actor.h"
+#include "OvCore/Helpers/BinaryDocument.h"
+#include "OvCore/Resources/Prefab.h"
+
+namespace
+{
+	void SerializeHierarchy(OvCore::ECS::Actor& p_actor, tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_actorsRoot)
+	{
+		p_actor.OnSerialize(p_doc, p_actorsRoot);
+
+		for (auto child : p_actor.GetChildren())
+			SerializeHierarchy(*child, p_doc, p_actorsRoot);
+	}
+}
+
+OvCore::Resources::Prefab::Prefab() = default;
+
+OvCore::Resources::Prefab::~Prefab() = default;
+
+void OvCore::Resources::Prefab::Capture(ECS::Actor& p_root)
+{
+	tinyxml2::XMLDocument doc;
+	tinyxml2::XMLNode* node = doc.NewElement("root");
+	doc.InsertFirstChild(node);
+
+	tinyxml2::XMLNode* prefabNode = doc.NewElement("prefab");
+	node->InsertEndChild(prefabNode);
+
+	tinyxml2::XMLNode* actorsNode = doc.NewElement("actors");
+	prefabNode->InsertEndChild(actorsNode);
+
+	SerializeHierarchy(p_root, doc, actorsNode);
+
+	Load(Helpers::BinaryDocument::FromXML(doc));
+}
+
+bool OvCore::Resources::Prefab::Load(std::vector<uint8_t> p_data)
+{
+	ZoneScoped;
+
+	m_data = std::move(p_data);
+	m_template.clear();
+
+	Helpers::BinaryDocument document;
+
+	if (!document.Load(m_data))
+		return false;
+
+	/* Blueprint IDs are kept by the template, they are only used to resolve its hierarchy */
+	std::unordered_map<int64_t, ECS::Actor*> actors;
+
+	const auto actorsRoot = document.FirstChildElement("root").FirstChildElement("prefab").FirstChildElement("actors");
+
+	for (auto currentActor = actorsRoot.FirstChildElement("actor"); currentActor; currentActor = currentActor.NextSiblingElement("actor"))
+	{
+		auto& actor = *m_template.emplace_back(std::make_unique<ECS::Actor>(0, "", "", m_playing, true));
+		actor.OnDeserialize(currentActor);
+		actors.emplace(actor.GetID(), &actor);
+
+		/* The parent of the captured actor isn't part of the prefab */
+		if (m_template.size() > 1)
+		{
+			if (auto parent = actors.find(actor.GetParentID()); parent != actors.end())
+				actor.SetParent(*parent->second);
+		}
+	}
+
+	return true;
+}
+
+bool OvCore::Resources::Prefab::IsEmpty() const
+{
+	return m_template.empty();
+}
+
+const std::vector<uint8_t>& OvCore::Resources::Prefab::GetData() const
+{
+	return m_data;
+}
+
+OvCore::ECS::Actor* OvCore::Resources::Prefab::GetRoot() const
+{
+	return m_template.empty() ? nullptr : m_template.front().get();
+}
@@ -14,8 +14,10 @@
 #include <OvCore/ECS/Components/CDirectionalLight.h>
 #include <OvCore/ECS/Components/CMaterialRenderer.h>
 #include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvCore/ResourceManagement/MaterialManager.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/Resources/Prefab.h>
 #include <OvCore/SceneSystem/Scene.h>
 
 OvCore::SceneSystem::Scene::Scene()
@@ -116,6 +118,13 @@ void OvCore::SceneSystem::Scene::Play()
 	std::for_each(m_actors.begin(), m_actors.end(), [](ECS::Actor * p_element) { if (p_element->IsActive()) p_element->OnStart(); });
 }
 
+void OvCore::SceneSystem::Scene::Stop()
+{
+	m_isPlaying = false;
+
+	std::for_each(m_actors.begin(), m_actors.end(), [](ECS::Actor * p_element) { p_element->Sleep(); });
+}
+
 bool OvCore::SceneSystem::Scene::IsPlaying() const
 {
 	return m_isPlaying;
@@ -124,22 +133,20 @@ bool OvCore::SceneSystem::Scene::IsPlaying() const
 void OvCore::SceneSystem::Scene::Update(float p_deltaTime)
 {
 	ZoneScoped;
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnUpdate), std::placeholders::_1, p_deltaTime));
+	DispatchUpdate(m_updateList, &ECS::Components::AComponent::OnUpdate, p_deltaTime);
+	m_particleSimulator.Simulate(m_fastAccessComponents.particleSystems, p_deltaTime);
 }
 
 void OvCore::SceneSystem::Scene::FixedUpdate(float p_deltaTime)
 {
 	ZoneScoped;
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnFixedUpdate), std::placeholders::_1, p_deltaTime));
+	DispatchUpdate(m_fixedUpdateList, &ECS::Components::AComponent::OnFixedUpdate, p_deltaTime);
 }
 
 void OvCore::SceneSystem::Scene::LateUpdate(float p_deltaTime)
 {
 	ZoneScoped;
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnLateUpdate), std::placeholders::_1, p_deltaTime));
+	DispatchUpdate(m_lateUpdateList, &ECS::Components::AComponent::OnLateUpdate, p_deltaTime);
 }
 
 OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor()
@@ -153,6 +160,9 @@ OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor(const std::string& p
 	ECS::Actor& instance = *m_actors.back();
 	instance.ComponentAddedEvent	+= std::bind(&Scene::OnComponentAdded, this, std::placeholders::_1);
 	instance.ComponentRemovedEvent	+= std::bind(&Scene::OnComponentRemoved, this, std::placeholders::_1);
+	instance.BehaviourAddedEvent	+= std::bind(&Scene::RegisterUpdateCallbacks, this, std::placeholders::_1);
+	instance.BehaviourRemovedEvent	+= [this](ECS::Components::Behaviour& p_behaviour) { UnregisterUpdateCallbacks(p_behaviour); };
+	instance.BehaviourUpdateCallbacksChangedEvent += std::bind(&Scene::OnBehaviourUpdateCallbacksChanged, this, std::placeholders::_1, std::placeholders::_2);
 	if (m_isPlaying)
 	{
 		instance.SetSleeping(false);
@@ -185,6 +195,77 @@ bool OvCore::SceneSystem::Scene::DestroyActor(ECS::Actor& p_target)
 	}
 }
 
+OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CloneActor(ECS::Actor& p_source, ECS::Actor* p_parent)
+{
+	ECS::Actor& clone = CreateActor(p_source.GetName(), p_source.GetTag());
+
+	if (!p_source.IsSelfActive())
+		clone.SetActive(false);
+
+	/* AddComponent inserts at the front, so components are visited backward to keep the same order */
+	const auto& components = p_source.GetComponents();
+	for (auto it = components.rbegin(); it != components.rend(); ++it)
+	{
+		if (auto component = clone.AddComponentFromTypeName((*it)->GetTypeName()))
+			component->CopyFrom(**it);
+	}
+
+	for (auto& [name, behaviour] : p_source.GetBehaviours())
+		clone.AddBehaviour(name).CopyFrom(behaviour);
+
+	/* The children are copied before attaching the clone, as it could be attached to the source itself (Or one of its descendants) */
+	const std::vector<ECS::Actor*> children = p_source.GetChildren();
+
+	if (p_parent)
+		clone.SetParent(*p_parent);
+	else if (auto parent = p_source.GetParent())
+		clone.SetParent(*parent);
+
+	for (auto child : children)
+		CloneActor(*child, &clone);
+
+	return clone;
+}
+
+OvCore::ECS::Actor* OvCore::SceneSystem::Scene::Instantiate(const Resources::Prefab& p_prefab, const OvMaths::FVector3& p_position, const OvMaths::FQuaternion& p_rotation)
+{
+	ZoneScoped;
+
+	auto source = p_prefab.GetRoot();
+
+	if (!source)
+		return nullptr;
+
+	/* The template is never awakened, so instances start from the prefab state, not from a live one */
+	auto& instance = CloneActor(*source);
+	instance.transform.SetLocalPosition(p_position);
+	instance.transform.SetLocalRotation(p_rotation);
+
+	return &instance;
+}
+
+std::vector<OvCore::ECS::Actor*> OvCore::SceneSystem::Scene::Instantiate(const Resources::Prefab& p_prefab, std::span<const OvMaths::FVector3> p_positions, const OvMaths::FQuaternion& p_rotation)
+{
+	ZoneScoped;
+
+	std::vector<ECS::Actor*> instances;
+
+	if (p_positions.empty())
+		return instances;
+
+	instances.reserve(p_positions.size());
+
+	for (const auto& position : p_positions)
+	{
+		if (auto instance = Instantiate(p_prefab, position, p_rotation))
+			instances.push_back(instance);
+		else
+			break;
+	}
+
+	return instances;
+}
+
 void OvCore::SceneSystem::Scene::CollectGarbages()
 {
 	m_actors.erase(std::remove_if(m_actors.begin(), m_actors.end(), [this](ECS::Actor* element)
@@ -278,6 +359,8 @@ OvCore::ECS::Components::CCamera* OvCore::SceneSystem::Scene::FindMainCamera() c
 
 void OvCore::SceneSystem::Scene::OnComponentAdded(ECS::Components::AComponent& p_compononent)
 {
+	RegisterUpdateCallbacks(p_compononent);
+
 	if (auto result = dynamic_cast<ECS::Components::CModelRenderer*>(&p_compononent))
 		m_fastAccessComponents.modelRenderers.push_back(result);
 
@@ -299,6 +382,8 @@ void OvCore::SceneSystem::Scene::OnComponentAdded(ECS::Components::AComponent& p
 
 void OvCore::SceneSystem::Scene::OnComponentRemoved(ECS::Components::AComponent& p_compononent)
 {
+	UnregisterUpdateCallbacks(p_compononent);
+
 	if (auto result = dynamic_cast<ECS::Components::CModelRenderer*>(&p_compononent))
 		m_fastAccessComponents.modelRenderers.erase(std::remove(m_fastAccessComponents.modelRenderers.begin(), m_fastAccessComponents.modelRenderers.end(), result), m_fastAccessComponents.modelRenderers.end());
 
@@ -328,6 +413,11 @@ const OvCore::SceneSystem::Scene::FastAccessComponents& OvCore::SceneSystem::Sce
 	return m_fastAccessComponents;
 }
 
+OvCore::ParticleSystem::ParticleSimulator& OvCore::SceneSystem::Scene::GetParticleSimulator()
+{
+	return m_particleSimulator;
+}
+
 void OvCore::SceneSystem::Scene::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_root)
 {
 	tinyxml2::XMLNode* sceneNode = p_doc.NewElement("scene");
@@ -362,14 +452,115 @@ void OvCore::SceneSystem::Scene::OnDeserialize(tinyxml2::XMLDocument & p_doc, ti
 
 		m_availableID = maxID;
 
-		/* We recreate the hierarchy of the scene by attaching children to their parents */
-		for (auto actor : m_actors)
+		RecreateHierarchy();
+	}
+}
+
+void OvCore::SceneSystem::Scene::OnDeserialize(const OvCore::Helpers::BinaryNode& p_root)
+{
+	ZoneScoped;
+
+	if (auto actorsRoot = p_root.FirstChildElement("actors"))
+	{
+		int64_t maxID = 1;
+
+		for (auto currentActor = actorsRoot.FirstChildElement("actor"); currentActor; currentActor = currentActor.NextSiblingElement("actor"))
+		{
+			auto& actor = CreateActor();
+			actor.OnDeserialize(currentActor);
+			maxID = std::max(actor.GetID() + 1, maxID);
+		}
+
+		m_availableID = maxID;
+
+		RecreateHierarchy();
+	}
+}
+
+void OvCore::SceneSystem::Scene::RegisterUpdateCallbacks(ECS::Components::AComponent& p_component)
+{
+	const auto callbacks = p_component.GetUpdateCallbacks();
+
+	/* Components registered during a dispatch are appended after the dispatched range, they will be updated next time */
+	if (IsFlagSet(callbacks, ECS::Components::EUpdateCallbacks::UPDATE))
+		m_updateList.components.push_back(&p_component);
+
+	if (IsFlagSet(callbacks, ECS::Components::EUpdateCallbacks::FIXED_UPDATE))
+		m_fixedUpdateList.components.push_back(&p_component);
+
+	if (IsFlagSet(callbacks, ECS::Components::EUpdateCallbacks::LATE_UPDATE))
+		m_lateUpdateList.components.push_back(&p_component);
+}
+
+void OvCore::SceneSystem::Scene::UnregisterUpdateCallbacks(ECS::Components::AComponent& p_component)
+{
+	UnregisterUpdateCallbacks(p_component, p_component.GetUpdateCallbacks());
+}
+
+void OvCore::SceneSystem::Scene::UnregisterUpdateCallbacks(ECS::Components::AComponent& p_component, ECS::Components::EUpdateCallbacks p_callbacks)
+{
+	auto unregister = [&p_component](UpdateList& p_list)
+	{
+		if (auto found = std::find(p_list.components.begin(), p_list.components.end(), &p_component); found != p_list.components.end())
 		{
-			if (actor->GetParentID() > 0)
+			if (p_list.dispatching)
+			{
+				*found = nullptr;
+				p_list.dirty = true;
+			}
+			else
 			{
-				if (auto found = FindActorByID(actor->GetParentID()); found)
-					actor->SetParent(*found);
+				p_list.components.erase(found);
 			}
 		}
+	};
+
+	if (IsFlagSet(p_callbacks, ECS::Components::EUpdateCallbacks::UPDATE))
+		unregister(m_updateList);
+
+	if (IsFlagSet(p_callbacks, ECS::Components::EUpdateCallbacks::FIXED_UPDATE))
+		unregister(m_fixedUpdateList);
+
+	if (IsFlagSet(p_callbacks, ECS::Components::EUpdateCallbacks::LATE_UPDATE))
+		unregister(m_lateUpdateList);
+}
+
+void OvCore::SceneSystem::Scene::OnBehaviourUpdateCallbacksChanged(ECS::Components::Behaviour& p_behaviour, ECS::Components::EUpdateCallbacks p_previousCallbacks)
+{
+	UnregisterUpdateCallbacks(p_behaviour, p_previousCallbacks);
+	RegisterUpdateCallbacks(p_behaviour);
+}
+
+void OvCore::SceneSystem::Scene::DispatchUpdate(UpdateList& p_list, void(ECS::Components::AComponent::*p_callback)(float), float p_deltaTime)
+{
+	p_list.dispatching = true;
+
+	/* Indexed iteration, as callbacks can register new components (Which might reallocate the list) */
+	const size_t count = p_list.components.size();
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (auto component = p_list.components[i]; component && component->owner.IsActive())
+			(component->*p_callback)(p_deltaTime);
+	}
+
+	p_list.dispatching = false;
+
+	if (p_list.dirty)
+	{
+		p_list.components.erase(std::remove(p_list.components.begin(), p_list.components.end(), nullptr), p_list.components.end());
+		p_list.dirty = false;
+	}
+}
+
+void OvCore::SceneSystem::Scene::RecreateHierarchy()
+{
+	/* We recreate the hierarchy of the scene by attaching children to their parents */
+	for (auto actor : m_actors)
+	{
+		if (actor->GetParentID() > 0)
+		{
+			if (auto found = FindActorByID(actor->GetParentID()); found)
+				actor->SetParent(*found);
+		}
 	}
 }
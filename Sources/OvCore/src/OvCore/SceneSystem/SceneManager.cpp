@@ -5,9 +5,11 @@
 */
 
 #include <tinyxml2.h>
+#include <tracy/Tracy.hpp>
 #include <OvWindowing/Dialogs/MessageBox.h>
 
 #include "OvCore/SceneSystem/SceneManager.h"
+#include "OvCore/Helpers/BinaryDocument.h"
 #include "OvCore/ECS/Components/CDirectionalLight.h"
 #include "OvCore/ECS/Components/CAmbientSphereLight.h"
 #include "OvCore/ECS/Components/CCamera.h"
@@ -63,6 +65,8 @@ void OvCore::SceneSystem::SceneManager::LoadDefaultScene()
 
 bool OvCore::SceneSystem::SceneManager::LoadScene(const std::string& p_path, bool p_absolute)
 {
+	ZoneScoped;
+
 	std::filesystem::path path = 
 		p_absolute ?
 		std::filesystem::current_path() :
@@ -70,10 +74,22 @@ bool OvCore::SceneSystem::SceneManager::LoadScene(const std::string& p_path, boo
 
 	path /= p_path;
 
-	tinyxml2::XMLDocument doc;
-	doc.LoadFile(path.string().c_str());
+	bool loaded = false;
 
-	if (LoadSceneFromMemory(doc))
+	if (OvCore::Helpers::BinaryDocument::IsBinaryFile(path.string()))
+	{
+		OvCore::Helpers::BinaryDocument doc;
+		doc.LoadFile(path.string());
+		loaded = LoadSceneFromMemory(doc);
+	}
+	else
+	{
+		tinyxml2::XMLDocument doc;
+		doc.LoadFile(path.string().c_str());
+		loaded = LoadSceneFromMemory(doc);
+	}
+
+	if (loaded)
 	{
 		StoreCurrentSceneSourcePath(path.string());
 		return true;
@@ -103,6 +119,22 @@ bool OvCore::SceneSystem::SceneManager::LoadSceneFromMemory(tinyxml2::XMLDocumen
 	return false;
 }
 
+bool OvCore::SceneSystem::SceneManager::LoadSceneFromMemory(const OvCore::Helpers::BinaryDocument& p_doc)
+{
+	if (!p_doc.Error())
+	{
+		if (auto sceneNode = p_doc.FirstChildElement().FirstChildElement("scene"))
+		{
+			LoadEmptyScene();
+			m_currentScene->OnDeserialize(sceneNode);
+			return true;
+		}
+	}
+
+	OvWindowing::Dialogs::MessageBox message("Scene loading failed", "The scene you are trying to load was not found or corrupted", OvWindowing::Dialogs::MessageBox::EMessageType::ERROR, OvWindowing::Dialogs::MessageBox::EButtonLayout::OK, true);
+	return false;
+}
+
 void OvCore::SceneSystem::SceneManager::UnloadCurrentScene()
 {
 	if (m_currentScene)
@@ -0,0 +1,226 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <tracy/Tracy.hpp>
+
+#include "OvCore/ECS/Actor.h"
+#include "OvCore/ECS/Components/CPhysicalObject.h"
+#include "OvCore/Helpers/BinaryDocument.h"
+#include "OvCore/ParticleSystem/CParticleSystem.h"
+#include "OvCore/SceneSystem/Scene.h"
+#include "OvCore/SceneSystem/SceneSnapshot.h"
+
+namespace
+{
+	std::vector<uint8_t> Encode(OvCore::API::ISerializable& p_serializable)
+	{
+		OvCore::Helpers::BinaryWriter writer;
+		writer.BeginElement("data");
+		p_serializable.OnSerialize(writer);
+		writer.EndElement();
+		return writer.Finalize();
+	}
+
+	void Decode(OvCore::API::ISerializable& p_serializable, const std::vector<uint8_t>& p_data)
+	{
+		OvCore::Helpers::BinaryDocument doc;
+
+		if (doc.Load(p_data))
+			p_serializable.OnDeserialize(doc.FirstChildElement("data"));
+	}
+
+	void DecodeIfChanged(OvCore::API::ISerializable& p_serializable, const std::vector<uint8_t>& p_data)
+	{
+		// Encoding is deterministic, so unchanged components are skipped without looking up their resources again
+		if (Encode(p_serializable) != p_data)
+			Decode(p_serializable, p_data);
+	}
+}
+
+void OvCore::SceneSystem::SceneSnapshot::Capture(Scene& p_scene)
+{
+	ZoneScoped;
+
+	m_actors.clear();
+	m_actors.reserve(p_scene.GetActors().size());
+
+	for (auto actor : p_scene.GetActors())
+	{
+		auto& state = m_actors.emplace_back(ActorState{
+			actor->GetID(),
+			actor->GetParentID(),
+			actor->GetName(),
+			actor->GetTag(),
+			actor->IsSelfActive()
+		});
+
+		state.components.reserve(actor->GetComponents().size());
+		for (auto& component : actor->GetComponents())
+			state.components.push_back({ component->GetTypeName(), Encode(*component) });
+
+		state.behaviours.reserve(actor->GetBehaviours().size());
+		for (auto& [name, behaviour] : actor->GetBehaviours())
+			state.behaviours.push_back({ name, Encode(behaviour) });
+	}
+
+	m_captured = true;
+}
+
+void OvCore::SceneSystem::SceneSnapshot::Restore(Scene& p_scene) const
+{
+	ZoneScoped;
+
+	std::unordered_map<int64_t, const ActorState*> states;
+	states.reserve(m_actors.size());
+	for (auto& state : m_actors)
+		states.emplace(state.id, &state);
+
+	std::unordered_map<int64_t, ECS::Actor*> actors;
+	actors.reserve(m_actors.size());
+	std::vector<ECS::Actor*> toDestroy;
+
+	// Actors created during play (Or destroyed but not collected yet) are removed, the others are kept as they are
+	for (auto actor : p_scene.GetActors())
+	{
+		if (!actor->IsAlive() || !states.contains(actor->GetID()) || !actors.emplace(actor->GetID(), actor).second)
+			toDestroy.push_back(actor);
+	}
+
+	for (auto actor : toDestroy)
+		p_scene.DestroyActor(*actor);
+
+	for (auto& state : m_actors)
+	{
+		auto found = actors.find(state.id);
+
+		if (found == actors.end())
+		{
+			// Actors destroyed during play are created again, with their original ID
+			auto& actor = p_scene.CreateActor(state.name, state.tag);
+			actor.SetID(state.id);
+			found = actors.emplace(state.id, &actor).first;
+		}
+
+		RestoreActor(*found->second, state);
+	}
+
+	// Every wrong link is cut before restoring the captured ones, so the hierarchy never goes through a cycle
+	for (auto& state : m_actors)
+	{
+		auto& actor = *actors.at(state.id);
+		auto parent = actors.find(state.parentID);
+
+		if (actor.HasParent() && (parent == actors.end() || actor.GetParent() != parent->second))
+			actor.DetachFromParent();
+	}
+
+	for (auto& state : m_actors)
+	{
+		auto& actor = *actors.at(state.id);
+
+		if (auto parent = actors.find(state.parentID); parent != actors.end() && actor.GetParent() != parent->second)
+			actor.SetParent(*parent->second);
+	}
+}
+
+void OvCore::SceneSystem::SceneSnapshot::RestoreActor(ECS::Actor& p_actor, const ActorState& p_state) const
+{
+	p_actor.SetName(p_state.name);
+	p_actor.SetTag(p_state.tag);
+	p_actor.SetActive(p_state.active);
+
+	std::vector<ECS::Components::AComponent*> unmatched;
+	unmatched.reserve(p_actor.GetComponents().size());
+	for (auto& component : p_actor.GetComponents())
+		unmatched.push_back(component.get());
+
+	// Components are added at the front of the actor, so the captured ones are visited backward to keep their order
+	for (auto it = p_state.components.rbegin(); it != p_state.components.rend(); ++it)
+	{
+		auto found = std::find_if(unmatched.rbegin(), unmatched.rend(), [&it](auto p_component)
+		{
+			return p_component->GetTypeName() == it->type;
+		});
+
+		ECS::Components::AComponent* component = nullptr;
+
+		if (found != unmatched.rend())
+		{
+			component = *found;
+			unmatched.erase(std::next(found).base());
+			DecodeIfChanged(*component, it->data);
+		}
+		else if ((component = p_actor.AddComponentFromTypeName(it->type)))
+		{
+			Decode(*component, it->data);
+		}
+
+		// Runtime state isn't part of the captured data, and is reset even if the component didn't change:
+		// bodies lose the motion they had when the play mode stopped, and particle systems start over
+		if (auto physicalObject = dynamic_cast<ECS::Components::CPhysicalObject*>(component))
+		{
+			physicalObject->SetLinearVelocity(OvMaths::FVector3::Zero);
+			physicalObject->SetAngularVelocity(OvMaths::FVector3::Zero);
+			physicalObject->ClearForces();
+		}
+		else if (auto particleSystem = dynamic_cast<ECS::Components::CParticleSystem*>(component))
+		{
+			particleSystem->Restart();
+		}
+	}
+
+	for (auto component : unmatched)
+		p_actor.RemoveComponent(*component);
+
+	std::vector<std::string> removedBehaviours;
+	for (auto& [name, behaviour] : p_actor.GetBehaviours())
+	{
+		if (std::none_of(p_state.behaviours.begin(), p_state.behaviours.end(), [&name](auto& p_behaviour) { return p_behaviour.type == name; }))
+			removedBehaviours.push_back(name);
+	}
+
+	for (auto& name : removedBehaviours)
+		p_actor.RemoveBehaviour(name);
+
+	for (auto& behaviour : p_state.behaviours)
+	{
+		if (auto existing = p_actor.GetBehaviour(behaviour.type))
+			DecodeIfChanged(*existing, behaviour.data);
+		else
+			Decode(p_actor.AddBehaviour(behaviour.type), behaviour.data);
+	}
+}
+
+void OvCore::SceneSystem::SceneSnapshot::Clear()
+{
+	m_actors.clear();
+	m_actors.shrink_to_fit();
+	m_captured = false;
+}
+
+bool OvCore::SceneSystem::SceneSnapshot::IsEmpty() const
+{
+	return !m_captured;
+}
+
+size_t OvCore::SceneSystem::SceneSnapshot::GetSize() const
+{
+	size_t size = 0;
+
+	for (auto& actor : m_actors)
+	{
+		for (auto& component : actor.components)
+			size += component.data.size();
+
+		for (auto& behaviour : actor.behaviours)
+			size += behaviour.data.size();
+	}
+
+	return size;
+}
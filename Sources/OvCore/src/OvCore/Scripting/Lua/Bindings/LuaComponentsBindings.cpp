@@ -115,7 +115,9 @@ void BindLuaComponents(sol::state& p_luaState)
 		"ClearForces", &CPhysicalObject::ClearForces,
 		"SetCollisionDetectionMode", &CPhysicalObject::SetCollisionDetectionMode,
 		"GetCollisionMode", &CPhysicalObject::GetCollisionDetectionMode,
-		"SetKinematic", &CPhysicalObject::SetKinematic
+		"SetKinematic", &CPhysicalObject::SetKinematic,
+		"GetLayer", &CPhysicalObject::GetLayer,
+		"SetLayer", &CPhysicalObject::SetLayer
 	);
 
 	p_luaState.new_usertype<CPhysicalBox>("PhysicalBox",
@@ -233,13 +235,15 @@ void BindLuaComponents(sol::state& p_luaState)
 		"IsPlaying", &CAudioSource::IsPlaying,
 		"IsSpatial", &CAudioSource::IsSpatial,
 		"GetAttenuationThreshold", &CAudioSource::GetAttenuationThreshold,
+		"GetPriority", &CAudioSource::GetPriority,
 		"SetSound", &CAudioSource::SetSound,
 		"SetVolume", &CAudioSource::SetVolume,
 		"SetPan", &CAudioSource::SetPan,
 		"SetLooped", &CAudioSource::SetLooped,
 		"SetPitch", &CAudioSource::SetPitch,
 		"SetSpatial", &CAudioSource::SetSpatial,
-		"SetAttenuationThreshold", &CAudioSource::SetAttenuationThreshold
+		"SetAttenuationThreshold", &CAudioSource::SetAttenuationThreshold,
+		"SetPriority", &CAudioSource::SetPriority
 	);
 
 	p_luaState.new_usertype<CAudioListener>("AudioListener",
@@ -18,6 +18,9 @@
 #include "OvCore/ResourceManagement/TextureManager.h"
 #include "OvCore/ResourceManagement/MaterialManager.h"
 #include "OvCore/ResourceManagement/SoundManager.h"
+#include "OvCore/ResourceManagement/PrefabManager.h"
+#include "OvCore/Scripting/ScriptEngine.h"
+#include "OvCore/Scripting/Lua/LuaCoroutineScheduler.h"
 
 #include <OvPhysics/Entities/PhysicalObject.h>
 
@@ -25,6 +28,63 @@
 
 #include <sol/sol.hpp>
 
+namespace
+{
+	using EWait = OvCore::Scripting::LuaCoroutineScheduler::EWait;
+
+	OvCore::Scripting::LuaCoroutineScheduler& GetCoroutineScheduler()
+	{
+		return OVSERVICE(OvCore::Scripting::ScriptEngine).GetCoroutineScheduler();
+	}
+
+	/*
+	* The functions below are bound with the raw Lua API: yielding across the sol wrappers isn't supported
+	*/
+	int StartCoroutine(lua_State* p_luaState)
+	{
+		luaL_checktype(p_luaState, 1, LUA_TFUNCTION);
+		const uint32_t id = GetCoroutineScheduler().Start(p_luaState, lua_gettop(p_luaState) - 1);
+		lua_pushinteger(p_luaState, static_cast<lua_Integer>(id));
+		return 1;
+	}
+
+	int YieldCoroutine(lua_State* p_luaState, EWait p_wait, int p_valueCount)
+	{
+		if (!lua_isyieldable(p_luaState))
+		{
+			return luaL_error(p_luaState, "Coroutines wait functions can only be called from a coroutine (See Coroutines.Start)");
+		}
+
+		lua_settop(p_luaState, p_valueCount);
+		lua_pushinteger(p_luaState, static_cast<lua_Integer>(p_wait));
+		lua_insert(p_luaState, 1);
+		return lua_yield(p_luaState, p_valueCount + 1);
+	}
+
+	int Yield(lua_State* p_luaState)
+	{
+		return YieldCoroutine(p_luaState, EWait::FRAME, 0);
+	}
+
+	int Wait(lua_State* p_luaState)
+	{
+		luaL_checknumber(p_luaState, 1);
+		return YieldCoroutine(p_luaState, EWait::SECONDS, 1);
+	}
+
+	int WaitFrames(lua_State* p_luaState)
+	{
+		luaL_checkinteger(p_luaState, 1);
+		return YieldCoroutine(p_luaState, EWait::FRAMES, 1);
+	}
+
+	int WaitUntil(lua_State* p_luaState)
+	{
+		luaL_checktype(p_luaState, 1, LUA_TFUNCTION);
+		return YieldCoroutine(p_luaState, EWait::CONDITION, 1);
+	}
+}
+
 void BindLuaGlobal(sol::state& p_luaState)
 {
 	using namespace OvWindowing;
@@ -41,7 +101,11 @@ void BindLuaGlobal(sol::state& p_luaState)
 		"FindActorsByTag", &Scene::FindActorsByTag,
 		"CreateActor", sol::overload(
 			sol::resolve<Actor&(void)>(&Scene::CreateActor),
-			sol::resolve<Actor&(const std::string&, const std::string&)>(&Scene::CreateActor))
+			sol::resolve<Actor&(const std::string&, const std::string&)>(&Scene::CreateActor)),
+		"CloneActor", [](Scene& p_scene, Actor& p_source) -> Actor& { return p_scene.CloneActor(p_source); },
+		"Instantiate", sol::overload(
+			[](Scene& p_scene, const OvCore::Resources::Prefab& p_prefab, const FVector3& p_position) { return p_scene.Instantiate(p_prefab, p_position); },
+			[](Scene& p_scene, const OvCore::Resources::Prefab& p_prefab, const FVector3& p_position, const FQuaternion& p_rotation) { return p_scene.Instantiate(p_prefab, p_position, p_rotation); })
 	);
 
 	p_luaState.new_enum<EKey>("Key", {
@@ -218,7 +282,9 @@ void BindLuaGlobal(sol::state& p_luaState)
 		"GetShader", [](const std::string& p_resPath) { return OVSERVICE(ShaderManager).GetResource(p_resPath); },
 		"GetTexture", [](const std::string& p_resPath) { return OVSERVICE(TextureManager).GetResource(p_resPath); },
 		"GetMaterial", [](const std::string& p_resPath) { return OVSERVICE(MaterialManager).GetResource(p_resPath); },
-		"GetSound", [](const std::string& p_resPath) { return OVSERVICE(SoundManager).GetResource(p_resPath); }
+		"GetSound", [](const std::string& p_resPath) { return OVSERVICE(SoundManager).GetResource(p_resPath); },
+		"LoadSoundAsync", [](const std::string& p_resPath) { return OVSERVICE(SoundManager).LoadResourceAsync(p_resPath); },
+		"GetPrefab", [](const std::string& p_resPath) { return OVSERVICE(PrefabManager).GetResource(p_resPath); }
 	);
 
 	p_luaState.create_named_table("Math",
@@ -234,6 +300,28 @@ void BindLuaGlobal(sol::state& p_luaState)
 	);
 
 	p_luaState.create_named_table("Physics",
-		"Raycast", [](const OvMaths::FVector3& p_origin, const OvMaths::FVector3& p_direction, float p_distance) { return PhysicsWrapper::Raycast(p_origin, p_direction, p_distance); }
+		"Raycast", [](const OvMaths::FVector3& p_origin, const OvMaths::FVector3& p_direction, float p_distance) { return PhysicsWrapper::Raycast(p_origin, p_direction, p_distance); },
+		"SphereCast", [](const OvMaths::FVector3& p_origin, float p_radius, const OvMaths::FVector3& p_direction, float p_distance) { return PhysicsWrapper::SphereCast(p_origin, p_radius, p_direction, p_distance); },
+		"OverlapSphere", [](const OvMaths::FVector3& p_center, float p_radius) { return PhysicsWrapper::OverlapSphere(p_center, p_radius); }
 	);
+
+	sol::table coroutines = p_luaState.create_named_table("Coroutines",
+		"Stop", [](uint32_t p_id) { GetCoroutineScheduler().Stop(p_id); },
+		"SetFrameBudget", [](double p_milliseconds) { GetCoroutineScheduler().SetFrameBudget(p_milliseconds / 1000.0); },
+		"GetCount", []() { return GetCoroutineScheduler().GetCoroutineCount(); }
+	);
+
+	coroutines.push();
+	lua_State* luaState = p_luaState.lua_state();
+	lua_pushcfunction(luaState, StartCoroutine);
+	lua_setfield(luaState, -2, "Start");
+	lua_pushcfunction(luaState, Yield);
+	lua_setfield(luaState, -2, "Yield");
+	lua_pushcfunction(luaState, Wait);
+	lua_setfield(luaState, -2, "Wait");
+	lua_pushcfunction(luaState, WaitFrames);
+	lua_setfield(luaState, -2, "WaitFrames");
+	lua_pushcfunction(luaState, WaitUntil);
+	lua_setfield(luaState, -2, "WaitUntil");
+	lua_pop(luaState, 1);
 }
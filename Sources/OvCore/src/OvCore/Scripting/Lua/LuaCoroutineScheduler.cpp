@@ -0,0 +1,254 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+extern "C"
+{
+#include <lua.h>
+#include <lauxlib.h>
+}
+
+#include <tracy/Tracy.hpp>
+
+#include <OvDebug/Logger.h>
+#include <OvCore/Scripting/Lua/LuaCoroutineScheduler.h>
+
+namespace
+{
+	void LogCoroutineError(lua_State* p_luaState, lua_State* p_thread)
+	{
+		const char* message = lua_tostring(p_thread, -1);
+		luaL_traceback(p_luaState, p_thread, message ? message : "Coroutine error", 0);
+		OVLOG_ERROR(lua_tostring(p_luaState, -1));
+		lua_pop(p_luaState, 1);
+	}
+}
+
+OvCore::Scripting::LuaCoroutineScheduler::LuaCoroutineScheduler(lua_State* p_luaState) :
+	m_luaState(p_luaState)
+{
+}
+
+uint32_t OvCore::Scripting::LuaCoroutineScheduler::Start(lua_State* p_caller, int p_argumentCount)
+{
+	// The thread is referenced by the registry, so that it doesn't get collected while it waits
+	lua_State* thread = lua_newthread(p_caller);
+
+	Coroutine coroutine;
+	coroutine.thread = thread;
+	coroutine.threadRef = luaL_ref(p_caller, LUA_REGISTRYINDEX);
+	coroutine.owner = m_currentOwner;
+	coroutine.id = m_nextID++;
+
+	lua_xmove(p_caller, thread, p_argumentCount + 1);
+
+	m_coroutines.push_back(coroutine);
+	Resume(m_coroutines.size() - 1, p_argumentCount, p_caller);
+
+	return coroutine.id;
+}
+
+void OvCore::Scripting::LuaCoroutineScheduler::Stop(uint32_t p_id)
+{
+	auto found = std::find_if(m_coroutines.begin(), m_coroutines.end(), [p_id](const Coroutine& p_coroutine)
+	{
+		return p_coroutine.id == p_id;
+	});
+
+	if (found != m_coroutines.end())
+	{
+		found->alive = false;
+	}
+}
+
+void OvCore::Scripting::LuaCoroutineScheduler::StopAll(const OvCore::ECS::Components::Behaviour& p_owner)
+{
+	for (auto& coroutine : m_coroutines)
+	{
+		if (coroutine.owner == &p_owner)
+		{
+			coroutine.alive = false;
+		}
+	}
+}
+
+const OvCore::ECS::Components::Behaviour* OvCore::Scripting::LuaCoroutineScheduler::SetCurrentOwner(const OvCore::ECS::Components::Behaviour* p_owner)
+{
+	return std::exchange(m_currentOwner, p_owner);
+}
+
+void OvCore::Scripting::LuaCoroutineScheduler::SetFrameBudget(double p_seconds)
+{
+	m_frameBudget = std::max(p_seconds, 0.0);
+}
+
+size_t OvCore::Scripting::LuaCoroutineScheduler::GetCoroutineCount() const
+{
+	return std::count_if(m_coroutines.begin(), m_coroutines.end(), [](const Coroutine& p_coroutine) { return p_coroutine.alive; });
+}
+
+void OvCore::Scripting::LuaCoroutineScheduler::Update(float p_deltaTime)
+{
+	ZoneScoped;
+
+	m_time += p_deltaTime;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	// Indexed iteration, as coroutines can start other coroutines (Which might reallocate the list)
+	const size_t count = m_coroutines.size();
+	size_t resumed = 0;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const size_t index = (m_cursor + i) % count;
+
+		if (!m_coroutines[index].alive || !IsReady(index))
+		{
+			continue;
+		}
+
+		Resume(index, 0, m_luaState);
+		++resumed;
+
+		if (m_frameBudget > 0.0 && std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= m_frameBudget)
+		{
+			// The next frame starts with the coroutines left behind
+			m_cursor = index + 1;
+			break;
+		}
+	}
+
+	++m_frame;
+
+	RemoveDeadCoroutines();
+
+	TracyPlot("Lua Coroutines", static_cast<int64_t>(m_coroutines.size()));
+	TracyPlot("Lua Coroutines Resumed", static_cast<int64_t>(resumed));
+}
+
+bool OvCore::Scripting::LuaCoroutineScheduler::IsReady(size_t p_index)
+{
+	const auto& coroutine = m_coroutines[p_index];
+
+	if (m_frame < coroutine.resumeFrame)
+	{
+		return false;
+	}
+
+	switch (coroutine.wait)
+	{
+	case EWait::SECONDS:
+		return m_time >= coroutine.resumeTime;
+
+	case EWait::CONDITION:
+	{
+		// The condition might start coroutines, the list can't be referenced past this call
+		lua_rawgeti(m_luaState, LUA_REGISTRYINDEX, coroutine.conditionRef);
+
+		if (lua_pcall(m_luaState, 0, 1, 0) != LUA_OK)
+		{
+			LogCoroutineError(m_luaState, m_luaState);
+			lua_pop(m_luaState, 1);
+			Kill(m_coroutines[p_index]);
+			return false;
+		}
+
+		const bool fulfilled = lua_toboolean(m_luaState, -1);
+		lua_pop(m_luaState, 1);
+		return fulfilled;
+	}
+
+	default:
+		return true;
+	}
+}
+
+void OvCore::Scripting::LuaCoroutineScheduler::Resume(size_t p_index, int p_argumentCount, lua_State* p_from)
+{
+	lua_State* thread = m_coroutines[p_index].thread;
+
+	if (m_coroutines[p_index].conditionRef != LUA_NOREF)
+	{
+		luaL_unref(m_luaState, LUA_REGISTRYINDEX, m_coroutines[p_index].conditionRef);
+		m_coroutines[p_index].conditionRef = LUA_NOREF;
+	}
+
+	// Coroutines started from this one belong to the same behaviour
+	const auto previousOwner = SetCurrentOwner(m_coroutines[p_index].owner);
+
+	int resultCount = 0;
+	const int status = lua_resume(thread, p_from, p_argumentCount, &resultCount);
+
+	SetCurrentOwner(previousOwner);
+
+	// The coroutine might have started others, the reference has to be taken after resuming
+	auto& coroutine = m_coroutines[p_index];
+
+	if (status != LUA_YIELD)
+	{
+		if (status != LUA_OK)
+		{
+			LogCoroutineError(m_luaState, thread);
+		}
+
+		Kill(coroutine);
+		return;
+	}
+
+	coroutine.wait = resultCount > 0 ? static_cast<EWait>(lua_tointeger(thread, -resultCount)) : EWait::FRAME;
+	coroutine.resumeFrame = m_frame + 1;
+
+	switch (coroutine.wait)
+	{
+	case EWait::SECONDS:
+		coroutine.resumeTime = m_time + lua_tonumber(thread, -resultCount + 1);
+		break;
+
+	case EWait::FRAMES:
+		coroutine.resumeFrame = m_frame + std::max<lua_Integer>(lua_tointeger(thread, -resultCount + 1), 1);
+		break;
+
+	case EWait::CONDITION:
+		lua_pushvalue(thread, -resultCount + 1);
+		lua_xmove(thread, m_luaState, 1);
+		coroutine.conditionRef = luaL_ref(m_luaState, LUA_REGISTRYINDEX);
+		break;
+
+	default:
+		break;
+	}
+
+	lua_pop(thread, resultCount);
+}
+
+void OvCore::Scripting::LuaCoroutineScheduler::Kill(Coroutine& p_coroutine)
+{
+	p_coroutine.alive = false;
+}
+
+void OvCore::Scripting::LuaCoroutineScheduler::RemoveDeadCoroutines()
+{
+	for (const auto& coroutine : m_coroutines)
+	{
+		if (!coroutine.alive)
+		{
+			// Unreferenced threads are collected with their stack
+			luaL_unref(m_luaState, LUA_REGISTRYINDEX, coroutine.conditionRef);
+			luaL_unref(m_luaState, LUA_REGISTRYINDEX, coroutine.threadRef);
+		}
+	}
+
+	std::erase_if(m_coroutines, [](const Coroutine& p_coroutine) { return !p_coroutine.alive; });
+
+	if (m_cursor >= m_coroutines.size())
+	{
+		m_cursor = 0;
+	}
+}
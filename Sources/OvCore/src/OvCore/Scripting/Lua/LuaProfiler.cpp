@@ -0,0 +1,128 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+extern "C"
+{
+#include <lua.h>
+}
+
+#include <tracy/Tracy.hpp>
+
+#include <OvCore/Scripting/Lua/LuaProfiler.h>
+
+void* OvCore::Scripting::LuaProfiler::Allocate(void* p_userData, void* p_pointer, size_t p_oldSize, size_t p_newSize)
+{
+	auto& memory = static_cast<LuaProfiler*>(p_userData)->m_memoryStatistics;
+
+	// When the pointer is null, the old size is the type of the object being allocated, not a size
+	const size_t oldSize = p_pointer ? p_oldSize : 0;
+
+	if (p_newSize == 0)
+	{
+		std::free(p_pointer);
+		memory.heapSize -= oldSize;
+		memory.frameFreedBytes += oldSize;
+		return nullptr;
+	}
+
+	void* result = std::realloc(p_pointer, p_newSize);
+
+	if (!result)
+	{
+		return nullptr;
+	}
+
+	if (p_newSize > oldSize)
+	{
+		memory.frameAllocatedBytes += p_newSize - oldSize;
+	}
+	else
+	{
+		memory.frameFreedBytes += oldSize - p_newSize;
+	}
+
+	memory.heapSize = memory.heapSize - oldSize + p_newSize;
+	memory.peakHeapSize = std::max(memory.peakHeapSize, memory.heapSize);
+	++memory.allocationCount;
+	++memory.frameAllocationCount;
+
+	return result;
+}
+
+void OvCore::Scripting::LuaProfiler::SetEnabled(bool p_enabled)
+{
+	m_enabled = p_enabled;
+}
+
+bool OvCore::Scripting::LuaProfiler::IsEnabled() const
+{
+	return m_enabled;
+}
+
+void OvCore::Scripting::LuaProfiler::RecordHook(const std::string& p_scriptName, ELuaHook p_hook, double p_duration)
+{
+	auto found = m_scriptStatistics.find(p_scriptName);
+
+	if (found == m_scriptStatistics.end())
+	{
+		found = m_scriptStatistics.emplace(p_scriptName, ScriptStatistics{}).first;
+	}
+
+	auto& hook = found->second[static_cast<size_t>(p_hook)];
+	++hook.callCount;
+	hook.totalTime += p_duration;
+	hook.maxTime = std::max(hook.maxTime, p_duration);
+
+	m_frameScriptTime += p_duration;
+}
+
+void OvCore::Scripting::LuaProfiler::EndFrame(lua_State* p_luaState)
+{
+	if (m_enabled)
+	{
+		ZoneScopedN("Lua GC Step");
+
+		// The collector runs incrementally during allocations, a step at a known point makes its cost measurable
+		const auto start = std::chrono::steady_clock::now();
+		lua_gc(p_luaState, LUA_GCSTEP, 0);
+		m_memoryStatistics.gcStepTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		TracyPlot("Lua Scripts Time (ms)", m_frameScriptTime * 1000.0);
+		TracyPlot("Lua GC Step (ms)", m_memoryStatistics.gcStepTime * 1000.0);
+		TracyPlot("Lua Heap (KB)", static_cast<double>(m_memoryStatistics.heapSize) / 1024.0);
+		TracyPlot("Lua Allocations", static_cast<int64_t>(m_memoryStatistics.frameAllocationCount));
+	}
+
+	m_frameScriptTime = 0.0;
+	m_memoryStatistics.frameAllocationCount = 0;
+	m_memoryStatistics.frameAllocatedBytes = 0;
+	m_memoryStatistics.frameFreedBytes = 0;
+}
+
+void OvCore::Scripting::LuaProfiler::ResetStatistics()
+{
+	m_scriptStatistics.clear();
+	m_frameScriptTime = 0.0;
+}
+
+void OvCore::Scripting::LuaProfiler::ResetMemoryStatistics()
+{
+	m_memoryStatistics = {};
+}
+
+const std::unordered_map<std::string, OvCore::Scripting::LuaProfiler::ScriptStatistics>& OvCore::Scripting::LuaProfiler::GetScriptStatistics() const
+{
+	return m_scriptStatistics;
+}
+
+const OvCore::Scripting::LuaProfiler::MemoryStatistics& OvCore::Scripting::LuaProfiler::GetMemoryStatistics() const
+{
+	return m_memoryStatistics;
+}
@@ -4,6 +4,9 @@
 * @licence: MIT
 */
 
+#include <array>
+#include <string_view>
+
 #include <sol/sol.hpp>
 
 #include <OvDebug/Logger.h>
@@ -24,9 +27,57 @@ bool OvCore::Scripting::LuaScriptBase::IsValid() const
 	return m_context.table && m_context.table->valid();
 }
 
+namespace
+{
+	constexpr auto kHookNames = std::to_array<std::string_view>({
+		"OnAwake",
+		"OnStart",
+		"OnEnable",
+		"OnDisable",
+		"OnDestroy",
+		"OnUpdate",
+		"OnFixedUpdate",
+		"OnLateUpdate",
+		"OnCollisionEnter",
+		"OnCollisionStay",
+		"OnCollisionExit",
+		"OnTriggerEnter",
+		"OnTriggerStay",
+		"OnTriggerExit"
+	});
+
+	static_assert(kHookNames.size() == static_cast<size_t>(OvCore::Scripting::ELuaHook::COUNT));
+}
+
 OvCore::Scripting::LuaScript::LuaScript(sol::table table)
 {
 	m_context.table = std::make_unique<sol::table>(table);
+
+	if (!IsValid())
+	{
+		return;
+	}
+
+	// Resolving the hooks once spares a lookup by name for every call
+	for (size_t i = 0; i < kHookNames.size(); ++i)
+	{
+		if (sol::object hook = table[kHookNames[i]]; hook.valid())
+		{
+			m_context.hooks[i] = std::make_unique<sol::protected_function>(hook);
+			m_context.hookMask |= static_cast<uint16_t>(1 << i);
+		}
+	}
+}
+
+bool OvCore::Scripting::LuaScript::HasHook(ELuaHook p_hook) const
+{
+	return m_context.hookMask & (1 << static_cast<uint16_t>(p_hook));
+}
+
+sol::protected_function& OvCore::Scripting::LuaScript::GetHook(ELuaHook p_hook) const
+{
+	OVASSERT(HasHook(p_hook), "The script doesn't implement this hook");
+	return *m_context.hooks[static_cast<size_t>(p_hook)];
 }
 
 void OvCore::Scripting::LuaScript::SetOwner(OvCore::ECS::Actor& p_owner)
@@ -4,6 +4,12 @@
 * @licence: MIT
 */
 
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <unordered_map>
+
 #include <sol/sol.hpp>
 
 #include <tracy/Tracy.hpp>
@@ -11,6 +17,8 @@
 #include <OvDebug/Logger.h>
 #include <OvDebug/Assertion.h>
 #include <OvCore/Scripting/ScriptEngine.h>
+#include <OvCore/Scripting/Lua/LuaCoroutineScheduler.h>
+#include <OvCore/Scripting/Lua/LuaProfiler.h>
 #include <OvCore/ECS/Components/Behaviour.h>
 #include <OvCore/ECS/Actor.h>
 
@@ -29,32 +37,212 @@ constexpr auto luaBindings = std::array{
 };
 
 template<typename... Args>
-void ExecuteLuaFunction(OvCore::ECS::Components::Behaviour& p_behaviour, const std::string& p_functionName, Args&& ...p_args)
+void ExecuteLuaHook(OvCore::Scripting::LuaScriptEngineContext& p_context, OvCore::ECS::Components::Behaviour& p_behaviour, OvCore::Scripting::ELuaHook p_hook, Args&& ...p_args)
 {
 	auto context = p_behaviour.GetScript();
 
 	OVASSERT(context.has_value(), "The given context is null");
 	OVASSERT(context->IsValid(), "The given context is invalid");
 
-	const sol::table& table = *static_cast<OvCore::Scripting::LuaScript&>(context.value()).GetContext().table;
+	const auto& script = static_cast<OvCore::Scripting::LuaScript&>(context.value());
 
-	if (table[p_functionName].valid())
+	if (script.HasHook(p_hook))
 	{
-		sol::protected_function pfr = table[p_functionName];
-		auto pfrResult = pfr.call(table, std::forward<Args>(p_args)...);
+		// Coroutines started by the hook belong to the behaviour, and stop with it
+		const auto previousOwner = p_context.coroutineScheduler->SetCurrentOwner(&p_behaviour);
+		const bool profiling = p_context.profiler->IsEnabled();
+
+		ZoneTransientN(hookZone, "Lua Hook", profiling);
+		ZoneNameV(hookZone, p_behaviour.name.c_str(), p_behaviour.name.size());
+		const auto start = profiling ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+
+		auto pfrResult = script.GetHook(p_hook).call(*script.GetContext().table, std::forward<Args>(p_args)...);
+
+		if (profiling)
+		{
+			p_context.profiler->RecordHook(p_behaviour.name, p_hook, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+		}
+
 		if (!pfrResult.valid())
 		{
 			sol::error err = pfrResult;
 			OVLOG_ERROR(err.what());
 		}
+
+		p_context.coroutineScheduler->SetCurrentOwner(previousOwner);
 	}
 }
 
-sol::table LoadScript(sol::state& p_luaState, const std::string& p_scriptName)
+OvCore::ECS::Components::EUpdateCallbacks GetUpdateCallbacks(const OvCore::Scripting::LuaScript& p_script)
 {
+	using namespace OvCore::ECS::Components;
 	using namespace OvCore::Scripting;
 
-	const auto result = p_luaState.safe_script_file(p_scriptName, &sol::script_pass_on_error);
+	auto callbacks = EUpdateCallbacks::NONE;
+
+	if (p_script.HasHook(ELuaHook::UPDATE))
+		callbacks |= EUpdateCallbacks::UPDATE;
+
+	if (p_script.HasHook(ELuaHook::FIXED_UPDATE))
+		callbacks |= EUpdateCallbacks::FIXED_UPDATE;
+
+	if (p_script.HasHook(ELuaHook::LATE_UPDATE))
+		callbacks |= EUpdateCallbacks::LATE_UPDATE;
+
+	return callbacks;
+}
+
+namespace
+{
+	// Cache files written by another Lua version (Incompatible bytecode) or another cache layout are ignored
+	constexpr uint32_t kBytecodeCacheVersion = LUA_VERSION_NUM * 100 + 1;
+
+	struct BytecodeCacheHeader
+	{
+		uint32_t version;
+		int64_t sourceWriteTime;
+		uint64_t size;
+	};
+
+	std::filesystem::path GetBytecodeCachePath(const std::filesystem::path& p_cacheFolder, const std::string& p_scriptPath)
+	{
+		return p_cacheFolder / std::format("{:016x}.luac", std::hash<std::string>{}(p_scriptPath));
+	}
+
+	int64_t ToCacheTime(std::filesystem::file_time_type p_time)
+	{
+		return static_cast<int64_t>(p_time.time_since_epoch().count());
+	}
+
+	std::string ReadBytecodeCache(const std::filesystem::path& p_cacheFolder, const std::string& p_scriptPath, std::filesystem::file_time_type p_sourceWriteTime)
+	{
+		std::ifstream file(GetBytecodeCachePath(p_cacheFolder, p_scriptPath), std::ios::binary);
+
+		BytecodeCacheHeader header;
+
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+			header.version != kBytecodeCacheVersion ||
+			header.sourceWriteTime != ToCacheTime(p_sourceWriteTime))
+		{
+			return {};
+		}
+
+		std::string bytecode(header.size, '\0');
+
+		if (!file.read(bytecode.data(), bytecode.size()))
+		{
+			return {};
+		}
+
+		return bytecode;
+	}
+
+	void WriteBytecodeCache(const std::filesystem::path& p_cacheFolder, const std::string& p_scriptPath, std::filesystem::file_time_type p_sourceWriteTime, const std::string& p_bytecode)
+	{
+		// The cache is an optimization, failing to write it isn't an error
+		std::error_code error;
+		std::filesystem::create_directories(p_cacheFolder, error);
+
+		std::ofstream file(GetBytecodeCachePath(p_cacheFolder, p_scriptPath), std::ios::binary | std::ios::trunc);
+
+		const BytecodeCacheHeader header{ kBytecodeCacheVersion, ToCacheTime(p_sourceWriteTime), p_bytecode.size() };
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(p_bytecode.data(), p_bytecode.size());
+	}
+}
+
+/**
+* Compiled scripts, keyed by path. The bytecode survives the Lua state being recreated, the chunks are bound to it
+*/
+struct OvCore::Scripting::LuaChunkCache
+{
+	struct Entry
+	{
+		std::filesystem::file_time_type sourceWriteTime;
+		std::string bytecode;
+		std::optional<sol::protected_function> chunk;
+	};
+
+	std::unordered_map<std::string, Entry> entries;
+};
+
+sol::protected_function* GetScriptChunk(OvCore::Scripting::LuaScriptEngineContext& p_context, const std::string& p_scriptName)
+{
+	ZoneScoped;
+
+	std::error_code error;
+	const auto sourceWriteTime = std::filesystem::last_write_time(p_scriptName, error);
+
+	if (error)
+	{
+		OVLOG_ERROR("'" + p_scriptName + "' cannot be opened");
+		return nullptr;
+	}
+
+	auto& entry = p_context.chunkCache->entries[p_scriptName];
+
+	// Scripts modified since their compilation are compiled again
+	if (entry.sourceWriteTime != sourceWriteTime)
+	{
+		entry = OvCore::Scripting::LuaChunkCache::Entry{ sourceWriteTime, {}, std::nullopt };
+	}
+
+	if (entry.chunk)
+	{
+		return &entry.chunk.value();
+	}
+
+	auto& luaState = *p_context.luaState;
+	const std::string chunkName = "@" + p_scriptName;
+
+	if (entry.bytecode.empty() && !p_context.bytecodeCacheFolder.empty())
+	{
+		entry.bytecode = ReadBytecodeCache(p_context.bytecodeCacheFolder, p_scriptName, sourceWriteTime);
+	}
+
+	if (!entry.bytecode.empty())
+	{
+		if (sol::load_result loaded = luaState.load_buffer(entry.bytecode.data(), entry.bytecode.size(), chunkName, sol::load_mode::binary); loaded.valid())
+		{
+			entry.chunk = loaded.get<sol::protected_function>();
+			return &entry.chunk.value();
+		}
+
+		entry.bytecode.clear();
+	}
+
+	sol::load_result loaded = luaState.load_file(p_scriptName, sol::load_mode::text);
+
+	if (!loaded.valid())
+	{
+		sol::error err = loaded;
+		OVLOG_ERROR(err.what());
+		return nullptr;
+	}
+
+	entry.chunk = loaded.get<sol::protected_function>();
+	const sol::bytecode bytecode = entry.chunk->dump(&sol::dump_pass_on_error);
+	entry.bytecode.assign(bytecode.as_string_view());
+
+	if (!p_context.bytecodeCacheFolder.empty() && !entry.bytecode.empty())
+	{
+		WriteBytecodeCache(p_context.bytecodeCacheFolder, p_scriptName, sourceWriteTime, entry.bytecode);
+	}
+
+	return &entry.chunk.value();
+}
+
+sol::table LoadScript(OvCore::Scripting::LuaScriptEngineContext& p_context, const std::string& p_scriptName)
+{
+	auto* chunk = GetScriptChunk(p_context, p_scriptName);
+
+	if (!chunk)
+	{
+		return {};
+	}
+
+	// Each execution of the shared chunk builds a new table for the behaviour
+	const auto result = (*chunk)();
 
 	if (!result.valid())
 	{
@@ -76,9 +264,9 @@ sol::table LoadScript(sol::state& p_luaState, const std::string& p_scriptName)
 	}
 }
 
-bool RegisterBehaviour(sol::state& p_luaState, OvCore::ECS::Components::Behaviour& p_behaviour, const std::string& p_scriptName)
+bool RegisterBehaviour(OvCore::Scripting::LuaScriptEngineContext& p_context, OvCore::ECS::Components::Behaviour& p_behaviour, const std::string& p_scriptName)
 {
-	auto table = LoadScript(p_luaState, p_scriptName);
+	auto table = LoadScript(p_context, p_scriptName);
 
 	p_behaviour.SetScript(std::make_unique<OvCore::Scripting::LuaScript>(table));
 
@@ -87,9 +275,11 @@ bool RegisterBehaviour(sol::state& p_luaState, OvCore::ECS::Components::Behaviou
 	{
 		auto& luaScript = static_cast<OvCore::Scripting::LuaScript&>(context.value());
 		luaScript.SetOwner(p_behaviour.owner);
+		p_behaviour.SetUpdateCallbacks(GetUpdateCallbacks(luaScript));
 		return true;
 	}
 
+	p_behaviour.SetUpdateCallbacks(OvCore::ECS::Components::EUpdateCallbacks::NONE);
 	return false;
 }
 
@@ -133,7 +323,7 @@ void OvCore::Scripting::LuaScriptEngineBase::AddBehaviour(OvCore::ECS::Component
 	const auto scriptFileName = p_toAdd.name + GetDefaultExtension();
 	const auto scriptPath = m_context.scriptRootFolder / scriptFileName;
 
-	if (!RegisterBehaviour(*m_context.luaState, p_toAdd, scriptPath.string()))
+	if (!RegisterBehaviour(m_context, p_toAdd, scriptPath.string()))
 	{
 		++m_context.errorCount;
 	}
@@ -142,8 +332,27 @@ void OvCore::Scripting::LuaScriptEngineBase::AddBehaviour(OvCore::ECS::Component
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::Reload()
 {
+	// Reloaded scripts might implement other callbacks, the scenes dispatching them have to know
+	std::vector<OvCore::ECS::Components::EUpdateCallbacks> previousCallbacks;
+	previousCallbacks.reserve(m_context.behaviours.size());
+
+	for (auto& behaviour : m_context.behaviours)
+	{
+		previousCallbacks.push_back(behaviour.get().GetUpdateCallbacks());
+	}
+
 	static_cast<LuaScriptEngine&>(*this).DestroyContext();
 	static_cast<LuaScriptEngine&>(*this).CreateContext();
+
+	for (size_t i = 0; i < m_context.behaviours.size(); ++i)
+	{
+		auto& behaviour = m_context.behaviours[i].get();
+
+		if (behaviour.GetUpdateCallbacks() != previousCallbacks[i])
+		{
+			behaviour.owner.BehaviourUpdateCallbacksChangedEvent.Invoke(behaviour, previousCallbacks[i]);
+		}
+	}
 }
 
 template<>
@@ -151,20 +360,33 @@ void OvCore::Scripting::LuaScriptEngineBase::RemoveBehaviour(OvCore::ECS::Compon
 {
 	if (m_context.luaState)
 	{
+		if (auto script = p_toRemove.GetScript(); script && script->IsValid())
+		{
+			// Other scripts might still reference the table, its owner is about to be destroyed
+			(*static_cast<LuaScript&>(script.value()).GetContext().table)["owner"] = sol::lua_nil;
+		}
+		else if (m_context.errorCount > 0)
+		{
+			// The behaviour failed to register, it doesn't account for an error anymore
+			--m_context.errorCount;
+		}
+
+		m_context.coroutineScheduler->StopAll(p_toRemove);
+
+		// Releasing the references lets the garbage collector reclaim the table, the other scripts are left untouched
 		p_toRemove.RemoveScript();
 	}
 
-	m_context.behaviours.erase(
-		std::remove_if(m_context.behaviours.begin(), m_context.behaviours.end(),
-			[&p_toRemove](std::reference_wrapper< OvCore::ECS::Components::Behaviour> behaviour) {
-				return &p_toRemove == &behaviour.get();
-			}
-		)
+	auto found = std::find_if(m_context.behaviours.begin(), m_context.behaviours.end(),
+		[&p_toRemove](std::reference_wrapper<OvCore::ECS::Components::Behaviour> behaviour) {
+			return &p_toRemove == &behaviour.get();
+		}
 	);
 
-	// Unconsidering a script is impossible with Lua, we have to reparse every behaviours
-	// @note this might be costly, we should look into it more seriously.
-	Reload(); 
+	if (found != m_context.behaviours.end())
+	{
+		m_context.behaviours.erase(found);
+	}
 }
 
 template<>
@@ -173,88 +395,102 @@ bool OvCore::Scripting::LuaScriptEngineBase::IsOk() const
 	return m_context.luaState && m_context.errorCount == 0;
 }
 
+template<>
+void OvCore::Scripting::LuaScriptEngineBase::Update(float p_deltaTime)
+{
+	if (m_context.coroutineScheduler)
+	{
+		m_context.coroutineScheduler->Update(p_deltaTime);
+	}
+
+	if (m_context.luaState)
+	{
+		m_context.profiler->EndFrame(m_context.luaState->lua_state());
+	}
+}
+
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnAwake(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnAwake");
+	ExecuteLuaHook(m_context, p_target, ELuaHook::AWAKE);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnStart(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnStart");
+	ExecuteLuaHook(m_context, p_target, ELuaHook::START);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnEnable(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnEnable");
+	ExecuteLuaHook(m_context, p_target, ELuaHook::ENABLE);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnDisable(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnDisable");
+	ExecuteLuaHook(m_context, p_target, ELuaHook::DISABLE);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnDestroy(OvCore::ECS::Components::Behaviour& p_target)
 {
-	ExecuteLuaFunction(p_target, "OnDestroy");
+	ExecuteLuaHook(m_context, p_target, ELuaHook::DESTROY);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnUpdate(OvCore::ECS::Components::Behaviour& p_target, float p_deltaTime)
 {
-	ExecuteLuaFunction(p_target, "OnUpdate", p_deltaTime);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::UPDATE, p_deltaTime);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnFixedUpdate(OvCore::ECS::Components::Behaviour& p_target, float p_deltaTime)
 {
-	ExecuteLuaFunction(p_target, "OnFixedUpdate", p_deltaTime);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::FIXED_UPDATE, p_deltaTime);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnLateUpdate(OvCore::ECS::Components::Behaviour& p_target, float p_deltaTime)
 {
-	ExecuteLuaFunction(p_target, "OnLateUpdate", p_deltaTime);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::LATE_UPDATE, p_deltaTime);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnCollisionEnter(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnCollisionEnter", p_otherObject);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::COLLISION_ENTER, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnCollisionStay(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnCollisionStay", p_otherObject);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::COLLISION_STAY, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnCollisionExit(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnCollisionExit", p_otherObject);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::COLLISION_EXIT, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnTriggerEnter(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnTriggerEnter", p_otherObject);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::TRIGGER_ENTER, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnTriggerStay(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnTriggerStay", p_otherObject);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::TRIGGER_STAY, p_otherObject);
 }
 
 template<>
 void OvCore::Scripting::LuaScriptEngineBase::OnTriggerExit(OvCore::ECS::Components::Behaviour& p_target, OvCore::ECS::Components::CPhysicalObject& p_otherObject)
 {
-	ExecuteLuaFunction(p_target, "OnTriggerExit", p_otherObject);
+	ExecuteLuaHook(m_context, p_target, ELuaHook::TRIGGER_EXIT, p_otherObject);
 }
 
 OvCore::Scripting::LuaScriptEngine::LuaScriptEngine()
@@ -271,8 +507,23 @@ void OvCore::Scripting::LuaScriptEngine::CreateContext()
 {
 	OVASSERT(m_context.luaState == nullptr, "A Lua context already exists!");
 
-	m_context.luaState = std::make_unique<sol::state>();
+	if (!m_context.chunkCache)
+	{
+		m_context.chunkCache = std::make_unique<LuaChunkCache>();
+	}
+
+	if (!m_context.profiler)
+	{
+		m_context.profiler = std::make_unique<LuaProfiler>();
+	}
+
+	// The profiler allocates the memory of the state, to keep track of its heap
+	m_context.profiler->ResetMemoryStatistics();
+	m_context.profiler->ResetStatistics();
+	m_context.luaState = std::make_unique<sol::state>(&sol::default_at_panic, &LuaProfiler::Allocate, m_context.profiler.get());
+
 	m_context.luaState->open_libraries(sol::lib::base, sol::lib::math);
+	m_context.coroutineScheduler = std::make_unique<LuaCoroutineScheduler>(m_context.luaState->lua_state());
 
 	for (auto& callback : luaBindings)
 	{
@@ -285,7 +536,7 @@ void OvCore::Scripting::LuaScriptEngine::CreateContext()
 		[this](std::reference_wrapper<OvCore::ECS::Components::Behaviour> behaviour) {
 			const auto scriptFileName = behaviour.get().name + GetDefaultExtension();
 			const auto scriptPath = m_context.scriptRootFolder / scriptFileName;
-			if (!RegisterBehaviour(*m_context.luaState, behaviour.get(), scriptPath.string()))
+			if (!RegisterBehaviour(m_context, behaviour.get(), scriptPath.string()))
 			{
 				++m_context.errorCount;
 			}
@@ -310,5 +561,30 @@ void OvCore::Scripting::LuaScriptEngine::DestroyContext()
 		}
 	);
 
+	// Chunks reference the Lua state, only their bytecode is kept for the next context
+	for (auto& [path, entry] : m_context.chunkCache->entries)
+	{
+		entry.chunk.reset();
+	}
+
+	// Coroutines are Lua threads, they can't outlive the state
+	m_context.coroutineScheduler.reset();
 	m_context.luaState.reset();
 }
+
+void OvCore::Scripting::LuaScriptEngine::SetBytecodeCacheFolder(const std::filesystem::path& p_folder)
+{
+	m_context.bytecodeCacheFolder = p_folder;
+}
+
+OvCore::Scripting::LuaCoroutineScheduler& OvCore::Scripting::LuaScriptEngine::GetCoroutineScheduler()
+{
+	OVASSERT(m_context.coroutineScheduler != nullptr, "No valid Lua context");
+	return *m_context.coroutineScheduler;
+}
+
+OvCore::Scripting::LuaProfiler& OvCore::Scripting::LuaScriptEngine::GetProfiler()
+{
+	OVASSERT(m_context.profiler != nullptr, "No valid Lua context");
+	return *m_context.profiler;
+}
@@ -56,6 +56,11 @@ bool OvCore::Scripting::NullScriptEngineBase::IsOk() const
 	return true;
 }
 
+template<>
+void OvCore::Scripting::NullScriptEngineBase::Update(float p_deltaTime)
+{
+}
+
 template<>
 void OvCore::Scripting::NullScriptEngineBase::OnAwake(OvCore::ECS::Components::Behaviour& p_target)
 {
@@ -0,0 +1,141 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "OvDebug/ILogHandler.h"
+
+namespace OvDebug
+{
+	/**
+	* Defines what happens to a log when the queue is full
+	*/
+	enum class ELogOverflowPolicy
+	{
+		DROP,	// The log is discarded (Dropped logs are counted and reported)
+		BLOCK	// The caller waits until the queue has room
+	};
+
+	/**
+	* Settings of the asynchronous logger
+	*/
+	struct AsyncLoggerSettings
+	{
+		uint32_t capacity = 8192;									// Rounded up to a power of two
+		ELogOverflowPolicy overflowPolicy = ELogOverflowPolicy::DROP;
+		std::chrono::milliseconds flushInterval{ 100 };			// Maximum delay before written logs are flushed
+		ELogLevel flushLevel = ELogLevel::LOG_ERROR;				// Logs from this level are flushed right away
+	};
+
+	/**
+	* Log as queued by the caller. The date is formatted later, by the writing thread
+	*/
+	struct LogRecord
+	{
+		std::string message;
+		std::string handlerId;
+		ELogLevel logLevel = ELogLevel::LOG_DEFAULT;
+		ELogMode logMode = ELogMode::DEFAULT;
+		std::chrono::system_clock::time_point time;
+	};
+
+	/**
+	* Queues logs from any thread without locking, and hands them to a writer on a background thread, in batches.
+	* Logs are stored in a fixed ring buffer: once their strings have grown, pushing a log doesn't allocate
+	*/
+	class AsyncLogger
+	{
+	public:
+		using WriteCallback = std::function<void(const LogRecord&)>;
+		using FlushCallback = std::function<void()>;
+
+		/**
+		* Constructor of the asynchronous logger, starts the writing thread
+		* @param p_settings
+		* @param p_write (Called by the writing thread for each log)
+		* @param p_flush (Called by the writing thread once written logs have to be flushed)
+		*/
+		AsyncLogger(const AsyncLoggerSettings& p_settings, WriteCallback p_write, FlushCallback p_flush);
+
+		/**
+		* Destructor of the asynchronous logger, writes the remaining logs and stops the writing thread
+		*/
+		~AsyncLogger();
+
+		AsyncLogger(const AsyncLogger&) = delete;
+		AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+		/**
+		* Queue a log. Returns false if it got dropped (Queue full with the DROP policy)
+		* @param p_message
+		* @param p_logLevel
+		* @param p_logMode
+		* @param p_handlerId
+		*/
+		bool Push(const std::string& p_message, ELogLevel p_logLevel, ELogMode p_logMode, const std::string& p_handlerId);
+
+		/**
+		* Wait until every log queued before this call is written and flushed
+		*/
+		void Flush();
+
+		/**
+		* Returns the number of logs dropped since the logger started
+		*/
+		uint64_t GetDroppedCount() const;
+
+		/**
+		* Returns the settings of the logger
+		*/
+		const AsyncLoggerSettings& GetSettings() const;
+
+	private:
+		struct Slot
+		{
+			std::atomic<uint64_t> sequence;
+			LogRecord record;
+		};
+
+		void Run();
+		bool WriteAvailable(bool& p_urgent);
+		bool HasReadyRecord() const;
+		void WakeWriter();
+
+	private:
+		const AsyncLoggerSettings m_settings;
+		const WriteCallback m_write;
+		const FlushCallback m_flush;
+
+		std::unique_ptr<Slot[]> m_slots;
+		uint64_t m_mask = 0;
+
+		alignas(64) std::atomic<uint64_t> m_enqueuePosition = 0;
+		alignas(64) uint64_t m_dequeuePosition = 0;
+		std::atomic<uint64_t> m_flushedPosition = 0;
+		std::atomic<uint64_t> m_droppedCount = 0;
+		uint64_t m_reportedDropCount = 0;
+
+		std::atomic<bool> m_running = true;
+		std::atomic<bool> m_writerSleeping = false;
+		std::atomic<bool> m_flushRequested = false;
+		std::mutex m_wakeMutex;
+		std::condition_variable m_wakeCondition;
+		std::mutex m_flushMutex;
+		std::condition_variable m_flushCondition;
+
+		std::thread m_thread;
+	};
+}
@@ -25,6 +25,11 @@ namespace OvDebug
 		*/
 		void Log(const LogData& p_logData);
 
+		/**
+		* Flush the console output
+		*/
+		static void Flush();
+
 	private:
 		static std::string GetLogHeader(ELogLevel p_logLevel);
 
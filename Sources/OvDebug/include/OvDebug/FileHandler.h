@@ -24,6 +24,11 @@ namespace OvDebug
 		* Log the the file
 		*/
 		void Log(const LogData& p_logData);
+
+		/**
+		* Flush the log file (Logs are buffered until then)
+		*/
+		static void Flush();
 	
 		/**
 		* Returns the log file path
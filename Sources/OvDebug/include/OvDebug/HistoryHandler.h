@@ -6,15 +6,16 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
-#include <queue>
+#include <vector>
 
 #include "ILogHandler.h"
 
 namespace OvDebug
 {
 	/*
-	* Treat the log in a history queue
+	* Treat the log in a history, keeping the most recent logs only (Older ones are overwritten once it is full)
 	*/
 	class HistoryHandler : public ILogHandler
 	{
@@ -26,12 +27,30 @@ namespace OvDebug
 		void Log(const LogData& p_logData);
 
 		/**
-		* Return log queue
+		* Defines the maximum number of logs kept (The most recent ones are kept when shrinking)
+		* @param p_capacity
 		*/
-		static std::queue<LogData>& GetLogQueue();
+		static void SetCapacity(size_t p_capacity);
 
-	private:
+		/**
+		* Returns the maximum number of logs kept
+		*/
+		static size_t GetCapacity();
+
+		/**
+		* Returns the logs of the history, from the oldest to the most recent
+		*/
+		static std::vector<LogData> GetLogs();
 
-		static std::queue<LogData> LOG_QUEUE;
+		/**
+		* Remove every log from the history
+		*/
+		static void Clear();
+
+	private:
+		static std::vector<LogData> LOG_HISTORY;
+		static size_t LOG_HISTORY_START;
+		static size_t LOG_HISTORY_CAPACITY;
+		static std::mutex LOG_HISTORY_MUTEX;
 	};
-}
\ No newline at end of file
+}
@@ -7,29 +7,61 @@
 #pragma once
 
 #include <string>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <OvTools/Eventing/Event.h>
 
 #include "OvDebug/ILogHandler.h"
+#include "OvDebug/AsyncLogger.h"
 #include "OvDebug/ConsoleHandler.h"
 #include "OvDebug/FileHandler.h"
 #include "OvDebug/HistoryHandler.h"
 
-#define OVLOG(message)			OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_DEFAULT,	OvDebug::ELogMode::CONSOLE)
-#define OVLOG_INFO(message)		OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_INFO,		OvDebug::ELogMode::CONSOLE)
-#define OVLOG_WARNING(message)	OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_WARNING,	OvDebug::ELogMode::CONSOLE)
-#define OVLOG_ERROR(message)	OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_ERROR,	OvDebug::ELogMode::CONSOLE)
+/*
+* Logs below this level are stripped at compile time: their message isn't even built.
+* 0 = Default, 1 = Info, 2 = Warning, 3 = Error (Follows ELogLevel)
+*/
+#if !defined(OVLOG_MIN_LEVEL)
+#define OVLOG_MIN_LEVEL 0
+#endif
 
-#define OVFLOG(message)			OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_DEFAULT, 	OvDebug::ELogMode::CONSOLE); OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_DEFAULT, OvDebug::ELogMode::FILE)
-#define OVFLOG_INFO(message)	OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_INFO, 	OvDebug::ELogMode::CONSOLE); OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_INFO, 	OvDebug::ELogMode::FILE)
-#define OVFLOG_WARNING(message)	OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_WARNING, 	OvDebug::ELogMode::CONSOLE); OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_WARNING, OvDebug::ELogMode::FILE)
-#define OVFLOG_ERROR(message)	OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_ERROR, 	OvDebug::ELogMode::CONSOLE); OvDebug::Logger::Log(message, OvDebug::ELogLevel::LOG_ERROR, 	OvDebug::ELogMode::FILE)
+/*
+* The message is only evaluated if the level passes both the compile-time and the runtime minimum level
+*/
+#define OVLOG_IMPL(message, level, ...) \
+	do \
+	{ \
+		if constexpr (static_cast<int>(level) >= OVLOG_MIN_LEVEL) \
+		{ \
+			if (OvDebug::Logger::IsLevelEnabled(level)) \
+			{ \
+				const std::string& ovlogMessage = message; \
+				for (const auto ovlogMode : { __VA_ARGS__ }) \
+					OvDebug::Logger::Log(ovlogMessage, level, ovlogMode); \
+			} \
+		} \
+	} while (false)
+
+#define OVLOG(message)			OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_DEFAULT,	OvDebug::ELogMode::CONSOLE)
+#define OVLOG_INFO(message)		OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_INFO,		OvDebug::ELogMode::CONSOLE)
+#define OVLOG_WARNING(message)	OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_WARNING,	OvDebug::ELogMode::CONSOLE)
+#define OVLOG_ERROR(message)	OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_ERROR,		OvDebug::ELogMode::CONSOLE)
+
+#define OVFLOG(message)			OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_DEFAULT,	OvDebug::ELogMode::CONSOLE, OvDebug::ELogMode::FILE)
+#define OVFLOG_INFO(message)	OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_INFO,		OvDebug::ELogMode::CONSOLE, OvDebug::ELogMode::FILE)
+#define OVFLOG_WARNING(message)	OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_WARNING,	OvDebug::ELogMode::CONSOLE, OvDebug::ELogMode::FILE)
+#define OVFLOG_ERROR(message)	OVLOG_IMPL(message, OvDebug::ELogLevel::LOG_ERROR,		OvDebug::ELogMode::CONSOLE, OvDebug::ELogMode::FILE)
 
 namespace OvDebug
 {
 	/*
-	* Static class to display error messages on console or file
+	* Static class to display error messages on console or file.
+	* Logs are written by the calling thread, unless the asynchronous mode is enabled: they are then queued and written
+	* in batches by a background thread, and LogEvent is invoked by DispatchEvents
 	*/
 	class Logger
 	{
@@ -85,10 +117,61 @@ namespace OvDebug
 		*/
 		static HistoryHandler& GetHistoryHandler(std::string p_id);
 
+		/**
+		* Write the next logs from a background thread. Logging from any thread is then safe.
+		* Must be called while no other thread logs
+		* @param p_settings
+		*/
+		static void EnableAsync(const AsyncLoggerSettings& p_settings = {});
+
+		/**
+		* Write the queued logs, then write the next ones from the calling thread again.
+		* Must be called while no other thread logs
+		*/
+		static void DisableAsync();
+
+		/**
+		* Returns true if logs are written from a background thread
+		*/
+		static bool IsAsync();
+
+		/**
+		* Wait until every log is written and flushed
+		*/
+		static void Flush();
+
+		/**
+		* Invoke LogEvent for the logs written since the last call. Needed in asynchronous mode only, LogEvent
+		* listeners are then called from the thread calling this (Usually the main thread, once per frame)
+		*/
+		static void DispatchEvents();
+
+		/**
+		* Defines the minimum level of the logs to write. Logs below are discarded before their message is built
+		* (When logged through the OVLOG macros). OVLOG_MIN_LEVEL strips them at compile time instead
+		* @param p_logLevel
+		*/
+		static void SetMinLevel(ELogLevel p_logLevel);
+
+		/**
+		* Returns the minimum level of the logs to write
+		*/
+		static ELogLevel GetMinLevel();
+
+		/**
+		* Returns true if logs of the given level are written
+		* @param p_logLevel
+		*/
+		static bool IsLevelEnabled(ELogLevel p_logLevel);
+
 	private:
 		template<typename T>
 		static void LogToHandlerMap(std::map<std::string, T>& p_map, const LogData& p_data, std::string p_id);
 
+		static void LogToHandlers(const LogData& p_data, ELogMode p_logMode, const std::string& p_handlerId);
+		static void WriteRecord(const LogRecord& p_record);
+		static void FlushHandlers();
+
 	public:
 		static OvTools::Eventing::Event<const LogData&> LogEvent;
 
@@ -96,6 +179,13 @@ namespace OvDebug
 		static std::map<std::string, ConsoleHandler>	CONSOLE_HANDLER_MAP;
 		static std::map<std::string, FileHandler>		FILE_HANDLER_MAP;
 		static std::map<std::string, HistoryHandler>	HISTORY_HANDLER_MAP;
+		static std::mutex								HANDLERS_MUTEX;
+
+		static std::vector<LogData>						PENDING_EVENTS;
+		static std::mutex								PENDING_EVENTS_MUTEX;
+
+		static std::unique_ptr<AsyncLogger>				ASYNC_LOGGER;
+		static std::atomic<ELogLevel>					MIN_LOG_LEVEL;
 	};
 }
 
@@ -10,6 +10,11 @@
 
 namespace OvDebug
 {
+	inline bool Logger::IsLevelEnabled(ELogLevel p_logLevel)
+	{
+		return p_logLevel >= MIN_LOG_LEVEL.load(std::memory_order_relaxed);
+	}
+
 	template<typename T>
 	inline void Logger::LogToHandlerMap(std::map<std::string, T>& p_map, const LogData & p_data, std::string p_id)
 	{
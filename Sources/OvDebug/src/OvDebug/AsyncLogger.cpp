@@ -0,0 +1,230 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <bit>
+
+#include "OvDebug/AsyncLogger.h"
+
+OvDebug::AsyncLogger::AsyncLogger(const AsyncLoggerSettings& p_settings, WriteCallback p_write, FlushCallback p_flush) :
+	m_settings(p_settings),
+	m_write(std::move(p_write)),
+	m_flush(std::move(p_flush))
+{
+	const uint64_t capacity = std::bit_ceil(std::max<uint64_t>(m_settings.capacity, 2));
+
+	m_slots = std::make_unique<Slot[]>(capacity);
+	m_mask = capacity - 1;
+
+	// A slot is free for the producer at position N when its sequence is N, and ready to be written at N + 1
+	for (uint64_t i = 0; i < capacity; ++i)
+	{
+		m_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	m_thread = std::thread(&AsyncLogger::Run, this);
+}
+
+OvDebug::AsyncLogger::~AsyncLogger()
+{
+	m_running.store(false);
+
+	{
+		// The writer might be checking its wake up condition, it has to see the logger stopping
+		std::lock_guard lock(m_wakeMutex);
+	}
+
+	m_wakeCondition.notify_one();
+	m_thread.join();
+}
+
+bool OvDebug::AsyncLogger::Push(const std::string& p_message, ELogLevel p_logLevel, ELogMode p_logMode, const std::string& p_handlerId)
+{
+	uint64_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+
+	while (true)
+	{
+		slot = &m_slots[position & m_mask];
+		const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+		const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+		if (difference == 0)
+		{
+			if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (difference < 0)
+		{
+			// The slot still holds a log from the previous lap: the queue is full
+			if (m_settings.overflowPolicy == ELogOverflowPolicy::DROP)
+			{
+				m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			WakeWriter();
+			std::this_thread::yield();
+			position = m_enqueuePosition.load(std::memory_order_relaxed);
+		}
+		else
+		{
+			// Another producer took this position
+			position = m_enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	// Assigning keeps the capacity of the strings of the slot, they stop allocating once large enough
+	auto& record = slot->record;
+	record.message.assign(p_message);
+	record.handlerId.assign(p_handlerId);
+	record.logLevel = p_logLevel;
+	record.logMode = p_logMode;
+	record.time = std::chrono::system_clock::now();
+
+	// Sequentially consistent, so that either the writer sees this log before sleeping, or this sees the writer sleeping
+	slot->sequence.store(position + 1, std::memory_order_seq_cst);
+
+	if (m_writerSleeping.load())
+	{
+		WakeWriter();
+	}
+
+	return true;
+}
+
+void OvDebug::AsyncLogger::Flush()
+{
+	const uint64_t target = m_enqueuePosition.load(std::memory_order_acquire);
+
+	std::unique_lock lock(m_flushMutex);
+
+	while (m_flushedPosition.load(std::memory_order_acquire) < target)
+	{
+		m_flushRequested.store(true);
+		WakeWriter();
+		m_flushCondition.wait_for(lock, std::chrono::milliseconds(10));
+	}
+}
+
+uint64_t OvDebug::AsyncLogger::GetDroppedCount() const
+{
+	return m_droppedCount.load(std::memory_order_relaxed);
+}
+
+const OvDebug::AsyncLoggerSettings& OvDebug::AsyncLogger::GetSettings() const
+{
+	return m_settings;
+}
+
+void OvDebug::AsyncLogger::Run()
+{
+	auto lastFlush = std::chrono::steady_clock::now();
+	bool unflushed = false;
+
+	while (true)
+	{
+		bool urgent = false;
+		const bool wrote = WriteAvailable(urgent);
+		const bool flushRequested = m_flushRequested.exchange(false);
+		const bool running = m_running.load();
+		const auto now = std::chrono::steady_clock::now();
+
+		unflushed |= wrote;
+
+		if (unflushed && (urgent || flushRequested || !running || now - lastFlush >= m_settings.flushInterval))
+		{
+			m_flush();
+			unflushed = false;
+			lastFlush = now;
+		}
+
+		if (!unflushed && (flushRequested || m_flushedPosition.load(std::memory_order_relaxed) != m_dequeuePosition))
+		{
+			{
+				std::lock_guard lock(m_flushMutex);
+				m_flushedPosition.store(m_dequeuePosition, std::memory_order_release);
+			}
+
+			m_flushCondition.notify_all();
+		}
+
+		if (!wrote)
+		{
+			if (!running)
+			{
+				break;
+			}
+
+			// Producers only wake the writer up if it sleeps, the timeout covers the pending flush
+			std::unique_lock lock(m_wakeMutex);
+			m_writerSleeping.store(true);
+			m_wakeCondition.wait_for(lock, m_settings.flushInterval, [this]
+			{
+				return !m_writerSleeping.load() || !m_running.load() || HasReadyRecord();
+			});
+			m_writerSleeping.store(false);
+		}
+	}
+}
+
+bool OvDebug::AsyncLogger::WriteAvailable(bool& p_urgent)
+{
+	bool wrote = false;
+
+	if (const uint64_t droppedCount = m_droppedCount.load(std::memory_order_relaxed); droppedCount != m_reportedDropCount)
+	{
+		LogRecord report;
+		report.message = std::to_string(droppedCount - m_reportedDropCount) + " log(s) dropped, the log queue was full";
+		report.handlerId = "default";
+		report.logLevel = ELogLevel::LOG_WARNING;
+		report.logMode = ELogMode::CONSOLE;
+		report.time = std::chrono::system_clock::now();
+
+		m_write(report);
+		m_reportedDropCount = droppedCount;
+		wrote = true;
+	}
+
+	while (true)
+	{
+		Slot& slot = m_slots[m_dequeuePosition & m_mask];
+
+		if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1)
+		{
+			break;
+		}
+
+		m_write(slot.record);
+		p_urgent |= slot.record.logLevel >= m_settings.flushLevel;
+
+		// Hand the slot back to the producers, for the next lap
+		slot.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+		++m_dequeuePosition;
+		wrote = true;
+	}
+
+	return wrote;
+}
+
+bool OvDebug::AsyncLogger::HasReadyRecord() const
+{
+	return m_slots[m_dequeuePosition & m_mask].sequence.load() == m_dequeuePosition + 1;
+}
+
+void OvDebug::AsyncLogger::WakeWriter()
+{
+	if (m_writerSleeping.exchange(false))
+	{
+		{
+			std::lock_guard lock(m_wakeMutex);
+		}
+
+		m_wakeCondition.notify_one();
+	}
+}
@@ -34,11 +34,16 @@ void OvDebug::ConsoleHandler::Log(const LogData& p_logData)
 
 	std::ostream& output = p_logData.logLevel == ELogLevel::LOG_ERROR ? std::cerr : std::cout;
 
-	output << GetLogHeader(p_logData.logLevel) << p_logData.date << " " << p_logData.message << std::endl;
+	output << GetLogHeader(p_logData.logLevel) << p_logData.date << " " << p_logData.message << '\n';
 
 	std::cout << COLOR_DEFAULT;
 }
 
+void OvDebug::ConsoleHandler::Flush()
+{
+	std::cout.flush();
+}
+
 std::string OvDebug::ConsoleHandler::GetLogHeader(ELogLevel p_logLevel)
 {
 	switch (p_logLevel)
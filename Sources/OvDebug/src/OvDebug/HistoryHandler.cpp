@@ -4,16 +4,75 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+
 #include "OvDebug/HistoryHandler.h"
 
-std::queue<OvDebug::LogData> OvDebug::HistoryHandler::LOG_QUEUE;
+std::vector<OvDebug::LogData> OvDebug::HistoryHandler::LOG_HISTORY;
+size_t OvDebug::HistoryHandler::LOG_HISTORY_START = 0;
+size_t OvDebug::HistoryHandler::LOG_HISTORY_CAPACITY = 1024;
+std::mutex OvDebug::HistoryHandler::LOG_HISTORY_MUTEX;
 
 void OvDebug::HistoryHandler::Log(const LogData& p_logData)
 {
-	LOG_QUEUE.push(p_logData);
+	std::lock_guard lock(LOG_HISTORY_MUTEX);
+
+	if (LOG_HISTORY_CAPACITY == 0)
+	{
+		return;
+	}
+
+	if (LOG_HISTORY.size() < LOG_HISTORY_CAPACITY)
+	{
+		LOG_HISTORY.push_back(p_logData);
+		return;
+	}
+
+	// Full: the oldest log is overwritten (Reusing the memory of its strings)
+	auto& oldest = LOG_HISTORY[LOG_HISTORY_START];
+	oldest.message.assign(p_logData.message);
+	oldest.date.assign(p_logData.date);
+	oldest.logLevel = p_logData.logLevel;
+	LOG_HISTORY_START = (LOG_HISTORY_START + 1) % LOG_HISTORY_CAPACITY;
+}
+
+void OvDebug::HistoryHandler::SetCapacity(size_t p_capacity)
+{
+	std::lock_guard lock(LOG_HISTORY_MUTEX);
+
+	// Put the logs back in order, dropping the oldest ones that don't fit anymore
+	std::rotate(LOG_HISTORY.begin(), LOG_HISTORY.begin() + LOG_HISTORY_START, LOG_HISTORY.end());
+	LOG_HISTORY_START = 0;
+
+	if (LOG_HISTORY.size() > p_capacity)
+	{
+		LOG_HISTORY.erase(LOG_HISTORY.begin(), LOG_HISTORY.end() - p_capacity);
+	}
+
+	LOG_HISTORY.shrink_to_fit();
+	LOG_HISTORY_CAPACITY = p_capacity;
+}
+
+size_t OvDebug::HistoryHandler::GetCapacity()
+{
+	std::lock_guard lock(LOG_HISTORY_MUTEX);
+	return LOG_HISTORY_CAPACITY;
 }
 
-std::queue<OvDebug::LogData>& OvDebug::HistoryHandler::GetLogQueue()
+std::vector<OvDebug::LogData> OvDebug::HistoryHandler::GetLogs()
 {
-	return LOG_QUEUE;
-}
\ No newline at end of file
+	std::lock_guard lock(LOG_HISTORY_MUTEX);
+
+	std::vector<LogData> logs;
+	logs.reserve(LOG_HISTORY.size());
+	logs.insert(logs.end(), LOG_HISTORY.begin() + LOG_HISTORY_START, LOG_HISTORY.end());
+	logs.insert(logs.end(), LOG_HISTORY.begin(), LOG_HISTORY.begin() + LOG_HISTORY_START);
+	return logs;
+}
+
+void OvDebug::HistoryHandler::Clear()
+{
+	std::lock_guard lock(LOG_HISTORY_MUTEX);
+	LOG_HISTORY.clear();
+	LOG_HISTORY_START = 0;
+}
@@ -5,65 +5,212 @@
 */
 
 #include <cstdint>
+#include <cstdlib>
+#include <ctime>
 
 #include "OvDebug/Logger.h"
 #include "OvTools/Time/Date.h"
 
+namespace
+{
+	// Pending events are capped, in case they never get dispatched
+	constexpr size_t kMaxPendingEvents = 4096;
+
+	// Only used by the writing thread: the date is formatted once per second at most
+	std::time_t lastRecordTime = -1;
+	std::string lastRecordDate;
+}
+
 OvTools::Eventing::Event<const OvDebug::LogData&> OvDebug::Logger::LogEvent;
 
 std::map<std::string, OvDebug::ConsoleHandler>	OvDebug::Logger::CONSOLE_HANDLER_MAP;
 std::map<std::string, OvDebug::FileHandler>		OvDebug::Logger::FILE_HANDLER_MAP;
 std::map<std::string, OvDebug::HistoryHandler>	OvDebug::Logger::HISTORY_HANDLER_MAP;
+std::mutex										OvDebug::Logger::HANDLERS_MUTEX;
+
+std::vector<OvDebug::LogData>					OvDebug::Logger::PENDING_EVENTS;
+std::mutex										OvDebug::Logger::PENDING_EVENTS_MUTEX;
+
+std::unique_ptr<OvDebug::AsyncLogger>			OvDebug::Logger::ASYNC_LOGGER;
+std::atomic<OvDebug::ELogLevel>					OvDebug::Logger::MIN_LOG_LEVEL = OvDebug::ELogLevel::LOG_DEFAULT;
 
 void OvDebug::Logger::Log(const std::string& p_message, ELogLevel p_logLevel, ELogMode p_logMode, std::string p_handlerId)
 {
+	if (!IsLevelEnabled(p_logLevel))
+	{
+		return;
+	}
+
+	if (ASYNC_LOGGER)
+	{
+		ASYNC_LOGGER->Push(p_message, p_logLevel, p_logMode, p_handlerId);
+		return;
+	}
+
 	LogData logData{ p_message, p_logLevel, OvTools::Time::Date::GetDateAsString() };
 
+	{
+		std::lock_guard lock(HANDLERS_MUTEX);
+		LogToHandlers(logData, p_logMode, p_handlerId);
+		FlushHandlers();
+	}
+
+	LogEvent.Invoke(logData);
+}
+
+void OvDebug::Logger::LogToHandlers(const LogData& p_data, ELogMode p_logMode, const std::string& p_handlerId)
+{
 	switch (p_logMode)
 	{
 	case ELogMode::DEFAULT:
-	case ELogMode::CONSOLE: LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, logData, p_handlerId); break;
-	case ELogMode::FILE:	LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, logData, p_handlerId);		break;
-	case ELogMode::HISTORY: LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, logData, p_handlerId);	break;
+	case ELogMode::CONSOLE: LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, p_data, p_handlerId); break;
+	case ELogMode::FILE:	LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, p_data, p_handlerId);		break;
+	case ELogMode::HISTORY: LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, p_data, p_handlerId);	break;
 	case ELogMode::ALL:
-		LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, logData, p_handlerId);
-		LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, logData, p_handlerId);
-		LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, logData, p_handlerId);
+		LogToHandlerMap<ConsoleHandler>(CONSOLE_HANDLER_MAP, p_data, p_handlerId);
+		LogToHandlerMap<FileHandler>(FILE_HANDLER_MAP, p_data, p_handlerId);
+		LogToHandlerMap<HistoryHandler>(HISTORY_HANDLER_MAP, p_data, p_handlerId);
 		break;
 	}
+}
 
-	LogEvent.Invoke(logData);
+void OvDebug::Logger::WriteRecord(const LogRecord& p_record)
+{
+	if (const std::time_t time = std::chrono::system_clock::to_time_t(p_record.time); time != lastRecordTime)
+	{
+		lastRecordTime = time;
+		lastRecordDate = OvTools::Time::Date::GetDateAsString(time);
+	}
+
+	LogData logData{ p_record.message, p_record.logLevel, lastRecordDate };
+
+	{
+		std::lock_guard lock(HANDLERS_MUTEX);
+		LogToHandlers(logData, p_record.logMode, p_record.handlerId);
+	}
+
+	std::lock_guard lock(PENDING_EVENTS_MUTEX);
+
+	if (PENDING_EVENTS.size() < kMaxPendingEvents)
+	{
+		PENDING_EVENTS.push_back(std::move(logData));
+	}
+}
+
+void OvDebug::Logger::FlushHandlers()
+{
+	ConsoleHandler::Flush();
+	FileHandler::Flush();
+}
+
+void OvDebug::Logger::EnableAsync(const AsyncLoggerSettings& p_settings)
+{
+	// Handlers and their streams are static: the remaining logs have to be written before static destruction
+	static const bool stopAtExit = std::atexit([] { ASYNC_LOGGER.reset(); }) == 0;
+	(void)stopAtExit;
+
+	ASYNC_LOGGER.reset();
+
+	ASYNC_LOGGER = std::make_unique<AsyncLogger>(p_settings, &Logger::WriteRecord, []
+	{
+		std::lock_guard lock(HANDLERS_MUTEX);
+		FlushHandlers();
+	});
+}
+
+void OvDebug::Logger::DisableAsync()
+{
+	ASYNC_LOGGER.reset();
+	DispatchEvents();
+}
+
+bool OvDebug::Logger::IsAsync()
+{
+	return ASYNC_LOGGER != nullptr;
+}
+
+void OvDebug::Logger::Flush()
+{
+	if (ASYNC_LOGGER)
+	{
+		ASYNC_LOGGER->Flush();
+	}
+	else
+	{
+		std::lock_guard lock(HANDLERS_MUTEX);
+		FlushHandlers();
+	}
+}
+
+void OvDebug::Logger::SetMinLevel(ELogLevel p_logLevel)
+{
+	MIN_LOG_LEVEL.store(p_logLevel, std::memory_order_relaxed);
+}
+
+OvDebug::ELogLevel OvDebug::Logger::GetMinLevel()
+{
+	return MIN_LOG_LEVEL.load(std::memory_order_relaxed);
+}
+
+void OvDebug::Logger::DispatchEvents()
+{
+	std::vector<LogData> events;
+
+	{
+		std::lock_guard lock(PENDING_EVENTS_MUTEX);
+		events.swap(PENDING_EVENTS);
+	}
+
+	for (const auto& logData : events)
+	{
+		LogEvent.Invoke(logData);
+	}
+
+	// Giving the memory back keeps the vector from reallocating as it grows again
+	events.clear();
+	std::lock_guard lock(PENDING_EVENTS_MUTEX);
+
+	if (PENDING_EVENTS.empty())
+	{
+		PENDING_EVENTS.swap(events);
+	}
 }
 
 OvDebug::ConsoleHandler& OvDebug::Logger::CreateConsoleHandler(std::string p_id)
 {
+	std::lock_guard lock(HANDLERS_MUTEX);
 	CONSOLE_HANDLER_MAP.emplace(p_id, OvDebug::ConsoleHandler());
 	return CONSOLE_HANDLER_MAP[p_id];
 }
 
 OvDebug::FileHandler& OvDebug::Logger::CreateFileHandler(std::string p_id)
 {
+	std::lock_guard lock(HANDLERS_MUTEX);
 	FILE_HANDLER_MAP.emplace(p_id, OvDebug::FileHandler());
 	return FILE_HANDLER_MAP[p_id];
 }
 
 OvDebug::HistoryHandler& OvDebug::Logger::CreateHistoryHandler(std::string p_id)
 {
+	std::lock_guard lock(HANDLERS_MUTEX);
 	HISTORY_HANDLER_MAP.emplace(p_id, OvDebug::HistoryHandler());
 	return HISTORY_HANDLER_MAP[p_id];
 }
 
 OvDebug::ConsoleHandler& OvDebug::Logger::GetConsoleHandler(std::string p_id)
 {
+	std::lock_guard lock(HANDLERS_MUTEX);
 	return CONSOLE_HANDLER_MAP[p_id];
 }
 
 OvDebug::FileHandler& OvDebug::Logger::GetFileHandler(std::string p_id)
 {
+	std::lock_guard lock(HANDLERS_MUTEX);
 	return FILE_HANDLER_MAP[p_id];
 }
 
 OvDebug::HistoryHandler& OvDebug::Logger::GetHistoryHandler(std::string p_id)
 {
+	std::lock_guard lock(HANDLERS_MUTEX);
 	return HISTORY_HANDLER_MAP[p_id];
 }
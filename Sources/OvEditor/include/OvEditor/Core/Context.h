@@ -11,6 +11,7 @@
 #include <OvAudio/Core/AudioEngine.h>
 #include <OvCore/ResourceManagement/MaterialManager.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/PrefabManager.h>
 #include <OvCore/ResourceManagement/ShaderManager.h>
 #include <OvCore/ResourceManagement/SoundManager.h>
 #include <OvCore/ResourceManagement/TextureManager.h>
@@ -21,6 +22,7 @@
 #include <OvPhysics/Core/PhysicsEngine.h>
 #include <OvRendering/HAL/UniformBuffer.h>
 #include <OvRendering/HAL/ShaderStorageBuffer.h>
+#include <OvTools/Eventing/EventQueue.h>
 #include <OvTools/Filesystem/IniFile.h>
 #include <OvWindowing/Window.h>
 #include <OvUI/Core/UIManager.h>
@@ -82,6 +84,8 @@ namespace OvEditor::Core
 
 		std::unique_ptr<OvCore::Scripting::ScriptEngine> scriptEngine;
 
+		OvTools::Eventing::EventQueue eventQueue;
+
 		OvCore::SceneSystem::SceneManager sceneManager;
 
 		OvCore::ResourceManagement::ModelManager modelManager;
@@ -89,6 +93,7 @@ namespace OvEditor::Core
 		OvCore::ResourceManagement::ShaderManager shaderManager;
 		OvCore::ResourceManagement::MaterialManager materialManager;
 		OvCore::ResourceManagement::SoundManager soundManager;
+		OvCore::ResourceManagement::PrefabManager prefabManager;
 
 		OvWindowing::Settings::WindowSettings windowSettings;
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/SceneSystem/SceneSnapshot.h>
 #include <OvEditor/Core/Context.h>
 #include <OvEditor/Core/PanelsManager.h>
 #include <OvTools/Filesystem/IniFile.h>
@@ -18,11 +19,6 @@
 #define EDITOR_CONTEXT(instance) OvCore::Global::ServiceLocator::Get<OvEditor::Core::EditorActions>().GetContext().instance
 #define EDITOR_PANEL(type, id) OvCore::Global::ServiceLocator::Get<OvEditor::Core::EditorActions>().GetPanelsManager().GetPanelAs<type>(id)
 
-namespace tinyxml2
-{
-	class XMLDocument;
-}
-
 namespace OvEditor::Core
 {
 	enum class EGizmoOperation;
@@ -210,6 +206,20 @@ namespace OvEditor::Core
 		* @param bool
 		*/
 		void DuplicateActor(OvCore::ECS::Actor& p_toDuplicate, OvCore::ECS::Actor* p_forcedParent = nullptr, bool p_focus = true);
+
+		/**
+		* Ask the user for a destination and save the given actor (And its descendants) as a prefab
+		* @param p_actor
+		*/
+		void SaveActorAsPrefab(OvCore::ECS::Actor& p_actor);
+
+		/**
+		* Create an instance of the prefab identified by the given path in the current scene
+		* (Returns nullptr if the prefab can't be loaded)
+		* @param p_path
+		* @param p_focusOnCreation
+		*/
+		OvCore::ECS::Actor* InstantiatePrefab(const std::string& p_path, bool p_focusOnCreation = true);
 		#pragma endregion
 
 		#pragma region ACTOR_MANIPULATION
@@ -337,6 +347,13 @@ namespace OvEditor::Core
 		*/
 		void SaveSceneToDisk(OvCore::SceneSystem::Scene& p_scene, const std::string& p_path);
 
+		/**
+		* Convert the given scene file to the binary or XML format (Returns true on success)
+		* @param p_path
+		* @param p_toBinary
+		*/
+		bool ConvertSceneFile(const std::string& p_path, bool p_toBinary);
+
 		/**
 		* Load a scene from the disk
 		* @param p_path
@@ -426,7 +443,7 @@ namespace OvEditor::Core
 
 		std::vector<std::pair<uint32_t, std::function<void()>>> m_delayedActions;
 
-		std::unique_ptr<tinyxml2::XMLDocument> m_sceneBackup;
+		OvCore::SceneSystem::SceneSnapshot m_sceneSnapshot;
 	};
 }
 
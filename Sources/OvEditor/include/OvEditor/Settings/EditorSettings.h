@@ -98,5 +98,6 @@ namespace OvEditor::Settings
 		inline static Property<int> ColorTheme = { static_cast<int>(OvUI::Styling::EStyle::DEFAULT_DARK) };
 		inline static Property<int> ConsoleMaxLogs = { 500 };
 		inline static Property<int> FontSize = { static_cast<int>(EFontSize::DEFAULT) };
+		inline static Property<bool> SaveScenesAsBinary = { false };
 	};
 }
@@ -9,6 +9,7 @@
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/Scripting/ScriptEngine.h>
 #include <OvDebug/Assertion.h>
+#include <OvDebug/Logger.h>
 #include <OvEditor/Core/Context.h>
 #include <OvEditor/Utils/FileSystem.h>
 #include <OvEditor/Utils/ProjectManagement.h>
@@ -79,6 +80,9 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 	sceneManager(projectAssetsPath.string()),
 	projectSettings(projectFile.string())
 {
+	// Logs are written from a background thread, so that logging from scripts or workers doesn't stall the frame
+	OvDebug::Logger::EnableAsync();
+
 	if (!IsProjectSettingsIntegrityVerified())
 	{
 		ResetProjectSettings();
@@ -90,6 +94,7 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 	ShaderManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	MaterialManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	SoundManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
+	PrefabManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 
 	/* Settings */
 	OvWindowing::Settings::DeviceSettings deviceSettings;
@@ -160,6 +165,9 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 	/* Scripting */
 	scriptEngine = std::make_unique<OvCore::Scripting::ScriptEngine>();
 	scriptEngine->SetScriptRootFolder(projectScriptsPath.string());
+#if defined(LUA_SCRIPTING)
+	scriptEngine->SetBytecodeCacheFolder(Utils::FileSystem::kEditorDataPath / "ScriptCache");
+#endif
 
 	/* Service Locator providing */
 	ServiceLocator::Provide<OvPhysics::Core::PhysicsEngine>(*physicsEngine);
@@ -168,11 +176,13 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 	ServiceLocator::Provide<ShaderManager>(shaderManager);
 	ServiceLocator::Provide<MaterialManager>(materialManager);
 	ServiceLocator::Provide<SoundManager>(soundManager);
+	ServiceLocator::Provide<PrefabManager>(prefabManager);
 	ServiceLocator::Provide<OvWindowing::Inputs::InputManager>(*inputManager);
 	ServiceLocator::Provide<OvWindowing::Window>(*window);
 	ServiceLocator::Provide<OvCore::SceneSystem::SceneManager>(sceneManager);
 	ServiceLocator::Provide<OvAudio::Core::AudioEngine>(*audioEngine);
 	ServiceLocator::Provide<OvCore::Scripting::ScriptEngine>(*scriptEngine);
+	ServiceLocator::Provide<OvTools::Eventing::EventQueue>(eventQueue);
 	ServiceLocator::Provide<OvEditor::Utils::TextureRegistry>(*textureRegistry);
 
 	ApplyProjectSettings();
@@ -180,6 +190,8 @@ OvEditor::Core::Context::Context(const std::filesystem::path& p_projectFolder) :
 
 OvEditor::Core::Context::~Context()
 {
+	// Prefab templates reference the other resources, so they go first
+	prefabManager.UnloadResources();
 	modelManager.UnloadResources();
 	textureManager.UnloadResources();
 	shaderManager.UnloadResources();
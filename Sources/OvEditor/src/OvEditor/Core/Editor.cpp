@@ -6,6 +6,8 @@
 
 #include <tracy/Tracy.hpp>
 
+#include <OvDebug/Logger.h>
+
 #include <OvEditor/Core/Editor.h>
 #include <OvEditor/Panels/AssetBrowser.h>
 #include <OvEditor/Panels/AssetProperties.h>
@@ -90,6 +92,7 @@ void OvEditor::Core::Editor::PreUpdate()
 {
 	ZoneScopedN("Editor Pre-Update");
 	m_context.device->PollEvents();
+	OvDebug::Logger::DispatchEvents();
 }
 
 void OvEditor::Core::Editor::Update(float p_deltaTime)
@@ -129,6 +132,12 @@ void OvEditor::Core::Editor::UpdateCurrentEditorMode(float p_deltaTime)
 	else
 		UpdateEditMode(p_deltaTime);
 
+	{
+		// Flushed in both modes, edit mode actions can raise events too
+		ZoneScopedN("Deferred Events");
+		m_context.eventQueue.Flush();
+	}
+
 	{
 		ZoneScopedN("Scene garbage collection");
 		m_context.sceneManager.GetCurrentScene()->CollectGarbages();
@@ -139,17 +148,19 @@ void OvEditor::Core::Editor::UpdateCurrentEditorMode(float p_deltaTime)
 void OvEditor::Core::Editor::UpdatePlayMode(float p_deltaTime)
 {
 	auto currentScene = m_context.sceneManager.GetCurrentScene();
-	bool simulationApplied = false;
 
 	{
 		ZoneScopedN("Physics Update");
-		simulationApplied = m_context.physicsEngine->Update(p_deltaTime);
+		m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+		{
+			ZoneScopedN("Fixed Update");
+			currentScene->FixedUpdate(p_fixedDeltaTime);
+		});
 	}
 
-	if (simulationApplied)
 	{
-		ZoneScopedN("Fixed Update");
-		currentScene->FixedUpdate(p_deltaTime);
+		ZoneScopedN("Physics Events");
+		m_context.eventQueue.Flush();
 	}
 
 	{
@@ -157,6 +168,11 @@ void OvEditor::Core::Editor::UpdatePlayMode(float p_deltaTime)
 		currentScene->Update(p_deltaTime);
 	}
 
+	{
+		ZoneScopedN("Script Update");
+		m_context.scriptEngine->Update(p_deltaTime);
+	}
+
 	{
 		ZoneScopedN("Late Update");
 		currentScene->LateUpdate(p_deltaTime);
@@ -18,6 +18,7 @@
 #include <OvCore/ECS/Components/CPhysicalBox.h>
 #include <OvCore/ECS/Components/CPhysicalCapsule.h>
 #include <OvCore/ECS/Components/CPhysicalSphere.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 
 #include <OvEditor/Core/EditorActions.h>
 #include <OvEditor/Core/GizmoBehaviour.h>
@@ -27,6 +28,7 @@
 #include <OvEditor/Panels/MaterialEditor.h>
 #include <OvEditor/Panels/ProjectSettings.h>
 #include <OvEditor/Panels/SceneView.h>
+#include <OvEditor/Settings/EditorSettings.h>
 #include <OvEditor/Utils/FileSystem.h>
 
 #include <OvTools/Utils/PathParser.h>
@@ -71,7 +73,40 @@ void OvEditor::Core::EditorActions::SaveSceneToDisk(OvCore::SceneSystem::Scene&
 	doc.InsertFirstChild(node);
 	m_context.sceneManager.StoreCurrentSceneSourcePath(p_path);
 	p_scene.OnSerialize(doc, node);
-	doc.SaveFile(p_path.c_str());
+
+	if (Settings::EditorSettings::SaveScenesAsBinary)
+		OvCore::Helpers::BinaryDocument::SaveFile(doc, p_path);
+	else
+		doc.SaveFile(p_path.c_str());
+}
+
+bool OvEditor::Core::EditorActions::ConvertSceneFile(const std::string& p_path, bool p_toBinary)
+{
+	tinyxml2::XMLDocument doc;
+
+	if (OvCore::Helpers::BinaryDocument::IsBinaryFile(p_path))
+	{
+		// The mapping of the source file is released before overwriting it
+		OvCore::Helpers::BinaryDocument binaryDoc;
+
+		if (!binaryDoc.LoadFile(p_path) || !binaryDoc.ToXML(doc))
+			return false;
+	}
+	else if (doc.LoadFile(p_path.c_str()) != tinyxml2::XML_SUCCESS)
+	{
+		return false;
+	}
+
+	const bool succeeded = p_toBinary ?
+		OvCore::Helpers::BinaryDocument::SaveFile(doc, p_path) :
+		doc.SaveFile(p_path.c_str()) == tinyxml2::XML_SUCCESS;
+
+	if (succeeded)
+		OVLOG_INFO("Scene converted to " + std::string{ p_toBinary ? "binary" : "XML" } + ": " + p_path);
+	else
+		OVLOG_ERROR("Scene conversion failed: " + p_path);
+
+	return succeeded;
 }
 
 void OvEditor::Core::EditorActions::LoadSceneFromDisk(const std::string& p_path, bool p_absolute)
@@ -517,10 +552,7 @@ void OvEditor::Core::EditorActions::StartPlaying()
 		if (m_context.scriptEngine->IsOk())
 		{
 			PlayEvent.Invoke();
-			m_sceneBackup = std::make_unique<tinyxml2::XMLDocument>();
-			tinyxml2::XMLNode* node = m_sceneBackup->NewElement("root");
-			m_sceneBackup->InsertFirstChild(node);
-			m_context.sceneManager.GetCurrentScene()->OnSerialize(*m_sceneBackup, node);
+			m_sceneSnapshot.Capture(*m_context.sceneManager.GetCurrentScene());
 			m_panelsManager.GetPanelAs<OvEditor::Panels::GameView>("Game View").Focus();
 			m_context.sceneManager.GetCurrentScene()->Play();
 			SetEditorMode(EEditorMode::PLAY);
@@ -545,22 +577,20 @@ void OvEditor::Core::EditorActions::StopPlaying()
 	{
 		m_context.window->SetCursorMode(OvWindowing::Cursor::ECursorMode::NORMAL);
 		SetEditorMode(EEditorMode::EDIT);
-		bool loadedFromDisk = m_context.sceneManager.IsCurrentSceneLoadedFromDisk();
-		std::string sceneSourcePath = m_context.sceneManager.GetCurrentSceneSourcePath();
 
 		int64_t focusedActorID = -1;
 
 		if (auto targetActor = EDITOR_PANEL(Panels::Inspector, "Inspector").GetTargetActor())
 			focusedActorID = targetActor->GetID();
 
-		OVASSERT(m_sceneBackup.operator bool(), "No scene backup to restore");
+		OVASSERT(!m_sceneSnapshot.IsEmpty(), "No scene snapshot to restore");
 
-		m_context.sceneManager.LoadSceneFromMemory(*m_sceneBackup);
-		if (loadedFromDisk)
-			m_context.sceneManager.StoreCurrentSceneSourcePath(sceneSourcePath); // To bo able to save or reload the scene whereas the scene is loaded from memory (Supposed to have no path)
-		m_sceneBackup.reset();
+		auto scene = m_context.sceneManager.GetCurrentScene();
+		scene->Stop();
+		m_sceneSnapshot.Restore(*scene);
+		m_sceneSnapshot.Clear();
 		EDITOR_PANEL(Panels::SceneView, "Scene View").Focus();
-		if (auto actorInstance = m_context.sceneManager.GetCurrentScene()->FindActorByID(focusedActorID))
+		if (auto actorInstance = scene->FindActorByID(focusedActorID))
 			EDITOR_PANEL(Panels::Inspector, "Inspector").FocusActor(*actorInstance);
 	}
 }
@@ -658,39 +688,66 @@ std::string FindDuplicatedActorUniqueName(OvCore::ECS::Actor& p_duplicated, OvCo
 
 void OvEditor::Core::EditorActions::DuplicateActor(OvCore::ECS::Actor & p_toDuplicate, OvCore::ECS::Actor* p_forcedParent, bool p_focus)
 {
-	tinyxml2::XMLDocument doc;
-	tinyxml2::XMLNode* actorsRoot = doc.NewElement("actors");
-	p_toDuplicate.OnSerialize(doc, actorsRoot);
-	auto& newActor = CreateEmptyActor(false);
-	int64_t idToUse = newActor.GetID();
-	tinyxml2::XMLElement* currentActor = actorsRoot->FirstChildElement("actor");
-	newActor.OnDeserialize(doc, currentActor);
-	
-	newActor.SetID(idToUse);
-
-	if (p_forcedParent)
-		newActor.SetParent(*p_forcedParent);
-	else
+	const auto currentScene = m_context.sceneManager.GetCurrentScene();
+	auto& newActor = currentScene->CloneActor(p_toDuplicate, p_forcedParent);
+
+	if (!p_forcedParent)
 	{
-        auto currentScene = m_context.sceneManager.GetCurrentScene();
-
-        if (newActor.GetParentID() > 0)
-        {
-            if (auto found = currentScene->FindActorByID(newActor.GetParentID()); found)
-            {
-                newActor.SetParent(*found);
-            }
-        }
-
-        const auto uniqueName = FindDuplicatedActorUniqueName(p_toDuplicate, newActor, *currentScene);
-        newActor.SetName(uniqueName);
+		const auto uniqueName = FindDuplicatedActorUniqueName(p_toDuplicate, newActor, *currentScene);
+		newActor.SetName(uniqueName);
 	}
 
 	if (p_focus)
 		SelectActor(newActor);
+}
 
-	for (auto& child : p_toDuplicate.GetChildren())
-		DuplicateActor(*child, &newActor, false);
+void OvEditor::Core::EditorActions::SaveActorAsPrefab(OvCore::ECS::Actor& p_actor)
+{
+	OvWindowing::Dialogs::SaveFileDialog dialog("Save as Prefab");
+	const auto initialPath = m_context.projectAssetsPath / p_actor.GetName();
+	dialog.SetInitialDirectory(initialPath.string());
+	dialog.DefineExtension("Overload Prefab", ".ovprefab");
+	dialog.Show();
+
+	if (dialog.HasSucceeded())
+	{
+		if (dialog.IsFileExisting())
+		{
+			OvWindowing::Dialogs::MessageBox message("File already exists!", "The file \"" + dialog.GetSelectedFileName() + "\" already exists.\n\nUsing this file as the new home for your prefab will erase any content stored in this file.\n\nAre you ok with that?", OvWindowing::Dialogs::MessageBox::EMessageType::WARNING, OvWindowing::Dialogs::MessageBox::EButtonLayout::YES_NO, true);
+			switch (message.GetUserAction())
+			{
+			case OvWindowing::Dialogs::MessageBox::EUserAction::YES: break;
+			default: return;
+			}
+		}
+
+		OvCore::Resources::Prefab prefab;
+		prefab.Capture(p_actor);
+		OvCore::Resources::Loaders::PrefabLoader::Save(prefab, dialog.GetSelectedFilePath());
+
+		/* Instances spawned from now on must use the new content */
+		if (const auto loaded = m_context.prefabManager.GetResource(GetResourcePath(dialog.GetSelectedFilePath()), false))
+			m_context.prefabManager.ReloadResource(loaded, dialog.GetSelectedFilePath());
+	}
+}
+
+OvCore::ECS::Actor* OvEditor::Core::EditorActions::InstantiatePrefab(const std::string& p_path, bool p_focusOnCreation)
+{
+	const auto prefab = m_context.prefabManager[p_path];
+
+	if (!prefab)
+	{
+		OVLOG_ERROR("Failed to load prefab: " + p_path);
+		return nullptr;
+	}
+
+	const auto position = m_actorSpawnMode == EActorSpawnMode::FRONT ? CalculateActorSpawnPoint(10.0f) : OvMaths::FVector3::Zero;
+	const auto instance = m_context.sceneManager.GetCurrentScene()->Instantiate(*prefab, position);
+
+	if (instance && p_focusOnCreation)
+		SelectActor(*instance);
+
+	return instance;
 }
 
 void OvEditor::Core::EditorActions::SelectActor(OvCore::ECS::Actor& p_target)
@@ -1104,7 +1161,24 @@ uint64_t ReplaceStringInFile(const std::filesystem::path& p_filePath,
 
 	std::string content;
 
-	if (auto inFile = std::ifstream{ p_filePath, std::ios::in })
+	// Binary documents are edited through their XML equivalent (The conversion is lossless)
+	const bool isBinary = OvCore::Helpers::BinaryDocument::IsBinaryFile(p_filePath.string());
+
+	if (isBinary)
+	{
+		tinyxml2::XMLDocument doc;
+		OvCore::Helpers::BinaryDocument binaryDoc;
+
+		if (!binaryDoc.LoadFile(p_filePath.string()) || !binaryDoc.ToXML(doc))
+		{
+			throw std::runtime_error("Cannot open file for reading: " + p_filePath.string());
+		}
+
+		tinyxml2::XMLPrinter printer(nullptr, true);
+		doc.Print(&printer);
+		content = printer.CStr();
+	}
+	else if (auto inFile = std::ifstream{ p_filePath, std::ios::in })
 	{
 		std::stringstream buffer;
 		buffer << inFile.rdbuf();
@@ -1126,7 +1200,16 @@ uint64_t ReplaceStringInFile(const std::filesystem::path& p_filePath,
 
 	if (occurences > 0)
 	{
-		if (auto outFile = std::ofstream{ p_filePath, std::ios::out | std::ios::trunc })
+		if (isBinary)
+		{
+			tinyxml2::XMLDocument doc;
+
+			if (doc.Parse(content.c_str()) != tinyxml2::XML_SUCCESS || !OvCore::Helpers::BinaryDocument::SaveFile(doc, p_filePath.string()))
+			{
+				throw std::runtime_error("Cannot open file for writing: " + p_filePath.string());
+			}
+		}
+		else if (auto outFile = std::ofstream{ p_filePath, std::ios::out | std::ios::trunc })
 		{
 			outFile << content;
 		}
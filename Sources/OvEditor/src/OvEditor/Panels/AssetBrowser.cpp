@@ -13,6 +13,7 @@
 #include <tinyxml2.h>
 
 #include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/Helpers/BinaryDocument.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
 #include <OvCore/ResourceManagement/TextureManager.h>
 #include <OvCore/ResourceManagement/ShaderManager.h>
@@ -804,6 +805,27 @@ namespace
 				EDITOR_EXEC(LoadSceneFromDisk(EDITOR_EXEC(GetResourcePath(filePath.string()))));
 			};
 
+			if (!m_protected)
+			{
+				auto& convertAction = CreateWidget<OvUI::Widgets::Menu::MenuItem>("");
+
+				// The label is refreshed on each conversion, as the file format can change after the menu creation
+				auto updateLabel = [this, &convertAction]
+				{
+					const bool isBinary = OvCore::Helpers::BinaryDocument::IsBinaryFile(filePath.string());
+					convertAction.name = isBinary ? "Convert to XML" : "Convert to Binary";
+				};
+
+				updateLabel();
+
+				convertAction.ClickedEvent += [this, updateLabel]
+				{
+					const bool isBinary = OvCore::Helpers::BinaryDocument::IsBinaryFile(filePath.string());
+					EDITOR_EXEC(ConvertSceneFile(filePath.string(), !isBinary));
+					updateLabel();
+				};
+			}
+
 			FileContextualMenu::CreateList();
 		}
 	};
@@ -1299,5 +1321,12 @@ void OvEditor::Panels::AssetBrowser::ConsiderItem(OvUI::Widgets::Layout::TreeNod
 				OpenInParticleEditor(contextMenu.filePath.string());
 			};
 		}
+
+		if (fileType == OvTools::Utils::PathParser::EFileType::PREFAB)
+		{
+			clickableText.DoubleClickedEvent += [&contextMenu, p_isEngineItem] {
+				EDITOR_EXEC(InstantiatePrefab(EDITOR_EXEC(GetResourcePath(contextMenu.filePath.string(), p_isEngineItem))));
+			};
+		}
 	}
 }
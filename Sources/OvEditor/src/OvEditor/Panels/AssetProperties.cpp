@@ -12,6 +12,7 @@
 #include <OvCore/Helpers/GUIDrawer.h>
 #include <OvCore/Global/ServiceLocator.h>
 #include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/SoundManager.h>
 #include <OvCore/ResourceManagement/TextureManager.h>
 
 #include <OvUI/Widgets/Visual/Separator.h>
@@ -175,6 +176,10 @@ void OvEditor::Panels::AssetProperties::CreateSettings()
 	{
 		CreateTextureSettings();
 	}
+	else if (fileType == OvTools::Utils::PathParser::EFileType::SOUND)
+	{
+		CreateSoundSettings();
+	}
 	else
 	{
 		m_settings->enabled = false;
@@ -347,6 +352,26 @@ void OvEditor::Panels::AssetProperties::CreateTextureSettings()
 	);
 }
 
+void OvEditor::Panels::AssetProperties::CreateSoundSettings()
+{
+	using namespace OvAudio::Settings;
+
+	const std::string kLoadMode = "LOAD_MODE";
+
+	m_metadata->Add(kLoadMode, static_cast<int>(ESoundLoadMode::AUTOMATIC));
+
+	OvCore::Helpers::GUIDrawer::CreateTitle(*m_settingsColumns, kLoadMode);
+	auto& loadMode = m_settingsColumns->CreateWidget<OvUI::Widgets::Selection::ComboBox>(m_metadata->Get<int>(kLoadMode));
+	loadMode.choices = {
+		{static_cast<int>(ESoundLoadMode::AUTOMATIC), "AUTOMATIC"},
+		{static_cast<int>(ESoundLoadMode::DECOMPRESSED), "DECOMPRESSED"},
+		{static_cast<int>(ESoundLoadMode::STREAMED), "STREAMED"}
+	};
+	loadMode.ValueChangedEvent += [this, kLoadMode](int p_choice) {
+		m_metadata->Set(kLoadMode, p_choice);
+	};
+}
+
 void OvEditor::Panels::AssetProperties::Apply()
 {
 	m_metadata->Rewrite();
@@ -370,6 +395,14 @@ void OvEditor::Panels::AssetProperties::Apply()
 			textureManager.AResourceManager::ReloadResource(resourcePath);
 		}
 	}
+	else if (fileType == OvTools::Utils::PathParser::EFileType::SOUND)
+	{
+		auto& soundManager = OVSERVICE(OvCore::ResourceManagement::SoundManager);
+		if (soundManager.IsResourceRegistered(resourcePath))
+		{
+			soundManager.AResourceManager::ReloadResource(resourcePath);
+		}
+	}
 
 	Refresh();
 }
@@ -59,6 +59,12 @@ public:
 				EDITOR_EXEC(DelayAction(EDITOR_BIND(DuplicateActor, std::ref(*m_target), nullptr, true), 0));
 			};
 
+			auto& saveAsPrefabButton = CreateWidget<OvUI::Widgets::Menu::MenuItem>("Save as Prefab...");
+			saveAsPrefabButton.ClickedEvent += [this]
+			{
+				EDITOR_EXEC(SaveActorAsPrefab(*m_target));
+			};
+
 			auto& deleteButton = CreateWidget<OvUI::Widgets::Menu::MenuItem>("Delete");
 			deleteButton.ClickedEvent += [this]
 			{
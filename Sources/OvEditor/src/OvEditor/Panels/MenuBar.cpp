@@ -25,6 +25,10 @@
 #include <OvUI/Widgets/Selection/ColorEdit.h>
 #include <OvUI/Widgets/Selection/ComboBox.h>
 
+#if defined(LUA_SCRIPTING)
+#include <OvCore/Scripting/Lua/LuaProfiler.h>
+#endif
+
 #include "OvEditor/Core/EditorActions.h"
 #include "OvEditor/Panels/AssetView.h"
 #include "OvEditor/Panels/Console.h"
@@ -105,6 +109,7 @@ void OvEditor::Panels::MenuBar::InitializeSettingsMenu()
 
 	m_settingsMenu->CreateWidget<MenuItem>("Spawn actors at origin", "", true, true).ValueChangedEvent += EDITOR_BIND(SetActorSpawnAtOrigin, std::placeholders::_1);
 	m_settingsMenu->CreateWidget<MenuItem>("Vertical Synchronization", "", true, true).ValueChangedEvent += [this](bool p_value) { EDITOR_CONTEXT(device)->SetVsync(p_value); };
+	m_settingsMenu->CreateWidget<MenuItem>("Save Scenes As Binary", "", true, Settings::EditorSettings::SaveScenesAsBinary.Get()).ValueChangedEvent += [](bool p_value) { Settings::EditorSettings::SaveScenesAsBinary = p_value; };
 	auto& cameraSpeedMenu = m_settingsMenu->CreateWidget<MenuList>("Camera Speed");
 	cameraSpeedMenu.CreateWidget<OvUI::Widgets::Sliders::SliderInt>(1, 50, 15, OvUI::Widgets::Sliders::ESliderOrientation::HORIZONTAL, "Scene View").ValueChangedEvent += EDITOR_BIND(SetSceneViewCameraSpeed, std::placeholders::_1);
 	cameraSpeedMenu.CreateWidget<OvUI::Widgets::Sliders::SliderInt>(1, 50, 15, OvUI::Widgets::Sliders::ESliderOrientation::HORIZONTAL, "Asset View").ValueChangedEvent += EDITOR_BIND(SetAssetViewCameraSpeed, std::placeholders::_1);
@@ -237,13 +242,25 @@ void OvEditor::Panels::MenuBar::CreateResourcesMenu()
 
 void OvEditor::Panels::MenuBar::CreateToolsMenu()
 {
+// The menu only exists if at least one of its entries is compiled in
+#if defined(_WIN32) || defined(LUA_SCRIPTING)
+	auto& toolsMenu = CreateWidget<MenuList>("Tools");
+#endif
+
 // No Tracy profiler (front-end) on non-Windows platforms at the moment.
 // You'll need to build it yourself if you want to use it on other platforms.
 // https://github.com/Overload-Technologies/Overload/issues/614
 #ifdef _WIN32
-	auto& toolsMenu = CreateWidget<MenuList>("Tools");
 	toolsMenu.CreateWidget<MenuItem>("Open Profiler").ClickedEvent += EDITOR_BIND(OpenProfiler);
 #endif
+
+#if defined(LUA_SCRIPTING)
+	auto& scriptProfiling = toolsMenu.CreateWidget<MenuItem>("Script Profiling", "", true, false);
+	scriptProfiling.ValueChangedEvent += [](bool p_value)
+	{
+		EDITOR_CONTEXT(scriptEngine)->GetProfiler().SetEnabled(p_value);
+	};
+#endif
 }
 
 void OvEditor::Panels::MenuBar::CreateSettingsMenu()
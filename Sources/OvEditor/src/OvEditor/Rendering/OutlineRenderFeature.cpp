@@ -186,7 +186,7 @@ void OvEditor::Rendering::OutlineRenderFeature::DrawModelToStencil(
 	for (auto mesh : p_model.GetMeshes())
 	{
 		auto getStencilMaterial = [&]() -> OvCore::Resources::Material& {
-			auto material = p_materials.has_value() ? p_materials->at(mesh->GetMaterialIndex()) : nullptr;
+			auto material = p_materials.has_value() && mesh->GetMaterialIndex() < p_materials->size() ? p_materials.value()[mesh->GetMaterialIndex()] : nullptr;
 			if (material && material->IsValid() && material->HasPass(outlinePassName))
 			{
 				return *material;
@@ -230,7 +230,7 @@ void OvEditor::Rendering::OutlineRenderFeature::DrawModelOutline(
 	for (auto mesh : p_model.GetMeshes())
 	{
 		auto getStencilMaterial = [&]() -> OvCore::Resources::Material& {
-			auto material = p_materials.has_value() ? p_materials->at(mesh->GetMaterialIndex()) : nullptr;
+			auto material = p_materials.has_value() && mesh->GetMaterialIndex() < p_materials->size() ? p_materials.value()[mesh->GetMaterialIndex()] : nullptr;
 			if (material && material->IsValid() && material->HasPass(outlinePassName))
 			{
 				return *material;
@@ -22,11 +22,13 @@
 #include <OvCore/ResourceManagement/ShaderManager.h>
 #include <OvCore/ResourceManagement/MaterialManager.h>
 #include <OvCore/ResourceManagement/SoundManager.h>
+#include <OvCore/ResourceManagement/PrefabManager.h>
 #include <OvCore/SceneSystem/SceneManager.h>
 #include <OvCore/Scripting/ScriptEngine.h>
 
 #include <OvAudio/Core/AudioEngine.h>
 
+#include <OvTools/Eventing/EventQueue.h>
 #include <OvTools/Filesystem/IniFile.h>
 
 namespace OvGame::Core
@@ -62,6 +64,8 @@ namespace OvGame::Core
 		std::unique_ptr<OvCore::Scripting::ScriptEngine> scriptEngine;
 		std::unique_ptr<OvRendering::HAL::Framebuffer> framebuffer;
 
+		OvTools::Eventing::EventQueue eventQueue;
+
 		OvCore::SceneSystem::SceneManager sceneManager;
 
 		OvCore::ResourceManagement::ModelManager modelManager;
@@ -69,6 +73,7 @@ namespace OvGame::Core
 		OvCore::ResourceManagement::ShaderManager shaderManager;
 		OvCore::ResourceManagement::MaterialManager materialManager;
 		OvCore::ResourceManagement::SoundManager soundManager;
+		OvCore::ResourceManagement::PrefabManager prefabManager;
 		
 		OvTools::Filesystem::IniFile projectSettings;
 	};
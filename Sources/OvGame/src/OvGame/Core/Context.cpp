@@ -57,11 +57,15 @@ OvGame::Core::Context::Context() :
 	projectSettings((std::filesystem::current_path() / "Data" / "User" / "Game.ini").string()),
 	sceneManager(projectAssetsPath.string())
 {
+	// Logs are queued, and written in batches by a background thread
+	OvDebug::Logger::EnableAsync();
+
 	ModelManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	TextureManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	ShaderManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	MaterialManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	SoundManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
+	PrefabManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 
 	/* Settings */
 	OvWindowing::Settings::DeviceSettings deviceSettings;
@@ -138,6 +142,9 @@ OvGame::Core::Context::Context() :
 	/* Scripting */
 	scriptEngine = std::make_unique<OvCore::Scripting::ScriptEngine>();
 	scriptEngine->SetScriptRootFolder(projectScriptsPath);
+#if defined(LUA_SCRIPTING)
+	scriptEngine->SetBytecodeCacheFolder(std::filesystem::current_path() / "Data" / "User" / "ScriptCache");
+#endif
 
 	/* Service Locator providing */
 	ServiceLocator::Provide<OvPhysics::Core::PhysicsEngine>(*physicsEngine);
@@ -146,11 +153,13 @@ OvGame::Core::Context::Context() :
 	ServiceLocator::Provide<ShaderManager>(shaderManager);
 	ServiceLocator::Provide<MaterialManager>(materialManager);
 	ServiceLocator::Provide<SoundManager>(soundManager);
+	ServiceLocator::Provide<PrefabManager>(prefabManager);
 	ServiceLocator::Provide<OvWindowing::Inputs::InputManager>(*inputManager);
 	ServiceLocator::Provide<OvWindowing::Window>(*window);
 	ServiceLocator::Provide<OvCore::SceneSystem::SceneManager>(sceneManager);
 	ServiceLocator::Provide<OvAudio::Core::AudioEngine>(*audioEngine);
 	ServiceLocator::Provide<OvCore::Scripting::ScriptEngine>(*scriptEngine);
+	ServiceLocator::Provide<OvTools::Eventing::EventQueue>(eventQueue);
 
 	framebuffer = std::make_unique<OvRendering::HAL::Framebuffer>("Main");
 
@@ -164,6 +173,8 @@ OvGame::Core::Context::Context() :
 
 OvGame::Core::Context::~Context()
 {
+	// Prefab templates reference the other resources, so they go first
+	prefabManager.UnloadResources();
 	modelManager.UnloadResources();
 	textureManager.UnloadResources();
 	shaderManager.UnloadResources();
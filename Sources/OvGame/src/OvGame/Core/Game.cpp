@@ -52,6 +52,7 @@ void OvGame::Core::Game::PreUpdate()
 	ZoneScoped;
 
 	m_context.device->PollEvents();
+	OvDebug::Logger::DispatchEvents();
 }
 
 void RenderCurrentScene(
@@ -101,8 +102,13 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 			ZoneScopedN("Physics Update");
 			#endif
 
-			if (m_context.physicsEngine->Update(p_deltaTime))
-				currentScene->FixedUpdate(p_deltaTime);
+			m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+			{
+				currentScene->FixedUpdate(p_fixedDeltaTime);
+			});
+
+			// Delivers the events raised by the simulation (e.g. collisions) before the scene updates
+			m_context.eventQueue.Flush();
 		}
 
 		{
@@ -110,7 +116,9 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 			ZoneScopedN("Scene Update");
 			#endif
 			currentScene->Update(p_deltaTime);
+			m_context.scriptEngine->Update(p_deltaTime);
 			currentScene->LateUpdate(p_deltaTime);
+			m_context.eventQueue.Flush();
 		}
 
 		{
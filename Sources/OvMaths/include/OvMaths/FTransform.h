@@ -69,6 +69,20 @@ namespace OvMaths
 		*/
 		bool HasParent() const;
 
+		/**
+		* Add a handler called every time this transform changes (Directly or through one of its parents), or is destroyed.
+		* Returns the ID of the handler, needed to remove it
+		* @param p_notificationHandler
+		*/
+		Internal::TransformNotifier::NotificationHandlerID AddNotificationHandler(Internal::TransformNotifier::NotificationHandler p_notificationHandler);
+
+		/**
+		* Remove a handler previously added with AddNotificationHandler.
+		* Returns true on success
+		* @param p_notificationHandlerID
+		*/
+		bool RemoveNotificationHandler(Internal::TransformNotifier::NotificationHandlerID p_notificationHandlerID);
+
 		/**
 		* Initialize transform with raw data from world info
 		* @param p_position
@@ -7,8 +7,8 @@
 #include "OvMaths/FTransform.h"
 
 OvMaths::FTransform::FTransform(FVector3 p_localPosition, FQuaternion p_localRotation, FVector3 p_localScale) :
-	m_notificationHandlerID(-1),
-	m_parent(nullptr)
+	m_parent(nullptr),
+	m_notificationHandlerID(-1)
 {
 	GenerateMatricesLocal(p_localPosition, p_localRotation, p_localScale);
 }
@@ -82,6 +82,16 @@ bool OvMaths::FTransform::HasParent() const
 	return m_parent != nullptr;
 }
 
+OvMaths::Internal::TransformNotifier::NotificationHandlerID OvMaths::FTransform::AddNotificationHandler(Internal::TransformNotifier::NotificationHandler p_notificationHandler)
+{
+	return m_notifier.AddNotificationHandler(p_notificationHandler);
+}
+
+bool OvMaths::FTransform::RemoveNotificationHandler(Internal::TransformNotifier::NotificationHandlerID p_notificationHandlerID)
+{
+	return m_notifier.RemoveNotificationHandler(p_notificationHandlerID);
+}
+
 void OvMaths::FTransform::GenerateMatricesLocal(FVector3 p_position, FQuaternion p_rotation, FVector3 p_scale)
 {
 	m_localMatrix = FMatrix4::Translation(p_position) * FQuaternion::ToMatrix4(FQuaternion::Normalize(p_rotation)) * FMatrix4::Scaling(p_scale);
@@ -0,0 +1,69 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace OvPhysics::Core
+{
+	/**
+	* Set of the physical object pairs in contact during a simulation step, keyed by object IDs.
+	* Open-addressing hash table (Linear probing) indexing a dense list of keys, so the set can be
+	* both iterated and cleared in a time proportional to its size
+	*/
+	class ContactPairSet
+	{
+	public:
+		/**
+		* Add the pair made of the two given object IDs (The order doesn't matter).
+		* Returns false if the pair was already in the set
+		* @param p_first
+		* @param p_second
+		*/
+		bool Insert(uint32_t p_first, uint32_t p_second);
+
+		/**
+		* Returns true if the set contains the given pair key
+		* @param p_key
+		*/
+		bool Contains(uint64_t p_key) const;
+
+		/**
+		* Remove every pair, keeping the allocated memory
+		*/
+		void Clear();
+
+		/**
+		* Returns the keys of the pairs in the set, in insertion order
+		*/
+		const std::vector<uint64_t>& GetKeys() const;
+
+		/**
+		* Returns the key identifying the pair made of the two given object IDs
+		* @param p_first
+		* @param p_second
+		*/
+		static uint64_t MakeKey(uint32_t p_first, uint32_t p_second);
+
+		/**
+		* Returns the two object IDs of the given pair key
+		* @param p_key
+		*/
+		static std::pair<uint32_t, uint32_t> SplitKey(uint64_t p_key);
+
+	private:
+		uint32_t FindSlot(uint64_t p_key) const;
+		void Grow();
+
+	private:
+		std::vector<uint64_t> m_keys;
+		std::vector<uint32_t> m_keySlots;	// Slot of each key, to clear the table without probing it again
+		std::vector<uint32_t> m_slots;		// Index in m_keys plus one, 0 for an empty slot
+	};
+}
@@ -6,10 +6,14 @@
 
 #pragma once
 
-#include <map>
+#include <array>
+#include <functional>
 #include <optional>
+#include <span>
 #include <vector>
 
+#include <OvPhysics/Core/ContactPairSet.h>
+#include <OvPhysics/Core/PhysicsQuery.h>
 #include <OvPhysics/Entities/PhysicalObject.h>
 #include <OvPhysics/Entities/RaycastHit.h>
 #include <OvPhysics/Settings/PhysicsSettings.h>
@@ -20,8 +24,8 @@ class btCollisionConfiguration;
 class btBroadphaseInterface;
 class btConstraintSolver;
 class btRigidBody;
-class btManifoldPoint;
-struct btCollisionObjectWrapper;
+struct btOverlapFilterCallback;
+class btVector3;
 
 namespace OvPhysics::Core
 {
@@ -44,13 +48,17 @@ namespace OvPhysics::Core
 		virtual ~PhysicsEngine();
 
 		/**
-		* Simulate the physics. This method call is decomposed in 3 things:
-		* - Pre-Update (Apply FTransforms to btTransforms, called every Update call)
-		* - Simulation (Simulate the physics, called 60 times per seconds)
-		* - Post-Update (Apply the simulation results, btTransforms, to FTransforms)
-		* This methods returns true if the call invoked a physics simulation
+		* Simulate the physics. The frame time is accumulated and simulated in fixed steps (See PhysicsSettings):
+		* - Pre-Update (Apply the FTransforms modified outside of the simulation to btTransforms, before each step)
+		* - Simulation (Simulate a single fixed step)
+		* - Post-Update (Apply the simulation results of the awake bodies, btTransforms, to FTransforms, then dispatch the collision events)
+		* - Fixed update callback (Called once per step, with the fixed step duration)
+		* Simulated transforms are then interpolated with the remaining accumulated time.
+		* This methods returns the number of simulated steps
+		* @param p_deltaTime
+		* @param p_fixedUpdate
 		*/
-		bool Update(float p_deltaTime);
+		uint32_t Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdate = nullptr);
 
 		/* Casts a ray against all Physical Object in the Scene and returns information on what was hit
 		 * @param p_origin
@@ -58,6 +66,32 @@ namespace OvPhysics::Core
 		 */
 		std::optional<Entities::RaycastHit> Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance);
 
+		/**
+		* Cast a batch of rays. The hits of each query are stored in the given results, in the order of the queries.
+		* Queries read the state of the last simulation step, so they must not run during Update. If p_parallel is true,
+		* the batch is spread over the default thread pool (Queries only read the world)
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel
+		*/
+		void Raycast(std::span<const RaycastQuery> p_queries, QueryResults& p_results, bool p_parallel = true) const;
+
+		/**
+		* Sweep a batch of shapes (See Raycast for the batch behaviour)
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel
+		*/
+		void Sweep(std::span<const SweepQuery> p_queries, QueryResults& p_results, bool p_parallel = true) const;
+
+		/**
+		* Find the objects overlapping a batch of shapes (See Raycast for the batch behaviour)
+		* @param p_queries
+		* @param p_results
+		* @param p_parallel
+		*/
+		void Overlap(std::span<const OverlapQuery> p_queries, QueryResults& p_results, bool p_parallel = true) const;
+
 		/**
 		* Defines the world gravity to apply
 		* @param p_gravity
@@ -69,11 +103,32 @@ namespace OvPhysics::Core
 		*/
 		OvMaths::FVector3 GetGravity() const;
 
+		/**
+		* Defines if the objects of the two given layers collide with each other (See PhysicsSettings::layerCollisionMatrix).
+		* The collision filters of every physical object are refreshed, so this is not meant to be called every frame
+		* @param p_first
+		* @param p_second
+		* @param p_collide
+		*/
+		void SetLayerCollision(uint32_t p_first, uint32_t p_second, bool p_collide);
+
+		/**
+		* Returns true if the objects of the two given layers collide with each other
+		* @param p_first
+		* @param p_second
+		*/
+		bool GetLayerCollision(uint32_t p_first, uint32_t p_second) const;
+
 	private:
 		void PreUpdate();
 		void PostUpdate();
+		void ApplyExternalTransforms();
+		void InterpolateTransforms(float p_alpha);
 
 		void ListenToPhysicalObjects();
+		void OnObjectMoved(Entities::PhysicalObject& p_object);
+		void OnObjectSimulated(Entities::PhysicalObject& p_object);
+		void WakeUpBodies(const btVector3& p_aabbMin, const btVector3& p_aabbMax);
 
 		void Consider(OvPhysics::Entities::PhysicalObject& p_toConsider);
 		void Unconsider(OvPhysics::Entities::PhysicalObject& p_toUnconsider);
@@ -81,21 +136,45 @@ namespace OvPhysics::Core
 		void Consider(btRigidBody& p_toConsider);
 		void Unconsider(btRigidBody& p_toUnconsider);
 
-		void ResetCollisionEvents();
-		void CheckCollisionStopEvents();
+		void RunQueries(size_t p_count, QueryResults& p_results, bool p_parallel, const std::function<void(size_t, std::vector<QueryHit>&)>& p_query) const;
 
-		static bool CollisionCallback(btManifoldPoint& cp, const btCollisionObjectWrapper* obj1, int id1, int index1, const btCollisionObjectWrapper* obj2, int id2, int index2);
-		void SetCollisionCallback();
+		void GatherContacts();
+		void DispatchCollisionEvents();
+		void DispatchCollisionEvent(
+			uint64_t p_pairKey,
+			OvTools::Eventing::Event<Entities::PhysicalObject&> Entities::PhysicalObject::* p_triggerEvent,
+			OvTools::Eventing::Event<Entities::PhysicalObject&> Entities::PhysicalObject::* p_collisionEvent
+		);
 
 	private:
+		const float m_fixedTimeStep;
+		const uint32_t m_maxSteps;
+		const bool m_interpolation;
+		float m_accumulator = 0.0f;
+		std::array<uint16_t, Settings::PhysicsSettings::kLayerCount> m_layerCollisionMatrix;
+
 		/* Bullet world */
+		std::unique_ptr<btOverlapFilterCallback> m_overlapFilter;
 		std::unique_ptr<btDynamicsWorld> m_world;
 		std::unique_ptr<btDispatcher> m_dispatcher;
 		std::unique_ptr<btCollisionConfiguration> m_collisionConfig;
 		std::unique_ptr<btBroadphaseInterface> m_broadphase;
 		std::unique_ptr<btConstraintSolver> m_solver;
 
-		static std::map<std::pair<Entities::PhysicalObject*, Entities::PhysicalObject*>, bool> m_collisionEvents;
 		std::vector<std::reference_wrapper<Entities::PhysicalObject>> m_physicalObjects;
+
+		/* Contacts of the last two steps, diffed to find the pairs that started or stopped touching */
+		ContactPairSet m_contacts;
+		ContactPairSet m_previousContacts;
+
+		/* Objects indexed by ID, IDs of destroyed objects are reused once no contact pair can reference them anymore */
+		std::vector<Entities::PhysicalObject*> m_objectsByID;
+		std::vector<uint32_t> m_freeIDs;
+		std::vector<uint32_t> m_releasedIDs;
+
+		/* Objects to synchronize, rather than going through every physical object */
+		std::vector<Entities::PhysicalObject*> m_movedObjects;			// FTransform changed outside of the simulation
+		std::vector<Entities::PhysicalObject*> m_simulatedObjects;		// Awake bodies reported by Bullet during the current step
+		std::vector<Entities::PhysicalObject*> m_interpolatedObjects;	// Awake bodies of the last step, interpolated between steps
 	};
 }
@@ -0,0 +1,145 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <OvMaths/FQuaternion.h>
+#include <OvMaths/FVector3.h>
+
+namespace OvPhysics::Entities { class PhysicalObject; }
+
+namespace OvPhysics::Core
+{
+	/**
+	* Defines which hits a query reports
+	*/
+	enum class EQueryMode
+	{
+		CLOSEST,	// The closest hit only
+		ANY,		// The first hit found (Not necessarily the closest), the query stops there
+		ALL			// Every hit, sorted by distance
+	};
+
+	/**
+	* Defines the shape used by sweeps and overlaps
+	*/
+	enum class EQueryShape
+	{
+		SPHERE,
+		BOX,
+		CAPSULE
+	};
+
+	/**
+	* Defines which physical objects a query can hit
+	*/
+	struct QueryFilter
+	{
+		uint32_t layerMask = 0xFFFFFFFF;	// Bit N set to hit the objects of layer N
+		bool includeTriggers = true;
+		const Entities::PhysicalObject* ignoredObject = nullptr;
+	};
+
+	/**
+	* Shape swept or tested for overlaps
+	*/
+	struct QueryShape
+	{
+		EQueryShape type = EQueryShape::SPHERE;
+		float radius = 0.5f;									// Sphere and capsule
+		float height = 1.0f;									// Capsule (Distance between the centers of its two hemispheres)
+		OvMaths::FVector3 halfExtents = { 0.5f, 0.5f, 0.5f };	// Box
+		OvMaths::FQuaternion rotation;
+	};
+
+	/**
+	* Casts a ray from the origin along the direction
+	*/
+	struct RaycastQuery
+	{
+		OvMaths::FVector3 origin;
+		OvMaths::FVector3 direction;
+		float distance = 0.0f;
+		EQueryMode mode = EQueryMode::CLOSEST;
+		QueryFilter filter;
+	};
+
+	/**
+	* Moves a shape from the origin along the direction
+	*/
+	struct SweepQuery
+	{
+		QueryShape shape;
+		OvMaths::FVector3 origin;
+		OvMaths::FVector3 direction;
+		float distance = 0.0f;
+		EQueryMode mode = EQueryMode::CLOSEST;
+		QueryFilter filter;
+	};
+
+	/**
+	* Finds the objects intersecting a shape at the given position
+	*/
+	struct OverlapQuery
+	{
+		QueryShape shape;
+		OvMaths::FVector3 position;
+		EQueryMode mode = EQueryMode::ALL;	// CLOSEST behaves as ANY, overlaps have no distance
+		QueryFilter filter;
+	};
+
+	/**
+	* Data structure that holds a single query hit
+	*/
+	struct QueryHit
+	{
+		Entities::PhysicalObject* object = nullptr;
+		OvMaths::FVector3 point;
+		OvMaths::FVector3 normal;
+		float distance = 0.0f;	// Along the query direction (0 for overlaps)
+	};
+
+	/**
+	* Hits of a batch of queries, stored contiguously. Keeping the results between frames reuses their memory
+	*/
+	class QueryResults
+	{
+	public:
+		friend class PhysicsEngine;
+
+		/**
+		* Returns the hits of the query at the given index in the batch
+		* @param p_query
+		*/
+		std::span<const QueryHit> GetHits(size_t p_query) const;
+
+		/**
+		* Returns true if the query at the given index in the batch hit something
+		* @param p_query
+		*/
+		bool HasHit(size_t p_query) const;
+
+		/**
+		* Returns the number of queries in the batch
+		*/
+		size_t GetQueryCount() const;
+
+	private:
+		struct Range
+		{
+			uint32_t first = 0;
+			uint32_t count = 0;
+		};
+
+		std::vector<QueryHit> m_hits;
+		std::vector<Range> m_ranges;
+		std::vector<std::vector<QueryHit>> m_chunkHits;
+	};
+}
@@ -8,6 +8,7 @@
 
 #include <any>
 #include <memory>
+#include <optional>
 
 #include <OvMaths/FTransform.h>
 #include <OvTools/Eventing/Event.h>
@@ -134,6 +135,11 @@ namespace OvPhysics::Entities
 		*/
 		bool IsKinematic() const;
 
+		/**
+		* Returns the collision layer of the physical object
+		*/
+		uint32_t GetLayer() const;
+
 		/**
 		* Returns the current activation state
 		*/
@@ -204,6 +210,12 @@ namespace OvPhysics::Entities
 		*/
 		void SetKinematic(bool p_kinematic);
 
+		/**
+		* Defines the collision layer of the physical object (See PhysicsSettings::layerCollisionMatrix)
+		* @param p_layer
+		*/
+		void SetLayer(uint32_t p_layer);
+
 		/**
 		* Defines the new activation state for the physical object
 		* @param p_activationState
@@ -239,17 +251,23 @@ namespace OvPhysics::Entities
 		virtual void SetLocalScaling(const OvMaths::FVector3& p_scaling) = 0;
 		void Consider();
 		void Unconsider();
+		void Reconsider();
 
 	private:
+		class MotionState;
+
 		/* Internal */
 		void CreateBody(const Settings::BodySettings& p_bodySettings);
 		Settings::BodySettings DestroyBody();
 		OvMaths::FVector3 CalculateInertia() const;
+		void OnTransformNotification(OvMaths::Internal::TransformNotifier::ENotification p_notification);
 
 		/* Needed by the physics engine */
 		btRigidBody&			GetBody();
 		void					UpdateBtTransform();
 		void					UpdateFTransform();
+		void					ResetInterpolation();
+		void					InterpolateFTransform(float p_alpha);
 
 	public:
 		OvTools::Eventing::Event<PhysicalObject&>			CollisionStartEvent;
@@ -269,6 +287,7 @@ namespace OvPhysics::Entities
 		float					m_mass = 1.f;
 		bool					m_kinematic = false;
 		bool					m_trigger = false;
+		uint32_t				m_layer = 0;
 		bool					m_enabled = true;
 		bool					m_considered = false;
 		ECollisionDetectionMode m_collisionMode = ECollisionDetectionMode::DISCRETE;
@@ -276,8 +295,27 @@ namespace OvPhysics::Entities
 		/* Other */
 		std::any m_userData;
 		OvMaths::FVector3 m_previousScale = { 0.0f, 0.0f, 0.0f };
+
+		/* Last two simulated states, and the transform written by the physics engine (Any other value has been set externally) */
+		OvMaths::FVector3 m_previousPosition;
+		OvMaths::FQuaternion m_previousRotation;
+		OvMaths::FVector3 m_currentPosition;
+		OvMaths::FQuaternion m_currentRotation;
+		OvMaths::FVector3 m_writtenPosition;
+		OvMaths::FQuaternion m_writtenRotation;
+
+		/* Transform synchronization, only the objects moved externally or simulated by Bullet are synced */
+		std::optional<OvMaths::Internal::TransformNotifier::NotificationHandlerID> m_transformHandlerID;
+		bool m_transformDirty = true;
+		bool m_writingTransform = false;
+
+		/* Identifies the object in the contact pairs of the physics engine */
+		uint32_t m_id = 0;
+
 		static OvTools::Eventing::Event<PhysicalObject&>	CreatedEvent;
 		static OvTools::Eventing::Event<PhysicalObject&>	DestroyedEvent;
+		static OvTools::Eventing::Event<PhysicalObject&>	MovedEvent;
+		static OvTools::Eventing::Event<PhysicalObject&>	SimulatedEvent;
 		static OvTools::Eventing::Event<btRigidBody&>		ConsiderEvent;
 		static OvTools::Eventing::Event<btRigidBody&>		UnconsiderEvent;
 
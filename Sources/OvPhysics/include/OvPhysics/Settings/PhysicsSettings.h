@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+
 #include <OvMaths/FVector3.h>
 
 namespace OvPhysics::Settings
@@ -15,6 +18,39 @@ namespace OvPhysics::Settings
 	*/
 	struct PhysicsSettings
 	{
+		/**
+		* Number of collision layers a physical object can be assigned to
+		*/
+		static constexpr uint32_t kLayerCount = 16;
+
 		OvMaths::FVector3 gravity = { 0.0f, -9.81f, 0.f };
+
+		/**
+		* Duration of a simulation step. Frame times are accumulated and consumed in steps of this duration
+		*/
+		float fixedTimeStep = 1.0f / 60.0f;
+
+		/**
+		* Maximum number of steps simulated in a single update. Time accumulated beyond that (Ex: after a hitch) is dropped,
+		* slowing the simulation down instead of spiraling into always longer frames
+		*/
+		uint32_t maxSteps = 4;
+
+		/**
+		* If true, the transforms of simulated bodies are interpolated between their last two simulated states,
+		* with the time left in the accumulator, so the motion stays smooth when the frame rate differs from the step rate
+		*/
+		bool interpolation = true;
+
+		/**
+		* Collision matrix between layers: bit B of row A is set if the objects of layer A collide with the ones of layer B.
+		* The matrix is expected to be symmetric, every layer collides with every other one by default
+		*/
+		std::array<uint16_t, kLayerCount> layerCollisionMatrix = []
+		{
+			std::array<uint16_t, kLayerCount> matrix;
+			matrix.fill(0xFFFF);
+			return matrix;
+		}();
 	};
 }
\ No newline at end of file
@@ -18,6 +18,7 @@ project "OvPhysics"
 		-- Dependencies
 		dependdir .. "bullet3/",
 		dependdir .. "bullet3/bullet",
+		dependdir .. "tracy",
 
 		-- Overload SDK
 		"%{wks.location}/Sources/OvDebug/include",
@@ -0,0 +1,83 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+
+#include <OvPhysics/Core/ContactPairSet.h>
+
+bool OvPhysics::Core::ContactPairSet::Insert(uint32_t p_first, uint32_t p_second)
+{
+	// Keep the load factor under 1/2, probe sequences stay short
+	if ((m_keys.size() + 1) * 2 > m_slots.size())
+		Grow();
+
+	const uint64_t key = MakeKey(p_first, p_second);
+	const uint32_t slot = FindSlot(key);
+
+	if (m_slots[slot] != 0)
+		return false;
+
+	m_keys.push_back(key);
+	m_keySlots.push_back(slot);
+	m_slots[slot] = static_cast<uint32_t>(m_keys.size());
+
+	return true;
+}
+
+bool OvPhysics::Core::ContactPairSet::Contains(uint64_t p_key) const
+{
+	return !m_slots.empty() && m_slots[FindSlot(p_key)] != 0;
+}
+
+void OvPhysics::Core::ContactPairSet::Clear()
+{
+	for (const uint32_t slot : m_keySlots)
+		m_slots[slot] = 0;
+
+	m_keys.clear();
+	m_keySlots.clear();
+}
+
+const std::vector<uint64_t>& OvPhysics::Core::ContactPairSet::GetKeys() const
+{
+	return m_keys;
+}
+
+uint64_t OvPhysics::Core::ContactPairSet::MakeKey(uint32_t p_first, uint32_t p_second)
+{
+	if (p_first > p_second)
+		std::swap(p_first, p_second);
+
+	return (static_cast<uint64_t>(p_first) << 32) | p_second;
+}
+
+std::pair<uint32_t, uint32_t> OvPhysics::Core::ContactPairSet::SplitKey(uint64_t p_key)
+{
+	return { static_cast<uint32_t>(p_key >> 32), static_cast<uint32_t>(p_key) };
+}
+
+uint32_t OvPhysics::Core::ContactPairSet::FindSlot(uint64_t p_key) const
+{
+	// The capacity is a power of two, masking the upper half of the Fibonacci hash keeps the pairs well spread
+	const uint32_t mask = static_cast<uint32_t>(m_slots.size()) - 1;
+	uint32_t slot = static_cast<uint32_t>((p_key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+
+	while (m_slots[slot] != 0 && m_keys[m_slots[slot] - 1] != p_key)
+		slot = (slot + 1) & mask;
+
+	return slot;
+}
+
+void OvPhysics::Core::ContactPairSet::Grow()
+{
+	m_slots.assign(std::max<size_t>(m_slots.size() * 2, 64), 0);
+
+	for (size_t i = 0; i < m_keys.size(); ++i)
+	{
+		m_keySlots[i] = FindSlot(m_keys[i]);
+		m_slots[m_keySlots[i]] = static_cast<uint32_t>(i + 1);
+	}
+}
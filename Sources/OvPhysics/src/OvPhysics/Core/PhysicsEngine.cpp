@@ -5,12 +5,20 @@
 */
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <variant>
 
 #include <bullet/btBulletCollisionCommon.h>
 #include <bullet/btBulletDynamicsCommon.h>
+#include <bullet/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.h>
+#include <bullet/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.h>
+#include <bullet/BulletCollision/NarrowPhaseCollision/btPointCollector.h>
+
+#include <tracy/Tracy.hpp>
 
 #include <OvDebug/Logger.h>
+#include <OvTools/Utils/ThreadPool.h>
 
 #include <OvPhysics/Core/PhysicsEngine.h>
 #include <OvPhysics/Entities/PhysicalObject.h>
@@ -18,10 +26,388 @@
 
 using namespace OvPhysics::Tools;
 using namespace OvPhysics::Entities;
+using namespace OvPhysics::Core;
+
+namespace
+{
+	struct WakeUpCallback : public btBroadphaseAabbCallback
+	{
+		bool process(const btBroadphaseProxy* p_proxy) override
+		{
+			// Static bodies are left untouched
+			static_cast<btCollisionObject*>(p_proxy->m_clientObject)->activate();
+			return true;
+		}
+	};
+
+	/**
+	* Filters the broadphase pairs by collision group and mask (See PhysicsEngine::Consider), and drops the pairs of triggers,
+	* which never report anything to each other
+	*/
+	struct LayerFilterCallback : public btOverlapFilterCallback
+	{
+		bool needBroadphaseCollision(btBroadphaseProxy* p_first, btBroadphaseProxy* p_second) const override
+		{
+			if ((p_first->m_collisionFilterGroup & p_second->m_collisionFilterMask) == 0 ||
+				(p_second->m_collisionFilterGroup & p_first->m_collisionFilterMask) == 0)
+				return false;
+
+			const auto first = static_cast<const btCollisionObject*>(p_first->m_clientObject);
+			const auto second = static_cast<const btCollisionObject*>(p_second->m_clientObject);
+
+			return first->hasContactResponse() || second->hasContactResponse();
+		}
+	};
+
+	/* Groups of the static and kinematic bodies are shifted to the upper half of the filter bits */
+	constexpr uint32_t kStaticGroupShift = 16;
+
+	constexpr size_t kQueryChunkSize = 16;
+
+	using QueryConvexShape = std::variant<btSphereShape, btBoxShape, btCapsuleShape>;
+
+	QueryConvexShape CreateQueryShape(const QueryShape& p_shape)
+	{
+		switch (p_shape.type)
+		{
+		case EQueryShape::BOX:		return QueryConvexShape(std::in_place_type<btBoxShape>, Conversion::ToBtVector3(p_shape.halfExtents));
+		case EQueryShape::CAPSULE:	return QueryConvexShape(std::in_place_type<btCapsuleShape>, p_shape.radius, p_shape.height);
+		default:					return QueryConvexShape(std::in_place_type<btSphereShape>, p_shape.radius);
+		}
+	}
+
+	const btConvexShape& GetConvexShape(const QueryConvexShape& p_shape)
+	{
+		return std::visit([](const auto& p_concreteShape) -> const btConvexShape& { return p_concreteShape; }, p_shape);
+	}
+
+	/**
+	* Gathers the broadphase proxies passing the query filter. Queries can run on any thread, so the broadphase
+	* is traversed with a stack local to the thread rather than with the broadphase's own stack
+	*/
+	class CandidateCollector : public btDbvt::ICollide
+	{
+	public:
+		struct Candidate
+		{
+			btCollisionObject* object;
+			btScalar entry;	// Distance along the segment where the candidate bounds are entered
+		};
+
+		CandidateCollector(const QueryFilter& p_filter) : m_filter(p_filter)
+		{
+			m_candidates.clear();
+		}
+
+		void Process(const btDbvtNode* p_leaf) override
+		{
+			const auto proxy = static_cast<const btBroadphaseProxy*>(p_leaf->data);
+			const auto collisionObject = static_cast<btCollisionObject*>(proxy->m_clientObject);
+			const auto physicalObject = static_cast<const PhysicalObject*>(collisionObject->getUserPointer());
+
+			if (!physicalObject || physicalObject == m_filter.ignoredObject ||
+				((1u << physicalObject->GetLayer()) & m_filter.layerMask) == 0 ||
+				(!m_filter.includeTriggers && physicalObject->IsTrigger()))
+				return;
 
-std::map<std::pair<PhysicalObject*, PhysicalObject*>, bool> OvPhysics::Core::PhysicsEngine::m_collisionEvents;
+			btScalar entry = btScalar(0.0);
 
-OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings)
+			if (m_segment)
+			{
+				const btVector3 bounds[2] = { p_leaf->volume.Mins() - m_aabbMax, p_leaf->volume.Maxs() - m_aabbMin };
+				btRayAabb2(m_from, m_directionInverse, m_signs, bounds, entry, btScalar(0.0), m_length);
+			}
+
+			m_candidates.push_back({ collisionObject, std::max(entry, btScalar(0.0)) });
+		}
+
+		void CollectAlongSegment(const btDbvtBroadphase& p_broadphase, const btVector3& p_from, const btVector3& p_to, const btVector3& p_aabbMin, const btVector3& p_aabbMax)
+		{
+			const btVector3 direction = (p_to - p_from).normalized();
+
+			m_segment = true;
+			m_from = p_from;
+			m_aabbMin = p_aabbMin;
+			m_aabbMax = p_aabbMax;
+			m_length = direction.dot(p_to - p_from);
+
+			for (int i = 0; i < 3; ++i)
+			{
+				m_directionInverse[i] = direction[i] == btScalar(0.0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1.0) / direction[i];
+				m_signs[i] = m_directionInverse[i] < 0.0;
+			}
+
+			for (const btDbvt& set : p_broadphase.m_sets)
+				set.rayTestInternal(set.m_root, p_from, p_to, m_directionInverse, m_signs, m_length, p_aabbMin, p_aabbMax, m_stack, *this);
+		}
+
+		void CollectInVolume(const btDbvtBroadphase& p_broadphase, const btVector3& p_aabbMin, const btVector3& p_aabbMax)
+		{
+			const btDbvtVolume volume = btDbvtVolume::FromMM(p_aabbMin, p_aabbMax);
+
+			for (const btDbvt& set : p_broadphase.m_sets)
+				set.collideTVNoStackAlloc(set.m_root, volume, m_stack, *this);
+		}
+
+		/**
+		* Sort the candidates by entry distance, so a closest hit query can stop at the first candidate entered after its current hit
+		*/
+		void SortByEntry()
+		{
+			std::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& p_a, const Candidate& p_b) { return p_a.entry < p_b.entry; });
+		}
+
+		const std::vector<Candidate>& GetCandidates() const
+		{
+			return m_candidates;
+		}
+
+		btScalar GetLength() const
+		{
+			return m_length;
+		}
+
+	private:
+		const QueryFilter& m_filter;
+
+		bool m_segment = false;
+		btVector3 m_from;
+		btVector3 m_directionInverse;
+		btVector3 m_aabbMin;
+		btVector3 m_aabbMax;
+		unsigned int m_signs[3] = {};
+		btScalar m_length = btScalar(0.0);
+
+		static thread_local btAlignedObjectArray<const btDbvtNode*> m_stack;
+		static thread_local std::vector<Candidate> m_candidates;
+	};
+
+	thread_local btAlignedObjectArray<const btDbvtNode*> CandidateCollector::m_stack;
+	thread_local std::vector<CandidateCollector::Candidate> CandidateCollector::m_candidates;
+
+	/**
+	* Stores the hits of a query according to its mode, the returned fraction is the one Bullet keeps testing against
+	*/
+	class HitCollector
+	{
+	public:
+		HitCollector(EQueryMode p_mode, float p_distance, std::vector<QueryHit>& p_hits) :
+			m_mode(p_mode), m_distance(p_distance), m_hits(p_hits), m_first(p_hits.size())
+		{
+		}
+
+		btScalar Add(const btCollisionObject* p_object, const btVector3& p_point, const btVector3& p_normal, btScalar p_fraction, btScalar p_closestFraction)
+		{
+			const QueryHit hit
+			{
+				static_cast<PhysicalObject*>(p_object->getUserPointer()),
+				Conversion::ToOvVector3(p_point),
+				Conversion::ToOvVector3(p_normal),
+				p_fraction * m_distance
+			};
+
+			switch (m_mode)
+			{
+			case EQueryMode::ALL:
+				m_hits.push_back(hit);
+				return p_closestFraction;
+
+			case EQueryMode::ANY:
+				// A null fraction stops the query
+				m_hits.push_back(hit);
+				return btScalar(0.0);
+
+			default:
+				// Bullet only reports hits closer than the current one
+				if (m_hits.size() == m_first)
+					m_hits.push_back(hit);
+				else
+					m_hits[m_first] = hit;
+				return p_fraction;
+			}
+		}
+
+		/**
+		* Returns true if no candidate entered at the given fraction of the query (Or further) can be reported
+		* @param p_entryFraction
+		*/
+		bool IsDone(btScalar p_entryFraction) const
+		{
+			if (m_hits.size() == m_first)
+				return false;
+
+			return m_mode == EQueryMode::ANY || (m_mode == EQueryMode::CLOSEST && p_entryFraction * m_distance > m_hits[m_first].distance);
+		}
+
+		void Finish()
+		{
+			if (m_mode == EQueryMode::ALL)
+				std::sort(m_hits.begin() + m_first, m_hits.end(), [](const QueryHit& p_a, const QueryHit& p_b) { return p_a.distance < p_b.distance; });
+		}
+
+	private:
+		const EQueryMode m_mode;
+		const float m_distance;
+		std::vector<QueryHit>& m_hits;
+		const size_t m_first;
+	};
+
+	struct RayCallback : public btCollisionWorld::RayResultCallback
+	{
+		RayCallback(HitCollector& p_collector, const btVector3& p_from, const btVector3& p_to) :
+			collector(p_collector), from(p_from), to(p_to)
+		{
+		}
+
+		btScalar addSingleResult(btCollisionWorld::LocalRayResult& p_result, bool p_normalInWorldSpace) override
+		{
+			const btVector3 normal = p_normalInWorldSpace ? p_result.m_hitNormalLocal : p_result.m_collisionObject->getWorldTransform().getBasis() * p_result.m_hitNormalLocal;
+			m_collisionObject = p_result.m_collisionObject;
+			m_closestHitFraction = collector.Add(p_result.m_collisionObject, from.lerp(to, p_result.m_hitFraction), normal, p_result.m_hitFraction, m_closestHitFraction);
+			return m_closestHitFraction;
+		}
+
+		HitCollector& collector;
+		const btVector3 from;
+		const btVector3 to;
+	};
+
+	struct SweepCallback : public btCollisionWorld::ConvexResultCallback
+	{
+		SweepCallback(HitCollector& p_collector) : collector(p_collector)
+		{
+		}
+
+		btScalar addSingleResult(btCollisionWorld::LocalConvexResult& p_result, bool p_normalInWorldSpace) override
+		{
+			// The hit point of a convex result is already in world space
+			const btVector3 normal = p_normalInWorldSpace ? p_result.m_hitNormalLocal : p_result.m_hitCollisionObject->getWorldTransform().getBasis() * p_result.m_hitNormalLocal;
+			m_closestHitFraction = collector.Add(p_result.m_hitCollisionObject, p_result.m_hitPointLocal, normal, p_result.m_hitFraction, m_closestHitFraction);
+			return m_closestHitFraction;
+		}
+
+		HitCollector& collector;
+	};
+
+	void RunRaycast(const btDbvtBroadphase& p_broadphase, const RaycastQuery& p_query, std::vector<QueryHit>& p_hits)
+	{
+		const float length = OvMaths::FVector3::Length(p_query.direction);
+
+		if (length == 0.0f || p_query.distance <= 0.0f)
+			return;
+
+		const btVector3 from = Conversion::ToBtVector3(p_query.origin);
+		const btVector3 to = Conversion::ToBtVector3(p_query.origin + p_query.direction * (p_query.distance / length));
+		const btTransform fromTransform(btQuaternion::getIdentity(), from);
+		const btTransform toTransform(btQuaternion::getIdentity(), to);
+
+		CandidateCollector candidates(p_query.filter);
+		candidates.CollectAlongSegment(p_broadphase, from, to, btVector3(0.0f, 0.0f, 0.0f), btVector3(0.0f, 0.0f, 0.0f));
+
+		if (p_query.mode == EQueryMode::CLOSEST)
+			candidates.SortByEntry();
+
+		HitCollector collector(p_query.mode, p_query.distance, p_hits);
+		RayCallback callback(collector, from, to);
+
+		for (const auto& [candidate, entry] : candidates.GetCandidates())
+		{
+			if (collector.IsDone(entry / candidates.GetLength()))
+				break;
+
+			btCollisionWorld::rayTestSingle(fromTransform, toTransform, candidate, candidate->getCollisionShape(), candidate->getWorldTransform(), callback);
+		}
+
+		collector.Finish();
+	}
+
+	void RunSweep(const btDbvtBroadphase& p_broadphase, const SweepQuery& p_query, std::vector<QueryHit>& p_hits)
+	{
+		const float length = OvMaths::FVector3::Length(p_query.direction);
+
+		if (length == 0.0f || p_query.distance <= 0.0f)
+			return;
+
+		const QueryConvexShape shape = CreateQueryShape(p_query.shape);
+		const btConvexShape& castShape = GetConvexShape(shape);
+		const btQuaternion rotation = Conversion::ToBtQuaternion(p_query.shape.rotation);
+
+		const btVector3 from = Conversion::ToBtVector3(p_query.origin);
+		const btVector3 to = Conversion::ToBtVector3(p_query.origin + p_query.direction * (p_query.distance / length));
+		const btTransform fromTransform(rotation, from);
+		const btTransform toTransform(rotation, to);
+
+		// Broadphase nodes are extended by the bounds of the shape, relative to its center
+		btVector3 shapeMin, shapeMax;
+		castShape.getAabb(btTransform(rotation), shapeMin, shapeMax);
+
+		CandidateCollector candidates(p_query.filter);
+		candidates.CollectAlongSegment(p_broadphase, from, to, shapeMin, shapeMax);
+
+		if (p_query.mode == EQueryMode::CLOSEST)
+			candidates.SortByEntry();
+
+		HitCollector collector(p_query.mode, p_query.distance, p_hits);
+		SweepCallback callback(collector);
+
+		for (const auto& [candidate, entry] : candidates.GetCandidates())
+		{
+			if (collector.IsDone(entry / candidates.GetLength()))
+				break;
+
+			btCollisionWorld::objectQuerySingle(&castShape, fromTransform, toTransform, candidate, candidate->getCollisionShape(), candidate->getWorldTransform(), callback, 0.0f);
+		}
+
+		collector.Finish();
+	}
+
+	void RunOverlap(const btDbvtBroadphase& p_broadphase, const OverlapQuery& p_query, std::vector<QueryHit>& p_hits)
+	{
+		const QueryConvexShape shape = CreateQueryShape(p_query.shape);
+		const btConvexShape& queryShape = GetConvexShape(shape);
+		const btTransform transform(Conversion::ToBtQuaternion(p_query.shape.rotation), Conversion::ToBtVector3(p_query.position));
+
+		btVector3 aabbMin, aabbMax;
+		queryShape.getAabb(transform, aabbMin, aabbMax);
+
+		CandidateCollector candidates(p_query.filter);
+		candidates.CollectInVolume(p_broadphase, aabbMin, aabbMax);
+
+		for (const auto& candidate : candidates.GetCandidates())
+		{
+			const btCollisionObject* object = candidate.object;
+
+			// Physical objects only use convex shapes
+			if (!object->getCollisionShape()->isConvex())
+				continue;
+
+			btVoronoiSimplexSolver simplexSolver;
+			btGjkEpaPenetrationDepthSolver penetrationSolver;
+			btGjkPairDetector detector(&queryShape, static_cast<const btConvexShape*>(object->getCollisionShape()), &simplexSolver, &penetrationSolver);
+
+			btGjkPairDetector::ClosestPointInput input;
+			input.m_transformA = transform;
+			input.m_transformB = object->getWorldTransform();
+
+			btPointCollector result;
+			detector.getClosestPoints(input, result, nullptr);
+
+			if (result.m_hasResult && result.m_distance <= btScalar(0.0))
+			{
+				p_hits.push_back({ static_cast<PhysicalObject*>(object->getUserPointer()), Conversion::ToOvVector3(result.m_pointInWorld), Conversion::ToOvVector3(result.m_normalOnBInWorld), 0.0f });
+
+				if (p_query.mode != EQueryMode::ALL)
+					break;
+			}
+		}
+	}
+}
+
+OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings) :
+	m_fixedTimeStep(std::max(p_settings.fixedTimeStep, 0.0001f)),
+	m_maxSteps(std::max(p_settings.maxSteps, 1u)),
+	m_interpolation(p_settings.interpolation),
+	m_layerCollisionMatrix(p_settings.layerCollisionMatrix)
 {
 	m_collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
 	m_dispatcher = std::make_unique<btCollisionDispatcher>(m_collisionConfig.get());
@@ -29,10 +415,15 @@ OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings &
 	m_solver = std::make_unique<btSequentialImpulseConstraintSolver>();
 	m_world = std::make_unique<btDiscreteDynamicsWorld>(m_dispatcher.get(), m_broadphase.get(), m_solver.get(), m_collisionConfig.get());
 
+	m_overlapFilter = std::make_unique<LayerFilterCallback>();
+	m_world->getPairCache()->setOverlapFilterCallback(m_overlapFilter.get());
+
 	m_world->setGravity(Conversion::ToBtVector3(p_settings.gravity));
 
+	// Only the awake bodies move during a step, the others are updated when moved externally
+	m_world->setForceUpdateAllAabbs(false);
+
 	ListenToPhysicalObjects();
-	SetCollisionCallback();
 }
 
 OvPhysics::Core::PhysicsEngine::~PhysicsEngine()
@@ -42,29 +433,96 @@ OvPhysics::Core::PhysicsEngine::~PhysicsEngine()
 
 void OvPhysics::Core::PhysicsEngine::PreUpdate()
 {
-	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateBtTransform));
-
-	ResetCollisionEvents();
+	ApplyExternalTransforms();
 }
 
 void OvPhysics::Core::PhysicsEngine::PostUpdate()
 {
-	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateFTransform));
+	// Bodies of the last step that are not simulated anymore fell asleep, they have nothing left to interpolate
+	std::for_each(m_interpolatedObjects.begin(), m_interpolatedObjects.end(), std::mem_fn(&PhysicalObject::ResetInterpolation));
+	std::for_each(m_simulatedObjects.begin(), m_simulatedObjects.end(), std::mem_fn(&PhysicalObject::UpdateFTransform));
+
+	std::swap(m_interpolatedObjects, m_simulatedObjects);
+	m_simulatedObjects.clear();
+
+	GatherContacts();
+	DispatchCollisionEvents();
+}
+
+void OvPhysics::Core::PhysicsEngine::ApplyExternalTransforms()
+{
+	for (PhysicalObject* object : m_movedObjects)
+	{
+		btVector3 previousMin, previousMax;
+		object->GetBody().getAabb(previousMin, previousMax);
+
+		object->UpdateBtTransform();
 
-	CheckCollisionStopEvents();
+		// The body can be recreated by UpdateBtTransform (Scale change)
+		btRigidBody& body = object->GetBody();
+
+		if (body.isInWorld())
+		{
+			btVector3 min, max;
+			m_world->updateSingleAabb(&body);
+			body.getAabb(min, max);
+
+			// Wake up the bodies around both the previous and the new location, as sleeping bodies don't collide with static ones
+			min.setMin(previousMin);
+			max.setMax(previousMax);
+			WakeUpBodies(min, max);
+		}
+	}
+
+	m_movedObjects.clear();
 }
 
-bool OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime)
+void OvPhysics::Core::PhysicsEngine::InterpolateTransforms(float p_alpha)
 {
-	PreUpdate();
+	// Moved externally, the new transform wins over the simulated one
+	ApplyExternalTransforms();
 
-	if (m_world->stepSimulation(p_deltaTime, 10))
+	for (PhysicalObject* object : m_interpolatedObjects)
+		object->InterpolateFTransform(p_alpha);
+}
+
+uint32_t OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdate)
+{
+	m_accumulator += std::max(p_deltaTime, 0.0f);
+
+	uint32_t steps = static_cast<uint32_t>(m_accumulator / m_fixedTimeStep);
+
+	if (steps > m_maxSteps)
 	{
+		steps = m_maxSteps;
+		m_accumulator = 0.0f;
+	}
+	else
+	{
+		m_accumulator -= static_cast<float>(steps) * m_fixedTimeStep;
+	}
+
+	// Steps start from the last simulated state, rather than from the interpolated one
+	if (steps > 0 && m_interpolation)
+		InterpolateTransforms(1.0f);
+
+	for (uint32_t step = 0; step < steps; ++step)
+	{
+		PreUpdate();
+		m_world->stepSimulation(m_fixedTimeStep, 0);
 		PostUpdate();
-		return true;
+
+		if (p_fixedUpdate)
+			p_fixedUpdate(m_fixedTimeStep);
 	}
 
-	return false;
+	InterpolateTransforms(m_interpolation ? m_accumulator / m_fixedTimeStep : 1.0f);
+
+	TracyPlot("Physics Broadphase Pairs", static_cast<int64_t>(m_world->getPairCache()->getNumOverlappingPairs()));
+	TracyPlot("Physics Manifolds", static_cast<int64_t>(m_dispatcher->getNumManifolds()));
+	TracyPlot("Physics Contact Pairs", static_cast<int64_t>(m_contacts.GetKeys().size()));
+
+	return steps;
 }
 
 std::optional<RaycastHit> OvPhysics::Core::PhysicsEngine::Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance)
@@ -72,37 +530,110 @@ std::optional<RaycastHit> OvPhysics::Core::PhysicsEngine::Raycast(OvMaths::FVect
 	if (p_direction == OvMaths::FVector3::Zero)
 		return {};
 
-	btVector3 origin = Tools::Conversion::ToBtVector3(p_origin);
-	btVector3 target = Tools::Conversion::ToBtVector3(p_origin + p_direction * p_distance);
+	// A single pass gathers every hit, sorted by distance, the first one being the closest
+	const RaycastQuery query{ p_origin, p_direction, p_distance * OvMaths::FVector3::Length(p_direction), EQueryMode::ALL, QueryFilter{} };
+
+	QueryResults results;
+	Raycast({ &query, 1 }, results, false);
+
+	if (!results.HasHit(0))
+		return {};
 
 	RaycastHit resultHit;
+	resultHit.FirstResultObject = results.GetHits(0).front().object;
 
-	// Try to get First Hit
-	btCollisionWorld::ClosestRayResultCallback ClosestRayCallback(origin, target);
-	m_world->rayTest(origin, target, ClosestRayCallback);
+	for (const QueryHit& hit : results.GetHits(0))
+		resultHit.ResultObjects.push_back(hit.object);
 
-	if (ClosestRayCallback.hasHit())
+	return resultHit;
+}
+
+void OvPhysics::Core::PhysicsEngine::Raycast(std::span<const RaycastQuery> p_queries, QueryResults& p_results, bool p_parallel) const
+{
+	const auto& broadphase = static_cast<const btDbvtBroadphase&>(*m_broadphase);
+
+	RunQueries(p_queries.size(), p_results, p_parallel, [&broadphase, p_queries](size_t p_index, std::vector<QueryHit>& p_hits)
+	{
+		RunRaycast(broadphase, p_queries[p_index], p_hits);
+	});
+}
+
+void OvPhysics::Core::PhysicsEngine::Sweep(std::span<const SweepQuery> p_queries, QueryResults& p_results, bool p_parallel) const
+{
+	const auto& broadphase = static_cast<const btDbvtBroadphase&>(*m_broadphase);
+
+	RunQueries(p_queries.size(), p_results, p_parallel, [&broadphase, p_queries](size_t p_index, std::vector<QueryHit>& p_hits)
 	{
-		// Get First Hit
-		resultHit.FirstResultObject = reinterpret_cast<OvPhysics::Entities::PhysicalObject*>(ClosestRayCallback.m_collisionObject->getUserPointer());
+		RunSweep(broadphase, p_queries[p_index], p_hits);
+	});
+}
 
-		// Try to get all Hit
-		btCollisionWorld::AllHitsRayResultCallback rayCallback(origin, target);
-		m_world->rayTest(origin, target, rayCallback);
+void OvPhysics::Core::PhysicsEngine::Overlap(std::span<const OverlapQuery> p_queries, QueryResults& p_results, bool p_parallel) const
+{
+	const auto& broadphase = static_cast<const btDbvtBroadphase&>(*m_broadphase);
 
-		// Get all Hit
-		for (int i = 0; i < rayCallback.m_collisionObjects.size(); i++)
-			resultHit.ResultObjects.push_back(reinterpret_cast<OvPhysics::Entities::PhysicalObject*>(rayCallback.m_collisionObjects[i]->getUserPointer()));
+	RunQueries(p_queries.size(), p_results, p_parallel, [&broadphase, p_queries](size_t p_index, std::vector<QueryHit>& p_hits)
+	{
+		RunOverlap(broadphase, p_queries[p_index], p_hits);
+	});
+}
 
-		return resultHit;
+void OvPhysics::Core::PhysicsEngine::RunQueries(size_t p_count, QueryResults& p_results, bool p_parallel, const std::function<void(size_t, std::vector<QueryHit>&)>& p_query) const
+{
+	// Queries are processed in chunks, each chunk writing its hits to its own buffer
+	const size_t chunkCount = (p_count + kQueryChunkSize - 1) / kQueryChunkSize;
+
+	p_results.m_ranges.resize(p_count);
+
+	if (p_results.m_chunkHits.size() < chunkCount)
+		p_results.m_chunkHits.resize(chunkCount);
+
+	const auto runChunk = [&p_results, &p_query, p_count](uint32_t p_chunk)
+	{
+		std::vector<QueryHit>& hits = p_results.m_chunkHits[p_chunk];
+		hits.clear();
+
+		for (size_t i = p_chunk * kQueryChunkSize; i < std::min(p_count, (p_chunk + 1) * kQueryChunkSize); ++i)
+		{
+			const size_t first = hits.size();
+			p_query(i, hits);
+			p_results.m_ranges[i] = { static_cast<uint32_t>(first), static_cast<uint32_t>(hits.size() - first) };
+		}
+	};
+
+	if (p_parallel && chunkCount > 1)
+	{
+		OvTools::Utils::ThreadPool::GetDefault().ParallelFor(static_cast<uint32_t>(chunkCount), runChunk);
 	}
 	else
-		return {};
+	{
+		for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+			runChunk(chunk);
+	}
+
+	// Merge the chunks, ranges become relative to the whole batch
+	p_results.m_hits.clear();
+
+	for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+	{
+		const auto offset = static_cast<uint32_t>(p_results.m_hits.size());
+
+		for (size_t i = chunk * kQueryChunkSize; i < std::min(p_count, (chunk + 1) * kQueryChunkSize); ++i)
+			p_results.m_ranges[i].first += offset;
+
+		p_results.m_hits.insert(p_results.m_hits.end(), p_results.m_chunkHits[chunk].begin(), p_results.m_chunkHits[chunk].end());
+	}
 }
 
 void OvPhysics::Core::PhysicsEngine::SetGravity(const OvMaths::FVector3 & p_gravity)
 {
 	m_world->setGravity(Conversion::ToBtVector3(p_gravity));
+
+	// Sleeping bodies would otherwise ignore the new gravity
+	const btCollisionObjectArray& objects = m_world->getCollisionObjectArray();
+
+	for (int i = 0; i < objects.size(); ++i)
+		objects[i]->activate();
 }
 
 OvMaths::FVector3 OvPhysics::Core::PhysicsEngine::GetGravity() const
@@ -110,6 +641,36 @@ OvMaths::FVector3 OvPhysics::Core::PhysicsEngine::GetGravity() const
 	return Conversion::ToOvVector3(m_world->getGravity());
 }
 
+void OvPhysics::Core::PhysicsEngine::SetLayerCollision(uint32_t p_first, uint32_t p_second, bool p_collide)
+{
+	if (p_first >= m_layerCollisionMatrix.size() || p_second >= m_layerCollisionMatrix.size())
+	{
+		OVLOG_WARNING("Invalid collision layers, the layer collision matrix is left untouched");
+		return;
+	}
+
+	if (p_collide)
+	{
+		m_layerCollisionMatrix[p_first] |= static_cast<uint16_t>(1u << p_second);
+		m_layerCollisionMatrix[p_second] |= static_cast<uint16_t>(1u << p_first);
+	}
+	else
+	{
+		m_layerCollisionMatrix[p_first] &= static_cast<uint16_t>(~(1u << p_second));
+		m_layerCollisionMatrix[p_second] &= static_cast<uint16_t>(~(1u << p_first));
+	}
+
+	// Filters are computed when bodies enter the world, they have to enter it again
+	for (PhysicalObject& object : m_physicalObjects)
+		object.Reconsider();
+}
+
+bool OvPhysics::Core::PhysicsEngine::GetLayerCollision(uint32_t p_first, uint32_t p_second) const
+{
+	return p_first < m_layerCollisionMatrix.size() && p_second < m_layerCollisionMatrix.size() &&
+		(m_layerCollisionMatrix[p_first] & (1u << p_second)) != 0;
+}
+
 void OvPhysics::Core::PhysicsEngine::ListenToPhysicalObjects()
 {
 	PhysicalObject::CreatedEvent += std::bind(static_cast<void(PhysicsEngine::*)(PhysicalObject&)>(&PhysicsEngine::Consider), this, std::placeholders::_1);
@@ -117,11 +678,45 @@ void OvPhysics::Core::PhysicsEngine::ListenToPhysicalObjects()
 
 	PhysicalObject::ConsiderEvent += std::bind(static_cast<void(PhysicsEngine::*)(btRigidBody&)>(&PhysicsEngine::Consider), this, std::placeholders::_1);
 	PhysicalObject::UnconsiderEvent += std::bind(static_cast<void(PhysicsEngine::*)(btRigidBody&)>(&PhysicsEngine::Unconsider), this, std::placeholders::_1);
+
+	PhysicalObject::MovedEvent += std::bind(&PhysicsEngine::OnObjectMoved, this, std::placeholders::_1);
+	PhysicalObject::SimulatedEvent += std::bind(&PhysicsEngine::OnObjectSimulated, this, std::placeholders::_1);
+}
+
+void OvPhysics::Core::PhysicsEngine::OnObjectMoved(PhysicalObject& p_object)
+{
+	m_movedObjects.push_back(&p_object);
+}
+
+void OvPhysics::Core::PhysicsEngine::OnObjectSimulated(PhysicalObject& p_object)
+{
+	m_simulatedObjects.push_back(&p_object);
+}
+
+void OvPhysics::Core::PhysicsEngine::WakeUpBodies(const btVector3& p_aabbMin, const btVector3& p_aabbMax)
+{
+	WakeUpCallback callback;
+	m_broadphase->aabbTest(p_aabbMin, p_aabbMax, callback);
 }
 
 void OvPhysics::Core::PhysicsEngine::Consider(PhysicalObject& p_toConsider)
 {
 	m_physicalObjects.push_back(std::ref(p_toConsider));
+
+	if (m_freeIDs.empty())
+	{
+		p_toConsider.m_id = static_cast<uint32_t>(m_objectsByID.size());
+		m_objectsByID.push_back(&p_toConsider);
+	}
+	else
+	{
+		p_toConsider.m_id = m_freeIDs.back();
+		m_freeIDs.pop_back();
+		m_objectsByID[p_toConsider.m_id] = &p_toConsider;
+	}
+
+	// New objects start dirty, their body is synced before the next step
+	m_movedObjects.push_back(&p_toConsider);
 }
 
 void OvPhysics::Core::PhysicsEngine::Unconsider(PhysicalObject& p_toUnconsider)
@@ -134,151 +729,116 @@ void OvPhysics::Core::PhysicsEngine::Unconsider(PhysicalObject& p_toUnconsider)
 
 		if (found != m_physicalObjects.end())
 			m_physicalObjects.erase(found);
-	}
-
-	{
-		decltype(m_collisionEvents)::iterator iter = m_collisionEvents.begin();
-		decltype(m_collisionEvents)::iterator endIter = m_collisionEvents.end();
 
-		for (; iter != endIter; )
-		{
-			if (iter->first.first == std::addressof(p_toUnconsider) || iter->first.second == std::addressof(p_toUnconsider))
-			{
-				m_collisionEvents.erase(iter++);
-			}
-			else {
-				++iter;
-			}
-		}
+		std::erase(m_movedObjects, &p_toUnconsider);
+		std::erase(m_simulatedObjects, &p_toUnconsider);
+		std::erase(m_interpolatedObjects, &p_toUnconsider);
 	}
+
+	// Pairs referencing the object are ignored, its ID is only reused once they are gone
+	m_objectsByID[p_toUnconsider.m_id] = nullptr;
+	m_releasedIDs.push_back(p_toUnconsider.m_id);
 }
 
 void OvPhysics::Core::PhysicsEngine::Consider(btRigidBody& p_toConsider)
 {
-	m_world->addRigidBody(&p_toConsider);
+	const auto object = static_cast<const PhysicalObject*>(p_toConsider.getUserPointer());
+	const uint32_t layer = object ? object->GetLayer() : 0;
+	const uint32_t layerMask = m_layerCollisionMatrix[layer];
+
+	/*
+	* Dynamic bodies use the lower half of the group bits, static and kinematic ones the upper half. A dynamic body collides with both
+	* the dynamic and static bodies of its colliding layers, a static body with the dynamic ones only, so static pairs are never created
+	*/
+	if (p_toConsider.isStaticOrKinematicObject())
+		m_world->addRigidBody(&p_toConsider, static_cast<int>(1u << (layer + kStaticGroupShift)), static_cast<int>(layerMask));
+	else
+		m_world->addRigidBody(&p_toConsider, static_cast<int>(1u << layer), static_cast<int>(layerMask | (layerMask << kStaticGroupShift)));
 }
 
 void OvPhysics::Core::PhysicsEngine::Unconsider(btRigidBody& p_toUnconsider)
 {
+	btVector3 min, max;
+	p_toUnconsider.getAabb(min, max);
+
 	m_world->removeRigidBody(&p_toUnconsider);
-}
 
-void OvPhysics::Core::PhysicsEngine::ResetCollisionEvents()
-{
-	for (auto& element : m_collisionEvents)
-		element.second = false;
+	// Bodies resting on the removed one would keep floating otherwise
+	WakeUpBodies(min, max);
 }
 
-void OvPhysics::Core::PhysicsEngine::CheckCollisionStopEvents()
+void OvPhysics::Core::PhysicsEngine::GatherContacts()
 {
-	for (auto it = m_collisionEvents.begin(); it != m_collisionEvents.end();)
+	std::swap(m_contacts, m_previousContacts);
+	m_contacts.Clear();
+
+	// Manifolds persist while their bodies are sleeping, resting contacts are kept without being tested again
+	for (int i = 0; i < m_dispatcher->getNumManifolds(); ++i)
 	{
-		auto objects = it->first;
-		if (!it->second)
-		{
-			if (!objects.first->IsTrigger() && !objects.second->IsTrigger())
-			{
-				objects.first->CollisionStopEvent.Invoke(*objects.second);
-				objects.second->CollisionStopEvent.Invoke(*objects.first);
-			}
-			else
-			{
-				if (objects.first->IsTrigger())
-					objects.first->TriggerStopEvent.Invoke(*objects.second);
-				else
-					objects.second->TriggerStopEvent.Invoke(*objects.first);
-			}
+		const btPersistentManifold* manifold = m_dispatcher->getManifoldByIndexInternal(i);
 
-			it = m_collisionEvents.erase(it);
-		}
-		else
-			++it;
+		if (manifold->getNumContacts() == 0)
+			continue;
+
+		auto object1 = reinterpret_cast<PhysicalObject*>(manifold->getBody0()->getUserPointer());
+		auto object2 = reinterpret_cast<PhysicalObject*>(manifold->getBody1()->getUserPointer());
+
+		/* If the objects are not all trigger, enter */
+		if (object1 && object2 && (!object1->IsTrigger() || !object2->IsTrigger()))
+			m_contacts.Insert(object1->m_id, object2->m_id);
 	}
 }
 
-bool OvPhysics::Core::PhysicsEngine::CollisionCallback(btManifoldPoint& cp, const btCollisionObjectWrapper* obj1, int id1, int index1, const btCollisionObjectWrapper* obj2, int id2, int index2)
+void OvPhysics::Core::PhysicsEngine::DispatchCollisionEvents()
 {
-	auto object1 = reinterpret_cast<PhysicalObject*>(obj1->getCollisionObject()->getUserPointer());
-	auto object2 = reinterpret_cast<PhysicalObject*>(obj2->getCollisionObject()->getUserPointer());
+	// Objects destroyed by the events can still be in the current contacts, their ID is released after the next step
+	const auto releasedIDs = static_cast<std::ptrdiff_t>(m_releasedIDs.size());
 
-	if (object1 && object2)
+	for (const uint64_t pair : m_contacts.GetKeys())
 	{
-		/* If the objects are not all trigger, enter */
-		if (!object1->IsTrigger() || !object2->IsTrigger())
-		{
-			if (m_collisionEvents.find({ object1 , object2 }) == m_collisionEvents.end())
-			{
-				/* If object is trigger, invoke Trigger event,
-				 * else : is the other object trigger ? yes -> do nothing, no -> invoke Collision event
-				 */
+		if (!m_previousContacts.Contains(pair))
+			DispatchCollisionEvent(pair, &PhysicalObject::TriggerStartEvent, &PhysicalObject::CollisionStartEvent);
 
-				 // Object 1 (Start event)
-				if (object1->IsTrigger())
-					object1->TriggerStartEvent.Invoke(*object2);
-				else
-				{
-					if (!object2->IsTrigger())
-						object1->CollisionStartEvent.Invoke(*object2);
-				}
-				// Object 2 (Start event)
-				if (object2->IsTrigger())
-					object2->TriggerStartEvent.Invoke(*object1);
-				else
-				{
-					if (!object1->IsTrigger())
-						object2->CollisionStartEvent.Invoke(*object1);
-				}
-
-				// Object 1 (Stay event)
-				if (object1->IsTrigger())
-					object1->TriggerStayEvent.Invoke(*object2);
-				else
-				{
-					if (!object2->IsTrigger())
-						object1->CollisionStayEvent.Invoke(*object2);
-				}
-				// Object 2 (Stay event)
-				if (object2->IsTrigger())
-					object2->TriggerStayEvent.Invoke(*object1);
-				else
-				{
-					if (!object1->IsTrigger())
-						object2->CollisionStayEvent.Invoke(*object1);
-				}
+		DispatchCollisionEvent(pair, &PhysicalObject::TriggerStayEvent, &PhysicalObject::CollisionStayEvent);
+	}
 
-				m_collisionEvents[{ object1, object2 }] = true;
-			}
-			else
-			{
-				if (!m_collisionEvents[{ object1, object2 }])
-				{
-					// Object 1 (Stay event)
-					if (object1->IsTrigger())
-						object1->TriggerStayEvent.Invoke(*object2);
-					else
-					{
-						if (!object2->IsTrigger())
-							object1->CollisionStayEvent.Invoke(*object2);
-					}
-					// Object 2 (Stay event)
-					if (object2->IsTrigger())
-						object2->TriggerStayEvent.Invoke(*object1);
-					else
-					{
-						if (!object1->IsTrigger())
-							object2->CollisionStayEvent.Invoke(*object1);
-					}
-
-					m_collisionEvents[{ object1, object2 }] = true;
-				}
-			}
-		}
+	for (const uint64_t pair : m_previousContacts.GetKeys())
+	{
+		if (!m_contacts.Contains(pair))
+			DispatchCollisionEvent(pair, &PhysicalObject::TriggerStopEvent, &PhysicalObject::CollisionStopEvent);
 	}
 
-	return false;
+	// Objects destroyed before this step are in none of the contacts kept for the next one
+	m_freeIDs.insert(m_freeIDs.end(), m_releasedIDs.begin(), m_releasedIDs.begin() + releasedIDs);
+	m_releasedIDs.erase(m_releasedIDs.begin(), m_releasedIDs.begin() + releasedIDs);
 }
 
-void OvPhysics::Core::PhysicsEngine::SetCollisionCallback()
+void OvPhysics::Core::PhysicsEngine::DispatchCollisionEvent(
+	uint64_t p_pairKey,
+	OvTools::Eventing::Event<PhysicalObject&> PhysicalObject::* p_triggerEvent,
+	OvTools::Eventing::Event<PhysicalObject&> PhysicalObject::* p_collisionEvent
+)
 {
-	gContactAddedCallback = &PhysicsEngine::CollisionCallback;
+	const auto [id1, id2] = ContactPairSet::SplitKey(p_pairKey);
+
+	// Each invocation can destroy objects, they are fetched again every time
+	const auto dispatch = [this, p_triggerEvent, p_collisionEvent](uint32_t p_receiver, uint32_t p_other)
+	{
+		PhysicalObject* receiver = m_objectsByID[p_receiver];
+		PhysicalObject* other = m_objectsByID[p_other];
+
+		if (!receiver || !other)
+			return;
+
+		/* If object is trigger, invoke Trigger event,
+		 * else : is the other object trigger ? yes -> do nothing, no -> invoke Collision event
+		 */
+		if (receiver->IsTrigger())
+			(receiver->*p_triggerEvent).Invoke(*other);
+		else if (!other->IsTrigger())
+			(receiver->*p_collisionEvent).Invoke(*other);
+	};
+
+	dispatch(id1, id2);
+	dispatch(id2, id1);
 }
@@ -0,0 +1,23 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <OvPhysics/Core/PhysicsQuery.h>
+
+std::span<const OvPhysics::Core::QueryHit> OvPhysics::Core::QueryResults::GetHits(size_t p_query) const
+{
+	const Range& range = m_ranges[p_query];
+	return { m_hits.data() + range.first, range.count };
+}
+
+bool OvPhysics::Core::QueryResults::HasHit(size_t p_query) const
+{
+	return m_ranges[p_query].count > 0;
+}
+
+size_t OvPhysics::Core::QueryResults::GetQueryCount() const
+{
+	return m_ranges.size();
+}
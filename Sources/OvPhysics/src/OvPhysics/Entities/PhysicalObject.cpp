@@ -4,13 +4,16 @@
 * @licence: MIT
 */
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
 
 #include <bullet/btBulletCollisionCommon.h>
 #include <bullet/btBulletDynamicsCommon.h>
 
 #include <OvDebug/Logger.h>
 #include <OvPhysics/Entities/PhysicalObject.h>
+#include <OvPhysics/Settings/PhysicsSettings.h>
 #include <OvPhysics/Tools/Conversion.h>
 
 using namespace OvPhysics::Tools;
@@ -20,6 +23,37 @@ OvTools::Eventing::Event<OvPhysics::Entities::PhysicalObject&>	OvPhysics::Entiti
 OvTools::Eventing::Event<OvPhysics::Entities::PhysicalObject&>	OvPhysics::Entities::PhysicalObject::DestroyedEvent;
 OvTools::Eventing::Event<btRigidBody&>							OvPhysics::Entities::PhysicalObject::ConsiderEvent;
 OvTools::Eventing::Event<btRigidBody&>							OvPhysics::Entities::PhysicalObject::UnconsiderEvent;
+OvTools::Eventing::Event<OvPhysics::Entities::PhysicalObject&>	OvPhysics::Entities::PhysicalObject::MovedEvent;
+OvTools::Eventing::Event<OvPhysics::Entities::PhysicalObject&>	OvPhysics::Entities::PhysicalObject::SimulatedEvent;
+
+/**
+* Bullet only synchronizes the motion states of the active (Awake and non-static) bodies after a step,
+* which tells the physics engine which objects need their FTransform to be updated
+*/
+class OvPhysics::Entities::PhysicalObject::MotionState : public btMotionState
+{
+public:
+	MotionState(PhysicalObject& p_owner, const btTransform& p_startTransform) :
+		m_owner(p_owner),
+		m_startTransform(p_startTransform)
+	{
+	}
+
+	void getWorldTransform(btTransform& p_worldTransform) const override
+	{
+		p_worldTransform = m_startTransform;
+	}
+
+	void setWorldTransform(const btTransform&) override
+	{
+		// The simulated transform is read from the body itself, without Bullet's motion state interpolation
+		PhysicalObject::SimulatedEvent.Invoke(m_owner);
+	}
+
+private:
+	PhysicalObject& m_owner;
+	const btTransform m_startTransform;
+};
 
 namespace
 {
@@ -56,6 +90,9 @@ OvPhysics::Entities::PhysicalObject::~PhysicalObject()
 	DestroyBody();
 	PhysicalObject::DestroyedEvent.Invoke(*this);
 
+	if (m_transformHandlerID)
+		m_transform->RemoveNotificationHandler(*m_transformHandlerID);
+
 	if (m_internalTransform)
 		delete m_transform;
 }
@@ -64,15 +101,19 @@ void OvPhysics::Entities::PhysicalObject::Init()
 {
 	PhysicalObject::CreatedEvent.Invoke(*this);
 	CreateBody({});
+
+	m_transformHandlerID = m_transform->AddNotificationHandler(std::bind(&PhysicalObject::OnTransformNotification, this, std::placeholders::_1));
 }
 
 void OvPhysics::Entities::PhysicalObject::AddForce(const OvMaths::FVector3& p_force)
 {
+	m_body->activate();
 	m_body->applyCentralForce(Conversion::ToBtVector3(p_force));
 }
 
 void OvPhysics::Entities::PhysicalObject::AddImpulse(const OvMaths::FVector3& p_impulse)
 {
+	m_body->activate();
 	m_body->applyCentralImpulse(Conversion::ToBtVector3(p_impulse));
 }
 
@@ -131,6 +172,11 @@ bool OvPhysics::Entities::PhysicalObject::IsKinematic() const
 	return m_kinematic;
 }
 
+uint32_t OvPhysics::Entities::PhysicalObject::GetLayer() const
+{
+	return m_layer;
+}
+
 OvPhysics::Entities::PhysicalObject::EActivationState OvPhysics::Entities::PhysicalObject::GetActivationState() const
 {
 	return static_cast<EActivationState>(m_body->getActivationState());
@@ -145,6 +191,7 @@ void OvPhysics::Entities::PhysicalObject::SetMass(float p_mass)
 {
 	m_mass = p_mass;
 	ApplyInertia();
+	m_body->activate();
 }
 
 void OvPhysics::Entities::PhysicalObject::SetCollisionDetectionMode(ECollisionDetectionMode p_mode)
@@ -176,11 +223,13 @@ void OvPhysics::Entities::PhysicalObject::SetFriction(float p_friction)
 
 void OvPhysics::Entities::PhysicalObject::SetLinearVelocity(const OvMaths::FVector3 & p_linearVelocity)
 {
+	m_body->activate();
 	m_body->setLinearVelocity(Conversion::ToBtVector3(p_linearVelocity));
 }
 
 void OvPhysics::Entities::PhysicalObject::SetAngularVelocity(const OvMaths::FVector3 & p_angularVelocity)
 {
+	m_body->activate();
 	m_body->setAngularVelocity(Conversion::ToBtVector3(p_angularVelocity));
 }
 
@@ -201,7 +250,9 @@ void OvPhysics::Entities::PhysicalObject::SetTrigger(bool p_trigger)
 	else
 		RemoveFlag(*m_body, btCollisionObject::CF_NO_CONTACT_RESPONSE);
 
-	m_trigger = p_trigger;
+	// Pairs of triggers are filtered out of the broadphase
+	if (std::exchange(m_trigger, p_trigger) != p_trigger)
+		Reconsider();
 }
 
 void OvPhysics::Entities::PhysicalObject::SetKinematic(bool p_kinematic)
@@ -218,6 +269,14 @@ void OvPhysics::Entities::PhysicalObject::SetKinematic(bool p_kinematic)
 	RecreateBody();
 }
 
+void OvPhysics::Entities::PhysicalObject::SetLayer(uint32_t p_layer)
+{
+	const uint32_t layer = std::min(p_layer, Settings::PhysicsSettings::kLayerCount - 1);
+
+	if (std::exchange(m_layer, layer) != layer)
+		Reconsider();
+}
+
 void OvPhysics::Entities::PhysicalObject::SetActivationState(EActivationState p_activationState)
 {
 	m_body->setActivationState(static_cast<int>(p_activationState));
@@ -241,6 +300,12 @@ bool OvPhysics::Entities::PhysicalObject::IsEnabled() const
 void OvPhysics::Entities::PhysicalObject::UpdateBtTransform()
 {
 	m_body->setWorldTransform(Conversion::ToBtTransform(*m_transform));
+	m_body->activate();
+	m_transformDirty = false;
+
+	// The body is teleported, there is nothing to interpolate from
+	m_previousPosition = m_currentPosition = m_writtenPosition = m_transform->GetLocalPosition();
+	m_previousRotation = m_currentRotation = m_writtenRotation = m_transform->GetLocalRotation();
 
 	if (OvMaths::FVector3::Distance(m_transform->GetWorldScale(), m_previousScale) >= 0.01f)
 	{
@@ -255,11 +320,52 @@ void OvPhysics::Entities::PhysicalObject::UpdateFTransform()
 	if (!m_kinematic)
 	{
 		const btTransform& result = m_body->getWorldTransform();
-		m_transform->SetLocalPosition(Conversion::ToOvVector3(result.getOrigin()));
-		m_transform->SetLocalRotation(Conversion::ToOvQuaternion(result.getRotation()));
+
+		m_previousPosition = m_currentPosition;
+		m_previousRotation = m_currentRotation;
+		m_currentPosition = Conversion::ToOvVector3(result.getOrigin());
+		m_currentRotation = Conversion::ToOvQuaternion(result.getRotation());
+
+		InterpolateFTransform(1.0f);
 	}
 }
 
+void OvPhysics::Entities::PhysicalObject::ResetInterpolation()
+{
+	m_previousPosition = m_currentPosition;
+	m_previousRotation = m_currentRotation;
+}
+
+void OvPhysics::Entities::PhysicalObject::InterpolateFTransform(float p_alpha)
+{
+	if (m_kinematic)
+		return;
+
+	const bool atRest = m_previousPosition == m_currentPosition && m_previousRotation == m_currentRotation;
+
+	if (p_alpha >= 1.0f || atRest)
+	{
+		m_writtenPosition = m_currentPosition;
+		m_writtenRotation = m_currentRotation;
+	}
+	else
+	{
+		m_writtenPosition = OvMaths::FVector3::Lerp(m_previousPosition, m_currentPosition, p_alpha);
+		m_writtenRotation = OvMaths::FQuaternion::Slerp(m_previousRotation, m_currentRotation, p_alpha);
+	}
+
+	// Avoid notifying the transform (And its children) when nothing changed
+	m_writingTransform = true;
+
+	if (m_writtenPosition != m_transform->GetLocalPosition())
+		m_transform->SetLocalPosition(m_writtenPosition);
+
+	if (m_writtenRotation != m_transform->GetLocalRotation())
+		m_transform->SetLocalRotation(m_writtenRotation);
+
+	m_writingTransform = false;
+}
+
 void OvPhysics::Entities::PhysicalObject::RecreateBody()
 {
 	CreateBody(DestroyBody());
@@ -290,9 +396,19 @@ void OvPhysics::Entities::PhysicalObject::Unconsider()
 	}
 }
 
+void OvPhysics::Entities::PhysicalObject::Reconsider()
+{
+	// The collision filter of a body is computed when it enters the world
+	if (m_considered)
+	{
+		Unconsider();
+		Consider();
+	}
+}
+
 void OvPhysics::Entities::PhysicalObject::CreateBody(const Settings::BodySettings & p_bodySettings)
 {
-	m_motion = std::make_unique<btDefaultMotionState>(Conversion::ToBtTransform(*m_transform));
+	m_motion = std::make_unique<MotionState>(*this, Conversion::ToBtTransform(*m_transform));
 
 	m_body = std::make_unique<btRigidBody>(btRigidBody::btRigidBodyConstructionInfo{ 0.0f, m_motion.get(), m_shape.get(), btVector3(0.0f, 0.0f, 0.0f) });
 
@@ -306,13 +422,9 @@ void OvPhysics::Entities::PhysicalObject::CreateBody(const Settings::BodySetting
 	m_body->setAngularFactor(Conversion::ToBtVector3(p_bodySettings.angularFactor));
 	m_body->setUserPointer(this);
 
-	AddFlag(*m_body, btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
-
 	if (p_bodySettings.isTrigger)
 		AddFlag(*m_body, btCollisionObject::CF_NO_CONTACT_RESPONSE);
 
-	SetActivationState(EActivationState::ALWAYS_ACTIVE); // TODO: Avoid using always active
-
 	if (m_enabled)
 		Consider();
 }
@@ -349,6 +461,25 @@ OvMaths::FVector3 OvPhysics::Entities::PhysicalObject::CalculateInertia() const
 	return Conversion::ToOvVector3(result);
 }
 
+void OvPhysics::Entities::PhysicalObject::OnTransformNotification(OvMaths::Internal::TransformNotifier::ENotification p_notification)
+{
+	switch (p_notification)
+	{
+	case OvMaths::Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED:
+		// Changes made by the physics engine itself are already known by Bullet
+		if (!m_writingTransform && !m_transformDirty)
+		{
+			m_transformDirty = true;
+			MovedEvent.Invoke(*this);
+		}
+		break;
+
+	case OvMaths::Internal::TransformNotifier::ENotification::TRANSFORM_DESTROYED:
+		m_transformHandlerID.reset();
+		break;
+	}
+}
+
 btRigidBody& OvPhysics::Entities::PhysicalObject::GetBody()
 {
 	return *m_body;
@@ -0,0 +1,121 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace OvTools::Eventing
+{
+	template<class Signature>
+	class Delegate;
+
+	/**
+	* Type-erased callable, like std::function, storing small callables (Lambdas capturing a few pointers, std::bind of a
+	* member function to an instance) in place instead of allocating them. Larger callables are allocated
+	*/
+	template<class R, class... ArgTypes>
+	class Delegate<R(ArgTypes...)>
+	{
+	public:
+		/**
+		* Size of the inline storage. Callables up to this size (And nothrow movable) don't allocate
+		*/
+		static constexpr size_t kInlineSize = 4 * sizeof(void*);
+
+		/**
+		* Create an empty delegate
+		*/
+		Delegate() = default;
+
+		/**
+		* Create a delegate calling the given callable
+		* @param p_callable
+		*/
+		template<class Callable>
+			requires (!std::is_same_v<std::decay_t<Callable>, Delegate> && std::is_invocable_r_v<R, std::decay_t<Callable>&, ArgTypes...>)
+		Delegate(Callable&& p_callable);
+
+		/**
+		* Copy constructor
+		* @param p_other
+		*/
+		Delegate(const Delegate& p_other);
+
+		/**
+		* Move constructor
+		* @param p_other
+		*/
+		Delegate(Delegate&& p_other) noexcept;
+
+		/**
+		* Destructor
+		*/
+		~Delegate();
+
+		/**
+		* Copy assignment
+		* @param p_other
+		*/
+		Delegate& operator=(const Delegate& p_other);
+
+		/**
+		* Move assignment
+		* @param p_other
+		*/
+		Delegate& operator=(Delegate&& p_other) noexcept;
+
+		/**
+		* Call the callable. The delegate must not be empty
+		* @param p_args
+		*/
+		R operator()(ArgTypes... p_args) const;
+
+		/**
+		* Returns true if the delegate holds a callable
+		*/
+		explicit operator bool() const;
+
+		/**
+		* Returns true if the callable is stored in place (Didn't allocate)
+		*/
+		bool IsStoredInline() const;
+
+	private:
+		using Invoker = R(*)(void* p_storage, ArgTypes&&... p_args);
+
+		struct Operations
+		{
+			Invoker invoke;
+			void(*copy)(void* p_destination, const void* p_source);
+			void(*move)(void* p_destination, void* p_source) noexcept;
+			void(*destroy)(void* p_storage) noexcept;
+			bool storedInline;
+		};
+
+		template<class Callable>
+		static constexpr bool kFitsInline =
+			sizeof(Callable) <= kInlineSize &&
+			alignof(Callable) <= alignof(std::max_align_t) &&
+			std::is_nothrow_move_constructible_v<Callable>;
+
+		template<class Callable>
+		static const Operations kInlineOperations;
+
+		template<class Callable>
+		static const Operations kAllocatedOperations;
+
+		void Reset();
+
+	private:
+		alignas(std::max_align_t) mutable std::byte m_storage[kInlineSize];
+		Invoker m_invoke = nullptr; // Copy of m_operations->invoke, saves an indirection per call
+		const Operations* m_operations = nullptr;
+	};
+}
+
+#include "OvTools/Eventing/Delegate.inl"
@@ -0,0 +1,184 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <assert.h>
+#include <new>
+#include <utility>
+
+#include "OvTools/Eventing/Delegate.h"
+
+namespace OvTools::Eventing
+{
+	template<class R, class... ArgTypes>
+	template<class Callable>
+	const typename Delegate<R(ArgTypes...)>::Operations Delegate<R(ArgTypes...)>::kInlineOperations =
+	{
+		[](void* p_storage, ArgTypes&&... p_args) -> R
+		{
+			auto& callable = *std::launder(static_cast<Callable*>(p_storage));
+
+			// Like std::function, a delegate returning void discards the result of the callable
+			if constexpr (std::is_void_v<R>)
+				callable(std::forward<ArgTypes>(p_args)...);
+			else
+				return callable(std::forward<ArgTypes>(p_args)...);
+		},
+		[](void* p_destination, const void* p_source)
+		{
+			new (p_destination) Callable(*std::launder(static_cast<const Callable*>(p_source)));
+		},
+		[](void* p_destination, void* p_source) noexcept
+		{
+			auto* source = std::launder(static_cast<Callable*>(p_source));
+			new (p_destination) Callable(std::move(*source));
+			source->~Callable();
+		},
+		[](void* p_storage) noexcept
+		{
+			std::launder(static_cast<Callable*>(p_storage))->~Callable();
+		},
+		true
+	};
+
+	template<class R, class... ArgTypes>
+	template<class Callable>
+	const typename Delegate<R(ArgTypes...)>::Operations Delegate<R(ArgTypes...)>::kAllocatedOperations =
+	{
+		[](void* p_storage, ArgTypes&&... p_args) -> R
+		{
+			auto& callable = **static_cast<Callable**>(p_storage);
+
+			if constexpr (std::is_void_v<R>)
+				callable(std::forward<ArgTypes>(p_args)...);
+			else
+				return callable(std::forward<ArgTypes>(p_args)...);
+		},
+		[](void* p_destination, const void* p_source)
+		{
+			*static_cast<Callable**>(p_destination) = new Callable(**static_cast<Callable* const*>(p_source));
+		},
+		[](void* p_destination, void* p_source) noexcept
+		{
+			*static_cast<Callable**>(p_destination) = *static_cast<Callable**>(p_source);
+		},
+		[](void* p_storage) noexcept
+		{
+			delete *static_cast<Callable**>(p_storage);
+		},
+		false
+	};
+
+	template<class R, class... ArgTypes>
+	template<class Callable>
+		requires (!std::is_same_v<std::decay_t<Callable>, Delegate<R(ArgTypes...)>> && std::is_invocable_r_v<R, std::decay_t<Callable>&, ArgTypes...>)
+	Delegate<R(ArgTypes...)>::Delegate(Callable&& p_callable)
+	{
+		using StoredCallable = std::decay_t<Callable>;
+
+		if constexpr (kFitsInline<StoredCallable>)
+		{
+			new (m_storage) StoredCallable(std::forward<Callable>(p_callable));
+			m_operations = &kInlineOperations<StoredCallable>;
+			m_invoke = m_operations->invoke;
+		}
+		else
+		{
+			*reinterpret_cast<StoredCallable**>(m_storage) = new StoredCallable(std::forward<Callable>(p_callable));
+			m_operations = &kAllocatedOperations<StoredCallable>;
+			m_invoke = m_operations->invoke;
+		}
+	}
+
+	template<class R, class... ArgTypes>
+	Delegate<R(ArgTypes...)>::Delegate(const Delegate& p_other)
+	{
+		if (p_other.m_operations)
+		{
+			p_other.m_operations->copy(m_storage, p_other.m_storage);
+			m_operations = p_other.m_operations;
+			m_invoke = p_other.m_invoke;
+		}
+	}
+
+	template<class R, class... ArgTypes>
+	Delegate<R(ArgTypes...)>::Delegate(Delegate&& p_other) noexcept
+	{
+		if (p_other.m_operations)
+		{
+			p_other.m_operations->move(m_storage, p_other.m_storage);
+			m_operations = std::exchange(p_other.m_operations, nullptr);
+			m_invoke = std::exchange(p_other.m_invoke, nullptr);
+		}
+	}
+
+	template<class R, class... ArgTypes>
+	Delegate<R(ArgTypes...)>::~Delegate()
+	{
+		Reset();
+	}
+
+	template<class R, class... ArgTypes>
+	Delegate<R(ArgTypes...)>& Delegate<R(ArgTypes...)>::operator=(const Delegate& p_other)
+	{
+		if (this != &p_other)
+		{
+			Delegate copy(p_other);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	template<class R, class... ArgTypes>
+	Delegate<R(ArgTypes...)>& Delegate<R(ArgTypes...)>::operator=(Delegate&& p_other) noexcept
+	{
+		if (this != &p_other)
+		{
+			Reset();
+
+			if (p_other.m_operations)
+			{
+				p_other.m_operations->move(m_storage, p_other.m_storage);
+				m_operations = std::exchange(p_other.m_operations, nullptr);
+				m_invoke = std::exchange(p_other.m_invoke, nullptr);
+			}
+		}
+
+		return *this;
+	}
+
+	template<class R, class... ArgTypes>
+	R Delegate<R(ArgTypes...)>::operator()(ArgTypes... p_args) const
+	{
+		assert(m_invoke && "Cannot call an empty delegate");
+		return m_invoke(m_storage, std::forward<ArgTypes>(p_args)...);
+	}
+
+	template<class R, class... ArgTypes>
+	Delegate<R(ArgTypes...)>::operator bool() const
+	{
+		return m_operations != nullptr;
+	}
+
+	template<class R, class... ArgTypes>
+	bool Delegate<R(ArgTypes...)>::IsStoredInline() const
+	{
+		return m_operations && m_operations->storedInline;
+	}
+
+	template<class R, class... ArgTypes>
+	void Delegate<R(ArgTypes...)>::Reset()
+	{
+		if (m_operations)
+		{
+			m_operations->destroy(m_storage);
+			m_operations = nullptr;
+			m_invoke = nullptr;
+		}
+	}
+}
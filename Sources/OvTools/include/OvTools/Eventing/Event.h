@@ -8,6 +8,9 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
+
+#include "OvTools/Eventing/Delegate.h"
 
 namespace OvTools::Eventing
 {
@@ -18,16 +21,18 @@ namespace OvTools::Eventing
 	using ListenerID = uint64_t;
 
 	/**
-	* A simple event that contains a set of function callbacks. These functions will be called on invoke
+	* A simple event that contains a set of function callbacks. These functions will be called on invoke, in the order
+	* they were added. Listeners can be added or removed from a callback: added listeners are called from the next invoke,
+	* removed ones aren't called anymore
 	*/
 	template<class... ArgTypes>
 	class Event
 	{
 	public:
 		/**
-		* Simple shortcut for a generic function without return value
+		* Simple shortcut for a generic function without return value (Small callables don't allocate)
 		*/
-		using Callback = std::function<void(ArgTypes...)>;
+		using Callback = Delegate<void(ArgTypes...)>;
 
 		/**
 		* Add a function callback to this event
@@ -72,8 +77,21 @@ namespace OvTools::Eventing
 		void Invoke(ArgTypes... p_args);
 
 	private:
-		std::unordered_map<ListenerID, Callback>	m_callbacks;
-		ListenerID									m_availableListenerID = 0;
+		struct Listener
+		{
+			ListenerID id;
+			Callback callback;
+			bool removed = false;
+		};
+
+		void ApplyPendingChanges();
+
+	private:
+		std::vector<Listener>	m_listeners;			// Sorted by ID, since IDs only grow
+		std::vector<Listener>	m_pendingListeners;		// Added during an invoke
+		ListenerID				m_availableListenerID = 0;
+		uint32_t				m_invokeDepth = 0;
+		uint32_t				m_removedCount = 0;		// Removed during an invoke, still in m_listeners
 	};
 }
 
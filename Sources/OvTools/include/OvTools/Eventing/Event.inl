@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "OvTools/Eventing/Event.h"
 
 namespace OvTools::Eventing
@@ -14,20 +16,52 @@ namespace OvTools::Eventing
 	ListenerID Event<ArgTypes...>::AddListener(Callback p_callback)
 	{
 		ListenerID listenerID = m_availableListenerID++;
-		m_callbacks.emplace(listenerID, p_callback);
+
+		// Growing m_listeners during an invoke would move the callback being called
+		auto& target = m_invokeDepth > 0 ? m_pendingListeners : m_listeners;
+		target.push_back({ listenerID, std::move(p_callback) });
+
 		return listenerID;
 	}
 
 	template<class... ArgTypes>
 	ListenerID Event<ArgTypes...>::operator+=(Callback p_callback)
 	{
-		return AddListener(p_callback);
+		return AddListener(std::move(p_callback));
 	}
 
 	template<class... ArgTypes>
 	bool Event<ArgTypes...>::RemoveListener(ListenerID p_listenerID)
 	{
-		return m_callbacks.erase(p_listenerID) != 0;
+		auto found = std::lower_bound(m_listeners.begin(), m_listeners.end(), p_listenerID, [](const Listener& p_listener, ListenerID p_id)
+		{
+			return p_listener.id < p_id;
+		});
+
+		if (found != m_listeners.end() && found->id == p_listenerID)
+		{
+			if (found->removed)
+			{
+				return false;
+			}
+
+			if (m_invokeDepth > 0)
+			{
+				found->removed = true;
+				++m_removedCount;
+			}
+			else
+			{
+				m_listeners.erase(found);
+			}
+
+			return true;
+		}
+
+		return std::erase_if(m_pendingListeners, [p_listenerID](const Listener& p_listener)
+		{
+			return p_listener.id == p_listenerID;
+		}) != 0;
 	}
 
 	template<class... ArgTypes>
@@ -39,19 +73,66 @@ namespace OvTools::Eventing
 	template<class... ArgTypes>
 	void Event<ArgTypes...>::RemoveAllListeners()
 	{
-		m_callbacks.clear();
+		m_pendingListeners.clear();
+
+		if (m_invokeDepth > 0)
+		{
+			for (auto& listener : m_listeners)
+			{
+				listener.removed = true;
+			}
+
+			m_removedCount = static_cast<uint32_t>(m_listeners.size());
+		}
+		else
+		{
+			m_listeners.clear();
+			m_removedCount = 0;
+		}
 	}
 
 	template<class... ArgTypes>
 	uint64_t Event<ArgTypes...>::GetListenerCount()
 	{
-		return m_callbacks.size();
+		return m_listeners.size() - m_removedCount + m_pendingListeners.size();
 	}
 
 	template<class... ArgTypes>
 	void Event<ArgTypes...>::Invoke(ArgTypes... p_args)
 	{
-		for (auto const& [key, value] : m_callbacks)
-			value(p_args...);
+		// Leaves the invoke even if a callback throws, so that pending changes aren't held forever
+		struct InvokeScope
+		{
+			Event& event;
+			InvokeScope(Event& p_event) : event(p_event) { ++event.m_invokeDepth; }
+			~InvokeScope() { if (--event.m_invokeDepth == 0 && (event.m_removedCount > 0 || !event.m_pendingListeners.empty())) event.ApplyPendingChanges(); }
+		} scope(*this);
+
+		// Listeners added during the invoke are pending, the vector doesn't change size until the invoke ends
+		const size_t listenerCount = m_listeners.size();
+
+		for (size_t i = 0; i < listenerCount; ++i)
+		{
+			if (!m_listeners[i].removed)
+			{
+				m_listeners[i].callback(p_args...);
+			}
+		}
+	}
+
+	template<class... ArgTypes>
+	void Event<ArgTypes...>::ApplyPendingChanges()
+	{
+		if (m_removedCount > 0)
+		{
+			std::erase_if(m_listeners, [](const Listener& p_listener) { return p_listener.removed; });
+			m_removedCount = 0;
+		}
+
+		if (!m_pendingListeners.empty())
+		{
+			m_listeners.insert(m_listeners.end(), std::make_move_iterator(m_pendingListeners.begin()), std::make_move_iterator(m_pendingListeners.end()));
+			m_pendingListeners.clear();
+		}
 	}
-}
\ No newline at end of file
+}
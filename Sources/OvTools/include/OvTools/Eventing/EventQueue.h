@@ -0,0 +1,164 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "OvTools/Eventing/Event.h"
+
+namespace OvTools::Eventing
+{
+	/**
+	* An event type that can be coalesced: queuing an event with the same key as an already queued one replaces it
+	* (The queued event keeps its position, with the latest value)
+	*/
+	template<class T>
+	concept DeduplicatedEvent = requires(const T& p_event)
+	{
+		{ p_event.GetDeduplicationKey() } -> std::convertible_to<uint64_t>;
+	};
+
+	/**
+	* Deferred event bus. Events are queued by type during the frame, each type in its own reusable buffer, and delivered
+	* to the listeners of their type in batches when the queue is flushed (At well-defined points of the game loop).
+	* Not thread-safe: events must be queued and flushed from the same thread
+	*/
+	class EventQueue
+	{
+	public:
+		/**
+		* Listener of an event type, receiving every event of that type queued since the last flush, in queuing order
+		*/
+		template<class T>
+		using BatchCallback = typename Event<std::span<const T>>::Callback;
+
+		/**
+		* Maximum number of passes of a flush. Events queued by listeners during a flush are delivered by the next pass,
+		* events still queued after the last pass wait for the next flush
+		*/
+		static constexpr uint32_t kMaxFlushPasses = 8;
+
+		/**
+		* Constructor
+		*/
+		EventQueue() = default;
+
+		/**
+		* Destructor
+		*/
+		~EventQueue();
+
+		EventQueue(const EventQueue&) = delete;
+		EventQueue& operator=(const EventQueue&) = delete;
+
+		/**
+		* Queue an event, delivered at the next flush
+		* @param p_event
+		*/
+		template<class T>
+		void Enqueue(T p_event);
+
+		/**
+		* Construct an event in place in the queue, delivered at the next flush
+		* @param p_args
+		*/
+		template<class T, class... Args>
+		void Emplace(Args&&... p_args);
+
+		/**
+		* Add a listener to the given event type. Returns its ID, needed to unsubscribe
+		* @param p_callback
+		*/
+		template<class T>
+		ListenerID Subscribe(BatchCallback<T> p_callback);
+
+		/**
+		* Remove a listener of the given event type
+		* @param p_listenerID
+		*/
+		template<class T>
+		bool Unsubscribe(ListenerID p_listenerID);
+
+		/**
+		* Deliver every queued event. Event types are delivered in the order they were first used.
+		* Does nothing if called from a listener, during a flush
+		*/
+		void Flush();
+
+		/**
+		* Deliver the queued events of the given type only
+		*/
+		template<class T>
+		void Flush();
+
+		/**
+		* Discard every queued event, without delivering them
+		*/
+		void Clear();
+
+		/**
+		* Returns the number of queued events, of every type
+		*/
+		size_t GetPendingCount() const;
+
+		/**
+		* Returns the number of queued events of the given type
+		*/
+		template<class T>
+		size_t GetPendingCount() const;
+
+	private:
+		class IChannel
+		{
+		public:
+			virtual ~IChannel() = default;
+			virtual bool Flush() = 0;
+			virtual void Clear() = 0;
+			virtual size_t GetPendingCount() const = 0;
+		};
+
+		template<class T>
+		class Channel final : public IChannel
+		{
+		public:
+			void Push(T&& p_event);
+			bool Flush() override;
+			void Clear() override;
+			size_t GetPendingCount() const override;
+
+			Event<std::span<const T>> listeners;
+
+		private:
+			std::vector<T> m_events;
+			std::vector<T> m_delivering; // Swapped with m_events for the delivery, events queued meanwhile wait for the next pass
+			std::unordered_map<uint64_t, size_t> m_indices; // Deduplication key to index in m_events
+		};
+
+		static size_t NextTypeIndex();
+
+		template<class T>
+		static size_t GetTypeIndex();
+
+		template<class T>
+		Channel<T>& GetChannel();
+
+		template<class T>
+		Channel<T>* FindChannel() const;
+
+	private:
+		std::vector<std::unique_ptr<IChannel>> m_channels; // Indexed by type index, null for types this queue never used
+		std::vector<IChannel*> m_flushOrder;
+		bool m_flushing = false;
+	};
+}
+
+#include "OvTools/Eventing/EventQueue.inl"
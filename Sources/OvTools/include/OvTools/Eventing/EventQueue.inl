@@ -0,0 +1,141 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <utility>
+
+#include "OvTools/Eventing/EventQueue.h"
+
+namespace OvTools::Eventing
+{
+	template<class T>
+	void EventQueue::Enqueue(T p_event)
+	{
+		GetChannel<T>().Push(std::move(p_event));
+	}
+
+	template<class T, class... Args>
+	void EventQueue::Emplace(Args&&... p_args)
+	{
+		GetChannel<T>().Push(T{ std::forward<Args>(p_args)... });
+	}
+
+	template<class T>
+	ListenerID EventQueue::Subscribe(BatchCallback<T> p_callback)
+	{
+		return GetChannel<T>().listeners.AddListener(std::move(p_callback));
+	}
+
+	template<class T>
+	bool EventQueue::Unsubscribe(ListenerID p_listenerID)
+	{
+		auto channel = FindChannel<T>();
+		return channel && channel->listeners.RemoveListener(p_listenerID);
+	}
+
+	template<class T>
+	void EventQueue::Flush()
+	{
+		if (auto channel = FindChannel<T>(); channel && !m_flushing)
+		{
+			m_flushing = true;
+			channel->Flush();
+			m_flushing = false;
+		}
+	}
+
+	template<class T>
+	size_t EventQueue::GetPendingCount() const
+	{
+		auto channel = FindChannel<T>();
+		return channel ? channel->GetPendingCount() : 0;
+	}
+
+	template<class T>
+	size_t EventQueue::GetTypeIndex()
+	{
+		static const size_t index = NextTypeIndex();
+		return index;
+	}
+
+	template<class T>
+	EventQueue::Channel<T>& EventQueue::GetChannel()
+	{
+		const size_t index = GetTypeIndex<T>();
+
+		if (index >= m_channels.size())
+		{
+			m_channels.resize(index + 1);
+		}
+
+		auto& channel = m_channels[index];
+
+		if (!channel)
+		{
+			channel = std::make_unique<Channel<T>>();
+			m_flushOrder.push_back(channel.get());
+		}
+
+		return static_cast<Channel<T>&>(*channel);
+	}
+
+	template<class T>
+	EventQueue::Channel<T>* EventQueue::FindChannel() const
+	{
+		const size_t index = GetTypeIndex<T>();
+		return index < m_channels.size() ? static_cast<Channel<T>*>(m_channels[index].get()) : nullptr;
+	}
+
+	template<class T>
+	void EventQueue::Channel<T>::Push(T&& p_event)
+	{
+		if constexpr (DeduplicatedEvent<T>)
+		{
+			const auto [found, inserted] = m_indices.try_emplace(static_cast<uint64_t>(p_event.GetDeduplicationKey()), m_events.size());
+
+			if (!inserted)
+			{
+				m_events[found->second] = std::move(p_event);
+				return;
+			}
+		}
+
+		m_events.push_back(std::move(p_event));
+	}
+
+	template<class T>
+	bool EventQueue::Channel<T>::Flush()
+	{
+		if (m_events.empty())
+		{
+			return false;
+		}
+
+		std::swap(m_events, m_delivering);
+		m_indices.clear();
+
+		listeners.Invoke(std::span<const T>(m_delivering));
+
+		// Keeps the capacity, the buffers stop allocating once they fit a frame worth of events
+		m_delivering.clear();
+
+		return true;
+	}
+
+	template<class T>
+	void EventQueue::Channel<T>::Clear()
+	{
+		m_events.clear();
+		m_indices.clear();
+	}
+
+	template<class T>
+	size_t EventQueue::Channel<T>::GetPendingCount() const
+	{
+		return m_events.size();
+	}
+}
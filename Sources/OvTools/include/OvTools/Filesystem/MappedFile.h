@@ -0,0 +1,59 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace OvTools::Filesystem
+{
+	/**
+	* Read-only view of a file mapped in memory. The mapping is released on destruction
+	*/
+	class MappedFile final
+	{
+	public:
+		/**
+		* Map the given file in memory (Check IsValid() to know if the mapping succeeded)
+		* @param p_filePath
+		*/
+		MappedFile(const std::string& p_filePath);
+
+		/**
+		* Release the mapping
+		*/
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		* Returns true if the file has been successfully mapped
+		*/
+		bool IsValid() const;
+
+		/**
+		* Returns the mapped bytes (Empty if the mapping failed)
+		*/
+		std::span<const uint8_t> GetData() const;
+
+		/**
+		* Returns the size of the mapped file in bytes
+		*/
+		size_t GetSize() const;
+
+	private:
+		const uint8_t* m_data = nullptr;
+		size_t m_size = 0;
+
+#ifdef _WIN32
+		void* m_fileHandle = nullptr;
+		void* m_mappingHandle = nullptr;
+#endif
+	};
+}
@@ -29,7 +29,8 @@ namespace OvTools::Utils
 			SCENE,
 			SCRIPT,
 			FONT,
-			PARTICLE
+			PARTICLE,
+			PREFAB
 		};
 
 		/**
@@ -0,0 +1,75 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OvTools::Utils
+{
+	/**
+	* Fixed set of worker threads consuming a shared task queue
+	*/
+	class ThreadPool final
+	{
+	public:
+		/**
+		* Start the given number of worker threads
+		* @param p_workerCount
+		*/
+		ThreadPool(uint32_t p_workerCount);
+
+		/**
+		* Finish the queued tasks and join every worker thread
+		*/
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/**
+		* Queue a task to be executed by one of the workers
+		* @param p_task
+		*/
+		void Submit(std::function<void()> p_task);
+
+		/**
+		* Call the given function for every index in [0, p_count), spread over the workers.
+		* The calling thread processes indices too, and only returns once every index has been processed,
+		* so the function can safely reference the caller's stack (Nested calls from a task are allowed)
+		* @param p_count
+		* @param p_function
+		*/
+		void ParallelFor(uint32_t p_count, const std::function<void(uint32_t)>& p_function);
+
+		/**
+		* Returns the number of worker threads
+		*/
+		uint32_t GetWorkerCount() const;
+
+		/**
+		* Returns the pool shared by the engine systems, started on first use
+		* with one worker per hardware thread (Minus the calling one)
+		*/
+		static ThreadPool& GetDefault();
+
+	private:
+		void WorkerLoop(uint32_t p_index);
+
+	private:
+		std::vector<std::thread> m_workers;
+		std::deque<std::function<void()>> m_tasks;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_stopping = false;
+	};
+}
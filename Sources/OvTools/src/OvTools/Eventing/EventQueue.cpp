@@ -0,0 +1,69 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <atomic>
+
+#include <tracy/Tracy.hpp>
+
+#include "OvTools/Eventing/EventQueue.h"
+
+OvTools::Eventing::EventQueue::~EventQueue() = default;
+
+void OvTools::Eventing::EventQueue::Flush()
+{
+	ZoneScoped;
+
+	if (m_flushing)
+	{
+		return;
+	}
+
+	m_flushing = true;
+
+	for (uint32_t pass = 0; pass < kMaxFlushPasses; ++pass)
+	{
+		bool delivered = false;
+
+		// Indexed, since listeners can use new event types (Adding channels) during the flush
+		for (size_t i = 0; i < m_flushOrder.size(); ++i)
+		{
+			delivered |= m_flushOrder[i]->Flush();
+		}
+
+		if (!delivered)
+		{
+			break;
+		}
+	}
+
+	m_flushing = false;
+}
+
+void OvTools::Eventing::EventQueue::Clear()
+{
+	for (auto channel : m_flushOrder)
+	{
+		channel->Clear();
+	}
+}
+
+size_t OvTools::Eventing::EventQueue::GetPendingCount() const
+{
+	size_t count = 0;
+
+	for (auto channel : m_flushOrder)
+	{
+		count += channel->GetPendingCount();
+	}
+
+	return count;
+}
+
+size_t OvTools::Eventing::EventQueue::NextTypeIndex()
+{
+	static std::atomic<size_t> nextIndex = 0;
+	return nextIndex++;
+}
@@ -0,0 +1,106 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvTools/Filesystem/MappedFile.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+OvTools::Filesystem::MappedFile::MappedFile(const std::string& p_filePath)
+{
+#ifdef _WIN32
+	HANDLE file = CreateFileA(p_filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return;
+	}
+
+	if (void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0))
+	{
+		m_fileHandle = file;
+		m_mappingHandle = mapping;
+		m_data = static_cast<const uint8_t*>(view);
+		m_size = static_cast<size_t>(fileSize.QuadPart);
+	}
+	else
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+	}
+#else
+	const int file = open(p_filePath.c_str(), O_RDONLY);
+
+	if (file == -1)
+		return;
+
+	struct stat fileInfo;
+	if (fstat(file, &fileInfo) == 0 && fileInfo.st_size > 0)
+	{
+		void* view = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+		if (view != MAP_FAILED)
+		{
+			m_data = static_cast<const uint8_t*>(view);
+			m_size = static_cast<size_t>(fileInfo.st_size);
+		}
+	}
+
+	// The mapping stays valid once the descriptor is closed
+	close(file);
+#endif
+}
+
+OvTools::Filesystem::MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+	if (m_data)
+		UnmapViewOfFile(m_data);
+
+	if (m_mappingHandle)
+		CloseHandle(m_mappingHandle);
+
+	if (m_fileHandle)
+		CloseHandle(m_fileHandle);
+#else
+	if (m_data)
+		munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+}
+
+bool OvTools::Filesystem::MappedFile::IsValid() const
+{
+	return m_data != nullptr;
+}
+
+std::span<const uint8_t> OvTools::Filesystem::MappedFile::GetData() const
+{
+	return { m_data, m_size };
+}
+
+size_t OvTools::Filesystem::MappedFile::GetSize() const
+{
+	return m_size;
+}
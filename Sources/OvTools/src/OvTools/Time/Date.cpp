@@ -10,15 +10,19 @@
 #include "OvTools/Time/Date.h"
 
 std::string OvTools::Time::Date::GetDateAsString()
+{
+	return GetDateAsString(time(nullptr));
+}
+
+std::string OvTools::Time::Date::GetDateAsString(std::time_t p_time)
 {
 	std::string date;
-	const auto now = time(nullptr);
 	tm ltm;
 
 #ifdef _WIN32
-	localtime_s(&ltm, &now);
+	localtime_s(&ltm, &p_time);
 #else
-	localtime_r(&now, &ltm);
+	localtime_r(&p_time, &ltm);
 #endif
 
 	std::string dateData[6] =
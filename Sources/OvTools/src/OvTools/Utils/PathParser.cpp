@@ -95,6 +95,7 @@ std::string OvTools::Utils::PathParser::FileTypeToString(EFileType p_fileType)
 	case OvTools::Utils::PathParser::EFileType::SCRIPT:		return "Script";
 	case OvTools::Utils::PathParser::EFileType::FONT:		return "Font";
 	case OvTools::Utils::PathParser::EFileType::PARTICLE:	return "Particle";
+	case OvTools::Utils::PathParser::EFileType::PREFAB:		return "Prefab";
 	}
 
 	return "Unknown";
@@ -115,6 +116,7 @@ OvTools::Utils::PathParser::EFileType OvTools::Utils::PathParser::GetFileType(co
 	else if (ext == "lua" || ext == "ovscript") return EFileType::SCRIPT;
 	else if (ext == "ttf") return EFileType::FONT;
 	else if (ext == "ovpart") return EFileType::PARTICLE;
+	else if (ext == "ovprefab") return EFileType::PREFAB;
 
 	return EFileType::UNKNOWN;
 }
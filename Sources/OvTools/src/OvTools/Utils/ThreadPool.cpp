@@ -0,0 +1,132 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <tracy/Tracy.hpp>
+
+#include "OvTools/Utils/ThreadPool.h"
+
+OvTools::Utils::ThreadPool::ThreadPool(uint32_t p_workerCount)
+{
+	m_workers.reserve(p_workerCount);
+
+	for (uint32_t i = 0; i < p_workerCount; ++i)
+		m_workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+}
+
+OvTools::Utils::ThreadPool::~ThreadPool()
+{
+	{
+		std::scoped_lock lock(m_mutex);
+		m_stopping = true;
+	}
+
+	m_condition.notify_all();
+
+	for (auto& worker : m_workers)
+		worker.join();
+}
+
+void OvTools::Utils::ThreadPool::Submit(std::function<void()> p_task)
+{
+	if (m_workers.empty())
+	{
+		p_task();
+		return;
+	}
+
+	{
+		std::scoped_lock lock(m_mutex);
+		m_tasks.push_back(std::move(p_task));
+	}
+
+	m_condition.notify_one();
+}
+
+void OvTools::Utils::ThreadPool::ParallelFor(uint32_t p_count, const std::function<void(uint32_t)>& p_function)
+{
+	if (p_count == 0)
+		return;
+
+	// Shared with the helper tasks, which can still be dequeued after this call returned
+	struct Batch
+	{
+		std::atomic<uint32_t> next = 0;
+		std::atomic<uint32_t> done = 0;
+		uint32_t count = 0;
+		const std::function<void(uint32_t)>* function = nullptr;
+		std::mutex mutex;
+		std::condition_variable finished;
+	};
+
+	auto batch = std::make_shared<Batch>();
+	batch->count = p_count;
+	batch->function = &p_function;
+
+	// An index is only claimed while the caller is still waiting for it, so the function is always valid when called
+	auto process = [](Batch& p_batch)
+	{
+		for (uint32_t index = p_batch.next++; index < p_batch.count; index = p_batch.next++)
+		{
+			(*p_batch.function)(index);
+
+			if (++p_batch.done == p_batch.count)
+			{
+				std::scoped_lock lock(p_batch.mutex);
+				p_batch.finished.notify_all();
+			}
+		}
+	};
+
+	const uint32_t helperCount = std::min(p_count - 1, GetWorkerCount());
+
+	for (uint32_t i = 0; i < helperCount; ++i)
+		Submit([batch, process] { process(*batch); });
+
+	process(*batch);
+
+	std::unique_lock lock(batch->mutex);
+	batch->finished.wait(lock, [&batch] { return batch->done == batch->count; });
+}
+
+uint32_t OvTools::Utils::ThreadPool::GetWorkerCount() const
+{
+	return static_cast<uint32_t>(m_workers.size());
+}
+
+OvTools::Utils::ThreadPool& OvTools::Utils::ThreadPool::GetDefault()
+{
+	static ThreadPool instance(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+	return instance;
+}
+
+void OvTools::Utils::ThreadPool::WorkerLoop(uint32_t p_index)
+{
+	const std::string name = "Worker " + std::to_string(p_index);
+	tracy::SetThreadName(name.c_str());
+
+	while (true)
+	{
+		std::function<void()> task;
+
+		{
+			std::unique_lock lock(m_mutex);
+			m_condition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+
+			if (m_tasks.empty())
+				return;
+
+			task = std::move(m_tasks.front());
+			m_tasks.pop_front();
+		}
+
+		task();
+	}
+}
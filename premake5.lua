@@ -95,6 +95,7 @@ group "Overload SDK"
 group ""
 
 group "Overload Apps"
+	include "Sources/OvBenchmarks"
 	include "Sources/OvEditor"
 	include "Sources/OvGame"
 group ""